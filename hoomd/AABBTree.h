@@ -73,6 +73,15 @@ struct PYBIND11_EXPORT AABBNode
    periodically instead of continually updated.
     - buildTree : build an efficiently arranged tree given a complete set of AABBs, one for each
    particle.
+    - Insert / Remove : Add a particle with the next index to the leaf that grows least, or remove a
+   particle and move the last particle to its index (the same way ParticleData removes particles).
+   Both run in O(log N) time and keep the tree topology, so they fail (and leave the tree
+   unchanged) when the leaf is full or would become empty. Rebuild the tree in that case.
+    - Refit : Recompute the AABBs of all nodes from a complete set of AABBs, one for each particle,
+   keeping the tree topology. Runs in O(N) time. Unlike update(), refit() also shrinks nodes.
+   Queries remain exact for any particle positions, but become slower as the particles drift away
+   from the neighbors they were grouped with. Compare getCost() to its value after the last
+   buildTree() to decide when to rebuild.
 
     **Implementation details**
 
@@ -161,6 +170,24 @@ class PYBIND11_EXPORT AABBTree
     //! Update the AABB of a particle
     inline void update(unsigned int idx, const AABB& aabb);
 
+    //! Recompute the AABBs of all nodes, keeping the tree topology
+    inline Scalar refit(const AABB* aabbs, unsigned int N);
+
+    //! Add a particle to the tree, keeping the tree topology
+    inline bool insert(unsigned int idx, const AABB& aabb);
+
+    //! Remove a particle from the tree and give the last particle its index
+    inline bool remove(unsigned int idx);
+
+    //! Get the number of particles the tree was built with
+    inline unsigned int getNumParticles() const
+        {
+        return (unsigned int)m_mapping.size();
+        }
+
+    //! Get the sum of the surface areas of all nodes, an estimate of the cost of a query
+    inline Scalar getCost() const;
+
     //! Get the height of a given particle's leaf node
     inline unsigned int height(unsigned int idx);
 
@@ -257,6 +284,13 @@ class PYBIND11_EXPORT AABBTree
 
     //! Update the skip value for a node
     inline unsigned int updateSkip(unsigned int idx);
+
+    //! Get the surface area of an AABB
+    static inline Scalar surfaceArea(const AABB& aabb)
+        {
+        vec3<Scalar> extent = aabb.getUpper() - aabb.getLower();
+        return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+        }
     };
 
 /*! \param N Number of particles to allocate space for
@@ -348,6 +382,146 @@ inline void AABBTree::update(unsigned int idx, const AABB& aabb)
         }
     }
 
+/*! \param aabbs List of AABBs for each particle, indexed by particle
+    \param N Number of AABBs in the list (must match the number of particles in the tree)
+    \returns The cost of the refit tree (see getCost())
+
+    Refit the tree to a new set of particle AABBs without changing the tree topology. Nodes are
+   allocated in pre-order in buildNode(), so children always follow their parents in the node array
+   and a single reverse pass visits the children of every node before the node itself.
+*/
+inline Scalar AABBTree::refit(const AABB* aabbs, unsigned int N)
+    {
+    assert(N == m_mapping.size());
+
+    Scalar cost = 0;
+    for (unsigned int node_idx = m_num_nodes; node_idx-- > 0;)
+        {
+        AABBNode& node = m_nodes[node_idx];
+        if (node.left == INVALID_NODE)
+            {
+            node.aabb = aabbs[node.particles[0]];
+            node.particle_tags[0] = aabbs[node.particles[0]].tag;
+            for (unsigned int i = 1; i < node.num_particles; i++)
+                {
+                node.aabb = merge(node.aabb, aabbs[node.particles[i]]);
+                node.particle_tags[i] = aabbs[node.particles[i]].tag;
+                }
+            }
+        else
+            {
+            node.aabb = merge(m_nodes[node.left].aabb, m_nodes[node.right].aabb);
+            }
+
+        cost += surfaceArea(node.aabb);
+        }
+
+    return cost;
+    }
+
+/*! \param idx Index of the new particle, must be equal to getNumParticles()
+    \param aabb AABB of the new particle
+    \returns true if the particle was added, false if the tree must be rebuilt
+
+    Descend from the root into the child whose surface area grows least when merged with *aabb*
+   and add the particle to the leaf found. The AABBs of the leaf and its parents grow to enclose
+   *aabb*. insert() returns false without modifying the tree when the tree is empty or the leaf is
+   full.
+*/
+inline bool AABBTree::insert(unsigned int idx, const AABB& aabb)
+    {
+    assert(idx == m_mapping.size());
+
+    if (m_num_nodes == 0)
+        return false;
+
+    // find the leaf that grows least
+    unsigned int node_idx = m_root;
+    while (!isNodeLeaf(node_idx))
+        {
+        const AABBNode& node = m_nodes[node_idx];
+        Scalar growth_left = surfaceArea(merge(m_nodes[node.left].aabb, aabb))
+                             - surfaceArea(m_nodes[node.left].aabb);
+        Scalar growth_right = surfaceArea(merge(m_nodes[node.right].aabb, aabb))
+                              - surfaceArea(m_nodes[node.right].aabb);
+        node_idx = (growth_left <= growth_right) ? node.left : node.right;
+        }
+
+    AABBNode& leaf = m_nodes[node_idx];
+    if (leaf.num_particles == NODE_CAPACITY)
+        return false;
+
+    leaf.particles[leaf.num_particles] = idx;
+    leaf.particle_tags[leaf.num_particles] = aabb.tag;
+    leaf.num_particles++;
+    m_mapping.push_back(node_idx);
+
+    // grow the leaf and its parents
+    update(idx, aabb);
+    return true;
+    }
+
+/*! \param idx Index of the particle to remove
+    \returns true if the particle was removed, false if the tree must be rebuilt
+
+    Remove particle *idx* from its leaf and rename the last particle (getNumParticles()-1) to
+   *idx*, which matches the reordering performed by ParticleData::removeParticle(). The node AABBs
+   are not shrunk, call refit() to tighten them. remove() returns false without modifying the tree
+   when the particle is the only one in its leaf.
+*/
+inline bool AABBTree::remove(unsigned int idx)
+    {
+    assert(idx < m_mapping.size());
+
+    AABBNode& leaf = m_nodes[m_mapping[idx]];
+    if (leaf.num_particles == 1)
+        return false;
+
+    // replace the particle with the last one in the leaf
+    for (unsigned int i = 0; i < leaf.num_particles; i++)
+        {
+        if (leaf.particles[i] == idx)
+            {
+            leaf.particles[i] = leaf.particles[leaf.num_particles - 1];
+            leaf.particle_tags[i] = leaf.particle_tags[leaf.num_particles - 1];
+            leaf.num_particles--;
+            break;
+            }
+        }
+
+    // the last particle takes over the removed index
+    unsigned int last = (unsigned int)m_mapping.size() - 1;
+    if (idx != last)
+        {
+        AABBNode& last_leaf = m_nodes[m_mapping[last]];
+        for (unsigned int i = 0; i < last_leaf.num_particles; i++)
+            {
+            if (last_leaf.particles[i] == last)
+                {
+                last_leaf.particles[i] = idx;
+                break;
+                }
+            }
+        m_mapping[idx] = m_mapping[last];
+        }
+    m_mapping.pop_back();
+
+    return true;
+    }
+
+/*! \returns The sum of the surface areas of all nodes in the tree
+
+    Every query descends into the nodes it overlaps, so the expected cost of a query grows with the
+   total surface area of the nodes (the surface area heuristic).
+*/
+inline Scalar AABBTree::getCost() const
+    {
+    Scalar cost = 0;
+    for (unsigned int node_idx = 0; node_idx < m_num_nodes; node_idx++)
+        cost += surfaceArea(m_nodes[node_idx].aabb);
+    return cost;
+    }
+
 /*! \param idx Particle to get height for
     \returns Height of the node
 */
@@ -86,6 +86,12 @@ class PYBIND11_EXPORT Analyzer
     */
     virtual void resetStats() { }
 
+    //! Complete deferred work at the end of a run
+    /*! System calls finalizeRun() on all analyzers at the end of every run(). Derived classes that
+        defer work (for example, writing output on a background thread) should complete it here.
+    */
+    virtual void finalizeRun() { }
+
     //! Get needed pdata flags
     /*! Not all fields in ParticleData are computed by default. When derived classes need one of
        these optional fields, they must return the requested fields in getRequestedPDataFlags().
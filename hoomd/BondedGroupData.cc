@@ -168,6 +168,10 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::initialize()
     GPUVector<unsigned int> n_groups(m_exec_conf);
     m_gpu_n_groups.swap(n_groups);
 
+    GPUVector<members_t> index_table(m_exec_conf);
+    m_index_table.swap(index_table);
+    m_index_table_dirty = true;
+
 #ifdef ENABLE_MPI
     if (m_pdata->getDomainDecomposition())
         {
@@ -720,6 +724,33 @@ void BondedGroupData<group_size, Group, name, has_type_mapping>::maybe_rebuild_t
     m_invalid_cached_tags = false;
     }
 
+template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
+void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildIndexTable()
+    {
+    if (m_prof)
+        m_prof->push("update " + std::string(name) + " index table");
+
+    unsigned int ngroups_tot = m_n_groups + m_n_ghost;
+    m_index_table.resize(ngroups_tot);
+
+    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    ArrayHandle<members_t> h_groups(m_groups, access_location::host, access_mode::read);
+    ArrayHandle<members_t> h_index_table(m_index_table,
+                                         access_location::host,
+                                         access_mode::overwrite);
+
+    for (unsigned int group_idx = 0; group_idx < ngroups_tot; group_idx++)
+        {
+        const members_t& g = h_groups.data[group_idx];
+        members_t& h = h_index_table.data[group_idx];
+        for (unsigned int i = 0; i < group_size; ++i)
+            h.idx[i] = h_rtag.data[g.tag[i]];
+        }
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
 template<unsigned int group_size, typename Group, const char* name, bool has_type_mapping>
 void BondedGroupData<group_size, Group, name, has_type_mapping>::rebuildGPUTable()
     {
@@ -564,6 +564,28 @@ class BondedGroupData
         return m_gpu_n_groups;
         }
 
+    /*
+     * CPU group table
+     */
+
+    //! Return the local particle indices of the members of each local and ghost group
+    /*! The table is in the same order as getMembersArray(). It is rebuilt only after particles or
+        groups are reordered, so force computes read the member indices sequentially instead of
+        looking up every member tag in the reverse tag array on every step. Members that are not
+        present on this rank have the index NOT_LOCAL.
+    */
+    const GPUVector<members_t>& getIndexTable()
+        {
+        // rebuild lookup table if necessary
+        if (m_index_table_dirty)
+            {
+            rebuildIndexTable();
+            m_index_table_dirty = false;
+            }
+
+        return m_index_table;
+        }
+
     /*
      * add/remove groups globally
      */
@@ -603,6 +625,7 @@ class BondedGroupData
         {
         // set flag to trigger rebuild of GPU table
         m_groups_dirty = true;
+        m_index_table_dirty = true;
 
         // notify subscribers
         m_group_reorder_signal.emit();
@@ -612,6 +635,7 @@ class BondedGroupData
     void setDirty()
         {
         m_groups_dirty = true;
+        m_index_table_dirty = true;
         }
 
     protected:
@@ -637,6 +661,7 @@ class BondedGroupData
     GPUVector<unsigned int> m_gpu_pos_table; //!< Position of particle idx in group table
     Index2D m_gpu_table_indexer;             //!< Indexer for GPU table
     GPUVector<unsigned int> m_gpu_n_groups;  //!< Number of entries in lookup table per particle
+    GPUVector<members_t> m_index_table;      //!< Local particle indices of the group members
     std::vector<std::string> m_type_mapping; //!< Mapping of types of bonded groups
 
     unsigned int m_n_groups; //!< Number of local groups
@@ -663,7 +688,8 @@ class BondedGroupData
     std::shared_ptr<Profiler> m_prof; //!< Profiler
 
     private:
-    bool m_groups_dirty; //!< Is it necessary to rebuild the lookup-by-index table?
+    bool m_groups_dirty;             //!< Is it necessary to rebuild the lookup-by-index table?
+    bool m_index_table_dirty = true; //!< Is it necessary to rebuild the member index table?
 
     Nano::Signal<void()> m_group_num_change_signal; //!< Signal that is triggered when groups are
                                                     //!< added or deleted (globally)
@@ -679,6 +705,9 @@ class BondedGroupData
     //! Helper function to rebuild lookup by index table
     void rebuildGPUTable();
 
+    //! Helper function to rebuild the member index table
+    void rebuildIndexTable();
+
     //! Resize internal tables
     /*! \param new_size New size of local group tables, new_size = n_local + n_ghost
      */
@@ -10,6 +10,11 @@
 
 #include <algorithm>
 
+#ifdef ENABLE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -491,9 +496,6 @@ void CellList::computeCellList()
     Index3D ci = m_cell_indexer;
     Index2D cli = m_cell_list_indexer;
 
-    // clear the bin sizes to 0
-    memset(h_cell_size.data, 0, sizeof(unsigned int) * m_cell_indexer.getNumElements());
-
     Scalar3 ghost_width = getGhostWidth();
 
     // get periodic flags
@@ -502,13 +504,15 @@ void CellList::computeCellList()
     // for each particle
     unsigned n_tot_particles = m_pdata->getN() + m_pdata->getNGhosts();
 
-    for (unsigned int n = 0; n < n_tot_particles; n++)
-        {
+    // find the bin particle n belongs in, returns false and sets the error conditions when the
+    // particle is not placed in any bin
+    auto find_bin = [&](unsigned int n, unsigned int& bin, uint3& conditions) -> bool
+    {
         Scalar3 p = make_scalar3(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z);
         if (std::isnan(p.x) || std::isnan(p.y) || std::isnan(p.z))
             {
-            conditions.y = n + 1;
-            continue;
+            conditions.y = max((unsigned int)conditions.y, n + 1);
+            return false;
             }
 
         // find the bin each particle belongs in
@@ -524,8 +528,8 @@ void CellList::computeCellList()
             {
             // if a ghost particle is out of bounds, silently ignore it
             if (n < m_pdata->getN())
-                conditions.z = n + 1;
-            continue;
+                conditions.z = max((unsigned int)conditions.z, n + 1);
+            return false;
             }
 
         // need to handle the case where the particle is exactly at the box hi
@@ -540,19 +544,24 @@ void CellList::computeCellList()
         assert((ib < (int)(m_dim.x) && jb < (int)(m_dim.y) && kb < (int)(m_dim.z))
                || n >= m_pdata->getN());
 
-        // record its bin
-        unsigned int bin = ci(ib, jb, kb);
-
         // all particles should be in a valid cell
         if (ib < 0 || ib >= (int)m_dim.x || jb < 0 || jb >= (int)m_dim.y || kb < 0
             || kb >= (int)m_dim.z)
             {
             // but ghost particles that are out of range should not produce an error
             if (n < m_pdata->getN())
-                conditions.z = n + 1;
-            continue;
+                conditions.z = max((unsigned int)conditions.z, n + 1);
+            return false;
             }
 
+        // record its bin
+        bin = ci(ib, jb, kb);
+        return true;
+    };
+
+    // store the bin entries of particle n in the given cell list slot
+    auto write_entry = [&](unsigned int n, unsigned int slot)
+    {
         // setup the flag value to store
         Scalar flag;
         if (m_flag_charge)
@@ -562,42 +571,133 @@ void CellList::computeCellList()
         else
             flag = __int_as_scalar(n);
 
-        // store the bin entries
-        unsigned int offset = h_cell_size.data[bin];
+        if (m_compute_xyzf)
+            {
+            h_xyzf.data[slot]
+                = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
+            }
 
-        if (offset < m_Nmax)
+        if (m_compute_tdb)
             {
-            if (m_compute_xyzf)
-                {
-                h_xyzf.data[cli(offset, bin)]
-                    = make_scalar4(h_pos.data[n].x, h_pos.data[n].y, h_pos.data[n].z, flag);
-                }
+            h_tdb.data[slot] = make_scalar4(h_pos.data[n].w,
+                                            h_diameter.data[n],
+                                            __int_as_scalar(h_body.data[n]),
+                                            Scalar(0.0));
+            }
 
-            if (m_compute_tdb)
-                {
-                h_tdb.data[cli(offset, bin)] = make_scalar4(h_pos.data[n].w,
-                                                            h_diameter.data[n],
-                                                            __int_as_scalar(h_body.data[n]),
-                                                            Scalar(0.0));
-                }
+        if (m_compute_orientation)
+            {
+            h_cell_orientation.data[slot] = h_orientation.data[n];
+            }
 
-            if (m_compute_orientation)
+        if (m_compute_idx)
+            {
+            h_cell_idx.data[slot] = n;
+            }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // Parallel counting sort: particles claim slots in their cell with an atomic counter, then
+        // the members of each cell are sorted by particle index so that the cell list is
+        // identical to the one built serially.
+        const unsigned int n_cells = ci.getNumElements();
+        if (m_cell_size_atomic.size() != n_cells)
+            m_cell_size_atomic = std::vector<std::atomic<unsigned int>>(n_cells);
+        m_cell_members.resize(cli.getNumElements());
+
+        tbb::enumerable_thread_specific<uint3> thread_conditions(make_uint3(0, 0, 0));
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_cells),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (unsigned int bin = r.begin(); bin != r.end(); ++bin)
+                            m_cell_size_atomic[bin].store(0, std::memory_order_relaxed);
+                    });
+
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_tot_particles),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        uint3& conditions = thread_conditions.local();
+                        for (unsigned int n = r.begin(); n != r.end(); ++n)
+                            {
+                            unsigned int bin;
+                            if (!find_bin(n, bin, conditions))
+                                continue;
+
+                            unsigned int offset
+                                = m_cell_size_atomic[bin].fetch_add(1, std::memory_order_relaxed);
+                            if (offset < m_Nmax)
+                                m_cell_members[cli(offset, bin)] = n;
+                            }
+                    });
+
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_cells),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        uint3& conditions = thread_conditions.local();
+                        for (unsigned int bin = r.begin(); bin != r.end(); ++bin)
+                            {
+                            unsigned int size
+                                = m_cell_size_atomic[bin].load(std::memory_order_relaxed);
+                            h_cell_size.data[bin] = size;
+
+                            if (size > m_Nmax)
+                                {
+                                // the cell list is rebuilt after reallocation, skip the entries
+                                conditions.x = max((unsigned int)conditions.x, size);
+                                continue;
+                                }
+
+                            unsigned int* first = m_cell_members.data() + cli(0, bin);
+                            std::sort(first, first + size);
+                            for (unsigned int offset = 0; offset < size; ++offset)
+                                write_entry(first[offset], cli(offset, bin));
+                            }
+                    });
+            });
+
+        for (const auto& c : thread_conditions)
+            {
+            conditions.x = max(conditions.x, c.x);
+            conditions.y = max(conditions.y, c.y);
+            conditions.z = max(conditions.z, c.z);
+            }
+        }
+    else
+#endif
+        {
+        // clear the bin sizes to 0
+        memset(h_cell_size.data, 0, sizeof(unsigned int) * m_cell_indexer.getNumElements());
+
+        for (unsigned int n = 0; n < n_tot_particles; n++)
+            {
+            unsigned int bin;
+            if (!find_bin(n, bin, conditions))
+                continue;
+
+            // store the bin entries
+            unsigned int offset = h_cell_size.data[bin];
+
+            if (offset < m_Nmax)
                 {
-                h_cell_orientation.data[cli(offset, bin)] = h_orientation.data[n];
+                write_entry(n, cli(offset, bin));
                 }
-
-            if (m_compute_idx)
+            else
                 {
-                h_cell_idx.data[cli(offset, bin)] = n;
+                conditions.x = max((unsigned int)conditions.x, offset + 1);
                 }
-            }
-        else
-            {
-            conditions.x = max((unsigned int)conditions.x, offset + 1);
-            }
 
-        // increment the cell occupancy counter
-        h_cell_size.data[bin]++;
+            // increment the cell occupancy counter
+            h_cell_size.data[bin]++;
+            }
         }
 
         {
@@ -10,6 +10,11 @@
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
 
+#ifdef ENABLE_TBB
+#include <atomic>
+#include <vector>
+#endif
+
 /*! \file CellList.h
     \brief Declares the CellList class
 */
@@ -95,6 +100,11 @@ namespace hoomd
     Condition flags are to be set during the computeCellList() call and will be checked by compute()
    which will then take the appropriate action. If possible, flags 1 and 2 should be set to the
    index of the particle causing the flag plus 1.
+
+    <b>Threading:</b>
+    When built with TBB and more than one CPU thread is active, computeCellList() fills the cells
+   in parallel with a counting sort. The members of each cell are sorted by particle index so the
+   result is identical to the serial build.
 */
 class PYBIND11_EXPORT CellList : public Compute
     {
@@ -394,6 +404,11 @@ class PYBIND11_EXPORT CellList : public Compute
     bool m_sort_cell_list;   //!< If true, sort cell list
     bool m_compute_adj_list; //!< If true, compute the cell adjacency lists
 
+#ifdef ENABLE_TBB
+    std::vector<std::atomic<unsigned int>> m_cell_size_atomic; //!< Cell sizes for threaded builds
+    std::vector<unsigned int> m_cell_members; //!< Particle index in each slot for threaded builds
+#endif
+
 #ifdef ENABLE_MPI
     /// The system's communicator.
     std::shared_ptr<Communicator> m_comm;
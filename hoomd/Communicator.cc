@@ -1393,6 +1393,7 @@ Communicator::Communicator(std::shared_ptr<SystemDefinition> sysdef,
 Communicator::~Communicator()
     {
     m_exec_conf->msg->notice(5) << "Destroying Communicator" << std::endl;
+    freeGhostUpdateRequests();
     m_pdata->getParticleSortSignal().disconnect<Communicator, &Communicator::forceMigrate>(this);
     m_pdata->getGhostParticlesRemovedSignal()
         .disconnect<Communicator, &Communicator::slotGhostParticlesRemoved>(this);
@@ -1537,6 +1538,10 @@ void Communicator::communicate(uint64_t timestep)
         {
         // do an obligatory update before determining whether to migrate
         beginUpdateGhosts(timestep);
+
+        // compute on local particles while the ghosts are in flight
+        m_overlap_compute_callbacks.emit(timestep);
+
         finishUpdateGhosts(timestep);
 
         // call subscribers after ghost update, but before distance check
@@ -1562,6 +1567,9 @@ void Communicator::communicate(uint64_t timestep)
         {
         beginUpdateGhosts(timestep);
 
+        // compute on local particles while the ghosts are in flight
+        m_overlap_compute_callbacks.emit(timestep);
+
         finishUpdateGhosts(timestep);
         }
 
@@ -1823,6 +1831,9 @@ void Communicator::exchangeGhosts()
 
     m_exec_conf->msg->notice(7) << "Communicator: exchange ghosts" << std::endl;
 
+    // the ghost send lists change, so the persistent ghost update requests are rebuilt
+    freeGhostUpdateRequests();
+
     const BoxDim& box = m_pdata->getBox();
 
     // Sending ghosts proceeds in two stages:
@@ -2680,6 +2691,11 @@ void Communicator::exchangeGhosts()
     }
 
 //! update positions of ghost particles
+/*! The ghost send lists do not change between ghost exchanges, so the messages of each direction
+    are set up once as persistent requests on packed buffers (see initGhostUpdateRequests()). Every
+    update packs the fields selected by the communication flags into one buffer per neighbor and
+    starts the requests.
+*/
 void Communicator::beginUpdateGhosts(uint64_t timestep)
     {
     // we have a current m_copy_ghosts liss which contain the indices of particles
@@ -2689,7 +2705,17 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
 
     m_exec_conf->msg->notice(7) << "Communicator: update ghosts" << std::endl;
 
-    // update data in these arrays
+    // only non-permanent fields (position, velocity, orientation) need to be considered here
+    // charge, body, image and diameter are not updated between neighbor list builds, so they do not
+    // change the layout of the update buffers
+    const CommFlags requested_flags = getFlags();
+    CommFlags flags;
+    flags[comm_flag::position] = requested_flags[comm_flag::position];
+    flags[comm_flag::velocity] = requested_flags[comm_flag::velocity];
+    flags[comm_flag::orientation] = requested_flags[comm_flag::orientation];
+
+    if (!m_ghost_update_reqs_valid || flags != m_ghost_update_flags)
+        initGhostUpdateRequests(flags);
 
     unsigned int num_tot_recv_ghosts = 0; // total number of ghosts received
 
@@ -2698,16 +2724,20 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
         if (!isCommunicating(dir))
             continue;
 
-        CommFlags flags = getFlags();
+        // the send list of this direction may contain ghosts received from the previous one
+        completeGhostDirection();
 
-        if (flags[comm_flag::position])
+        // pack the selected fields into the send buffer, one block per field
             {
             ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
                                        access_location::host,
                                        access_mode::read);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
+            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                       access_location::host,
+                                       access_mode::read);
+            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                                access_location::host,
-                                               access_mode::overwrite);
+                                               access_mode::read);
             ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
                                                     access_location::host,
                                                     access_mode::read);
@@ -2715,214 +2745,197 @@ void Communicator::beginUpdateGhosts(uint64_t timestep)
                                              access_location::host,
                                              access_mode::read);
 
-            // copy positions of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
+            const unsigned int n = m_num_copy_ghosts[dir];
+            Scalar4* sendbuf = m_ghost_update_sendbuf[dir].data();
+            for (unsigned int ghost_idx = 0; ghost_idx < n; ghost_idx++)
                 {
                 unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
 
                 assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
 
-                // copy position into send buffer
-                h_pos_copybuf.data[ghost_idx] = h_pos.data[idx];
+                unsigned int offset = ghost_idx;
+                if (flags[comm_flag::position])
+                    {
+                    sendbuf[offset] = h_pos.data[idx];
+                    offset += n;
+                    }
+                if (flags[comm_flag::velocity])
+                    {
+                    sendbuf[offset] = h_vel.data[idx];
+                    offset += n;
+                    }
+                if (flags[comm_flag::orientation])
+                    {
+                    sendbuf[offset] = h_orientation.data[idx];
+                    }
                 }
             }
 
-        if (flags[comm_flag::velocity])
-            {
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::read);
-            ArrayHandle<Scalar4> h_velocity_copybuf(m_velocity_copybuf,
-                                                    access_location::host,
-                                                    access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
-
-            // copy velocity of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+        unsigned int start_idx = m_pdata->getN() + num_tot_recv_ghosts;
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
 
-                // copy velocity into send buffer
-                h_velocity_copybuf.data[ghost_idx] = h_vel.data[idx];
-                }
-            }
+        // start the send and receive of this direction, they are completed before packing the
+        // next direction or in finishUpdateGhosts()
+        if (m_ghost_update_nfields > 0)
+            MPI_Startall(2, &m_ghost_update_reqs[2 * dir]);
 
-        if (flags[comm_flag::orientation])
-            {
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::read);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-            ArrayHandle<unsigned int> h_copy_ghosts(m_copy_ghosts[dir],
-                                                    access_location::host,
-                                                    access_mode::read);
-            ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(),
-                                             access_location::host,
-                                             access_mode::read);
+        m_comm_pending = true;
+        m_pending_ghost_dir = dir;
+        m_pending_ghost_start = start_idx;
+        m_pending_ghost_num = m_num_recv_ghosts[dir];
+        } // end dir loop
 
-            // copy orientation of ghost particles
-            for (unsigned int ghost_idx = 0; ghost_idx < m_num_copy_ghosts[dir]; ghost_idx++)
-                {
-                unsigned int idx = h_rtag.data[h_copy_ghosts.data[ghost_idx]];
+    if (m_prof)
+        m_prof->pop();
+    }
 
-                assert(idx < m_pdata->getN() + m_pdata->getNGhosts());
+/*! Complete the ghost update started by beginUpdateGhosts().
 
-                // copy orientation into send buffer
-                h_orientation_copybuf.data[ghost_idx] = h_orientation.data[idx];
-                }
-            }
+    \param timestep The time step
+*/
+void Communicator::finishUpdateGhosts(uint64_t timestep)
+    {
+    if (m_prof)
+        m_prof->push("comm_ghost_update");
 
-        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
+    completeGhostDirection();
 
-        // we receive from the direction opposite to the one we send to
-        unsigned int recv_neighbor;
-        if (dir % 2 == 0)
-            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
-        else
-            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
+    if (m_prof)
+        m_prof->pop();
+    }
 
-        unsigned int start_idx;
+/*! Wait for the requests of the direction started last in beginUpdateGhosts(), unpack the
+    received fields and wrap the positions of the received ghosts.
+*/
+void Communicator::completeGhostDirection()
+    {
+    if (!m_comm_pending)
+        return;
 
-        if (m_prof)
-            m_prof->push("MPI send/recv");
+    m_comm_pending = false;
+    if (m_ghost_update_nfields == 0)
+        return;
 
-        start_idx = m_pdata->getN() + num_tot_recv_ghosts;
+    const unsigned int dir = m_pending_ghost_dir;
 
-        num_tot_recv_ghosts += m_num_recv_ghosts[dir];
+    if (m_prof)
+        m_prof->push("MPI send/recv");
 
-        size_t sz = 0;
-        // only non-permanent fields (position, velocity, orientation) need to be considered here
-        // charge, body, image and diameter are not updated between neighbor list builds
-        if (flags[comm_flag::position])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    MPI_Status stats[2];
+    MPI_Waitall(2, &m_ghost_update_reqs[2 * dir], stats);
 
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+    if (m_prof)
+        m_prof->pop(0,
+                    (m_num_recv_ghosts[dir] + m_num_copy_ghosts[dir]) * m_ghost_update_nfields
+                        * sizeof(Scalar4));
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                               access_location::host,
+                               access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
                                        access_location::host,
                                        access_mode::readwrite);
-            ArrayHandle<Scalar4> h_pos_copybuf(m_pos_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_pos_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_pos.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      1,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+    const unsigned int n = m_pending_ghost_num;
+    const Scalar4* recvbuf = m_ghost_update_recvbuf[dir].data();
+    const BoxDim shifted_box = getShiftedBox();
+    for (unsigned int ghost_idx = 0; ghost_idx < n; ghost_idx++)
+        {
+        unsigned int idx = m_pending_ghost_start + ghost_idx;
+        unsigned int offset = ghost_idx;
+        if (m_ghost_update_flags[comm_flag::position])
+            {
+            Scalar4 pos = recvbuf[offset];
 
-            sz += sizeof(Scalar4);
+            // wrap particles received across a global boundary
+            int3 img = make_int3(0, 0, 0);
+            shifted_box.wrap(pos, img);
+            h_pos.data[idx] = pos;
+            offset += n;
             }
-
-        if (flags[comm_flag::velocity])
+        if (m_ghost_update_flags[comm_flag::velocity])
             {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+            h_vel.data[idx] = recvbuf[offset];
+            offset += n;
+            }
+        if (m_ghost_update_flags[comm_flag::orientation])
+            {
+            h_orientation.data[idx] = recvbuf[offset];
+            }
+        }
+    }
 
-            ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-            ArrayHandle<Scalar4> h_vel_copybuf(m_velocity_copybuf,
-                                               access_location::host,
-                                               access_mode::read);
+/*! \param flags Fields to send in the ghost updates
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_vel_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      send_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_vel.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
-                      MPI_BYTE,
-                      recv_neighbor,
-                      2,
-                      m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
+    Sizes the packed send and receive buffers of every direction for the current ghost lists and
+    creates persistent send and receive requests on them.
+*/
+void Communicator::initGhostUpdateRequests(CommFlags flags)
+    {
+    freeGhostUpdateRequests();
 
-            sz += sizeof(Scalar4);
-            }
+    m_ghost_update_flags = flags;
+    m_ghost_update_nfields = (flags[comm_flag::position] ? 1 : 0)
+                             + (flags[comm_flag::velocity] ? 1 : 0)
+                             + (flags[comm_flag::orientation] ? 1 : 0);
 
-        if (flags[comm_flag::orientation])
-            {
-            m_reqs.resize(2);
-            m_stats.resize(2);
+    for (unsigned int dir = 0; dir < 6; dir++)
+        {
+        m_ghost_update_reqs[2 * dir] = MPI_REQUEST_NULL;
+        m_ghost_update_reqs[2 * dir + 1] = MPI_REQUEST_NULL;
 
-            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
-                                               access_location::host,
-                                               access_mode::readwrite);
-            ArrayHandle<Scalar4> h_orientation_copybuf(m_orientation_copybuf,
-                                                       access_location::host,
-                                                       access_mode::read);
+        if (!isCommunicating(dir) || m_ghost_update_nfields == 0)
+            continue;
 
-            // exchange particle data, write directly to the particle data arrays
-            MPI_Isend(h_orientation_copybuf.data,
-                      (unsigned int)(m_num_copy_ghosts[dir] * sizeof(Scalar4)),
+        m_ghost_update_sendbuf[dir].resize(
+            std::max(m_num_copy_ghosts[dir] * m_ghost_update_nfields, 1u));
+        m_ghost_update_recvbuf[dir].resize(
+            std::max(m_num_recv_ghosts[dir] * m_ghost_update_nfields, 1u));
+
+        unsigned int send_neighbor = m_decomposition->getNeighborRank(dir);
+
+        // we receive from the direction opposite to the one we send to
+        unsigned int recv_neighbor;
+        if (dir % 2 == 0)
+            recv_neighbor = m_decomposition->getNeighborRank(dir + 1);
+        else
+            recv_neighbor = m_decomposition->getNeighborRank(dir - 1);
+
+        MPI_Send_init(m_ghost_update_sendbuf[dir].data(),
+                      int(m_num_copy_ghosts[dir] * m_ghost_update_nfields * sizeof(Scalar4)),
                       MPI_BYTE,
                       send_neighbor,
-                      3,
+                      1,
                       m_mpi_comm,
-                      &m_reqs[0]);
-            MPI_Irecv(h_orientation.data + start_idx,
-                      (unsigned int)(m_num_recv_ghosts[dir] * sizeof(Scalar4)),
+                      &m_ghost_update_reqs[2 * dir]);
+        MPI_Recv_init(m_ghost_update_recvbuf[dir].data(),
+                      int(m_num_recv_ghosts[dir] * m_ghost_update_nfields * sizeof(Scalar4)),
                       MPI_BYTE,
                       recv_neighbor,
-                      3,
+                      1,
                       m_mpi_comm,
-                      &m_reqs[1]);
-            MPI_Waitall(2, &m_reqs.front(), &m_stats.front());
-
-            sz += sizeof(Scalar4);
-            }
-
-        if (m_prof)
-            m_prof->pop(0, (m_num_recv_ghosts[dir] + m_num_copy_ghosts[dir]) * sz);
-
-        // wrap particle positions (only if copying positions)
-        if (flags[comm_flag::position])
-            {
-            ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
-                                       access_location::host,
-                                       access_mode::readwrite);
-
-            const BoxDim shifted_box = getShiftedBox();
-            for (unsigned int idx = start_idx; idx < start_idx + m_num_recv_ghosts[dir]; idx++)
-                {
-                Scalar4& pos = h_pos.data[idx];
+                      &m_ghost_update_reqs[2 * dir + 1]);
+        }
 
-                // wrap particles received across a global boundary
-                int3 img = make_int3(0, 0, 0);
-                shifted_box.wrap(pos, img);
-                }
-            }
+    m_ghost_update_reqs_valid = true;
+    }
 
-        } // end dir loop
+//! Release the persistent ghost update requests
+void Communicator::freeGhostUpdateRequests()
+    {
+    if (!m_ghost_update_reqs_valid)
+        return;
 
-    if (m_prof)
-        m_prof->pop();
+    for (auto& req : m_ghost_update_reqs)
+        {
+        if (req != MPI_REQUEST_NULL)
+            MPI_Request_free(&req);
+        }
+    m_ghost_update_reqs_valid = false;
     }
 
 void Communicator::updateNetForce(uint64_t timestep)
@@ -237,6 +237,22 @@ class PYBIND11_EXPORT Communicator
         return m_compute_callbacks;
         }
 
+    //! Subscribe to list of *optional* call-backs for computation overlapping the ghost update
+    /*!
+     * Subscribers are called between beginUpdateGhosts() and finishUpdateGhosts() of the ghost
+     * update that precedes the migration check, and before the compute callbacks. They may compute
+     * on local particles that do not interact with ghost particles, but must not access the ghost
+     * particle data. The compute callbacks may still move local particles (such as rigid body
+     * constituents), and the particles may migrate afterwards, so subscribers must validate their
+     * results before using them.
+     *
+     * \return A Nano::Signal object reference to be used for connect and disconnect calls.
+     */
+    Nano::Signal<void(uint64_t timestep)>& getOverlapComputeSignal()
+        {
+        return m_overlap_compute_callbacks;
+        }
+
     //! Get the ghost communication flags
     CommFlags getFlags()
         {
@@ -312,14 +328,14 @@ class PYBIND11_EXPORT Communicator
     virtual void beginUpdateGhosts(uint64_t timestep);
 
     /*! Finish ghost update
+     *
+     * Waits for the messages posted by beginUpdateGhosts(). On the CPU, the exchange along each
+     * direction depends on the ghosts received along the previous ones, so only the last
+     * direction is left in flight.
      *
      * \param timestep The time step
      */
-    virtual void finishUpdateGhosts(uint64_t timestep)
-        {
-        // the base class implementation is currently empty
-        m_comm_pending = false;
-        }
+    virtual void finishUpdateGhosts(uint64_t timestep);
 
     /*! Communicate the net particle force
      * \parm timestep The time step
@@ -578,6 +594,9 @@ class PYBIND11_EXPORT Communicator
     Nano::Signal<void(uint64_t timestep)>
         m_compute_callbacks; //!< List of functions that are called after ghost communication
 
+    Nano::Signal<void(uint64_t timestep)>
+        m_overlap_compute_callbacks; //!< List of functions that are called during the ghost update
+
     Nano::Signal<void(const GlobalArray<unsigned int>&)>
         m_comm_callbacks; //!< List of functions that are called after the compute callbacks
 
@@ -588,6 +607,27 @@ class PYBIND11_EXPORT Communicator
     std::vector<MPI_Request> m_reqs; //!< Container for all MPI communication requests
     std::vector<MPI_Status> m_stats; //!< Container for all MPI communication statuses
 
+    unsigned int m_pending_ghost_dir = 0;   //!< Direction of the ghost update in process
+    unsigned int m_pending_ghost_start = 0; //!< First particle index of the ghosts in flight
+    unsigned int m_pending_ghost_num = 0;   //!< Number of ghosts in flight
+
+    /* Persistent ghost update */
+    bool m_ghost_update_reqs_valid = false;  //!< True when the persistent requests are set up
+    CommFlags m_ghost_update_flags;          //!< Fields packed in the ghost update buffers
+    unsigned int m_ghost_update_nfields = 0; //!< Number of Scalar4 fields per ghost
+    MPI_Request m_ghost_update_reqs[12];     //!< Send and receive request per direction
+    std::vector<Scalar4> m_ghost_update_sendbuf[6]; //!< Packed ghost fields sent per direction
+    std::vector<Scalar4> m_ghost_update_recvbuf[6]; //!< Packed ghost fields received per direction
+
+    //! Wait for the ghost update messages in process and unpack the received fields
+    void completeGhostDirection();
+
+    //! Create the persistent ghost update requests for the current ghost lists
+    void initGhostUpdateRequests(CommFlags flags);
+
+    //! Free the persistent ghost update requests
+    void freeGhostUpdateRequests();
+
     /* Bonds communication */
     bool m_bonds_changed; //!< True if bond information needs to be refreshed
     void setBondsChanged()
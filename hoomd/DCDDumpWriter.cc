@@ -150,10 +150,16 @@ void DCDDumpWriter::analyze(uint64_t timestep)
     if (m_prof)
         m_prof->push("Dump DCD");
 
-    // take particle data snapshot
-    SnapshotParticleData<Scalar> snapshot;
+    // take a snapshot of the fields written to the file
+    SnapshotFields fields;
+    fields.set(snapshot_field::position);
+    fields.set(snapshot_field::image);
+    if (m_unwrap_rigid)
+        fields.set(snapshot_field::body);
+    if (m_angle)
+        fields.set(snapshot_field::orientation);
 
-    m_pdata->takeSnapshot(snapshot);
+    m_pdata->takeSnapshot(m_snapshot, fields, m_snapshot_index);
 
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
@@ -198,7 +204,7 @@ void DCDDumpWriter::analyze(uint64_t timestep)
     // write the data for the current time step
     m_file.seekp(0, std::ios_base::end);
     write_frame_header(m_file);
-    write_frame_data(m_file, snapshot);
+    write_frame_data(m_file, m_snapshot, m_snapshot_index);
 
     // update the header with the number of frames written
     m_num_frames_written++;
@@ -319,10 +325,12 @@ void DCDDumpWriter::write_frame_header(std::fstream& file)
 
 /*! \param file File to write to
     \param snapshot Snapshot to write
+    \param index Snapshot index of each particle tag
     Writes the actual particle positions for all particles at the current time step
 */
 void DCDDumpWriter::write_frame_data(std::fstream& file,
-                                     const SnapshotParticleData<Scalar>& snapshot)
+                                     const SnapshotParticleData<Scalar>& snapshot,
+                                     const std::vector<unsigned int>& index)
     {
     // we need to unsort the positions and write in tag order
     assert(m_staging_buffer);
@@ -331,36 +339,36 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
 
     unsigned int nparticles = m_group->getNumMembersGlobal();
 
-    // Create a tmp copy of the particle data and unwrap particles
-    std::vector<vec3<Scalar>> tmp_pos(snapshot.pos);
-    for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
-        {
-        unsigned int i = m_group->getMemberTag(group_idx);
+    // position of a group member, unwrapped as requested
+    auto get_position = [&](unsigned int group_idx)
+    {
+        unsigned int i = index[m_group->getMemberTag(group_idx)];
+        vec3<Scalar> pos = snapshot.pos[i];
 
         if (m_unwrap_full)
             {
-            tmp_pos[i] = box.shift(tmp_pos[i], snapshot.image[i]);
+            pos = box.shift(pos, snapshot.image[i]);
             }
         else if (m_unwrap_rigid && snapshot.body[i] < MIN_FLOPPY)
             {
-            unsigned int central_ptl_tag = snapshot.body[i];
-            int body_ix = snapshot.image[central_ptl_tag].x;
-            int body_iy = snapshot.image[central_ptl_tag].y;
-            int body_iz = snapshot.image[central_ptl_tag].z;
+            unsigned int central_ptl = index[snapshot.body[i]];
+            int body_ix = snapshot.image[central_ptl].x;
+            int body_iy = snapshot.image[central_ptl].y;
+            int body_iz = snapshot.image[central_ptl].z;
             int3 particle_img = snapshot.image[i];
             int3 img_diff = make_int3(particle_img.x - body_ix,
                                       particle_img.y - body_iy,
                                       particle_img.z - body_iz);
 
-            tmp_pos[i] = box.shift(tmp_pos[i], img_diff);
+            pos = box.shift(pos, img_diff);
             }
-        }
+        return pos;
+    };
 
     // prepare x coords for writing, looping in tag order
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].x);
+        m_staging_buffer[group_idx] = float(get_position(group_idx).x);
         }
 
     // write x coords
@@ -371,8 +379,7 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
     // prepare y coords for writing
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].y);
+        m_staging_buffer[group_idx] = float(get_position(group_idx).y);
         }
 
     // write y coords
@@ -383,13 +390,13 @@ void DCDDumpWriter::write_frame_data(std::fstream& file,
     // prepare z coords for writing
     for (unsigned int group_idx = 0; group_idx < nparticles; group_idx++)
         {
-        unsigned int i = m_group->getMemberTag(group_idx);
-        m_staging_buffer[group_idx] = float(tmp_pos[i].z);
+        m_staging_buffer[group_idx] = float(get_position(group_idx).z);
 
         // m_angle set to True turns on a hack where the particle orientation angle is written out
         // to the z component this only works in 2D simulations, obviously
         if (m_angle)
             {
+            unsigned int i = index[m_group->getMemberTag(group_idx)];
             m_staging_buffer[group_idx]
                 = float(atan2(snapshot.orientation[i].v.z, snapshot.orientation[i].s) * 2);
             }
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 /*! \file DCDDumpWriter.h
     \brief Declares the DCDDumpWriter class
@@ -120,6 +121,9 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     float* m_staging_buffer; //!< Buffer for staging particle positions in tag order
     std::fstream m_file;     //!< The file object
 
+    SnapshotParticleData<Scalar> m_snapshot;    //!< Particle data snapshot, reused between frames
+    std::vector<unsigned int> m_snapshot_index; //!< Snapshot index of each particle tag
+
     // helper functions
 
     //! Initializes the file header
@@ -127,7 +131,9 @@ class PYBIND11_EXPORT DCDDumpWriter : public Analyzer
     //! Writes the frame header
     void write_frame_header(std::fstream& file);
     //! Writes the particle positions for a frame
-    void write_frame_data(std::fstream& file, const SnapshotParticleData<Scalar>& snapshot);
+    void write_frame_data(std::fstream& file,
+                          const SnapshotParticleData<Scalar>& snapshot,
+                          const std::vector<unsigned int>& index);
     //! Updates the file header
     void write_updated_header(std::fstream& file, uint64_t timestep);
     //! Initializes the output file for writing
@@ -26,7 +26,8 @@ namespace hoomd
     \post All forces are initialized to 0
 */
 ForceCompute::ForceCompute(std::shared_ptr<SystemDefinition> sysdef)
-    : Compute(sysdef), m_particles_sorted(false), m_buffers_writeable(false)
+    : Compute(sysdef), m_particles_sorted(false), m_compute_time(0.0), m_total_compute_time(0.0),
+      m_buffers_writeable(false)
     {
     assert(m_pdata);
     assert(m_pdata->getMaxN() > 0);
@@ -515,7 +516,10 @@ void ForceCompute::compute(uint64_t timestep)
     // flags do not match
     if (m_particles_sorted || shouldCompute(timestep) || m_pdata->getFlags() != m_computed_flags)
         {
+        ClockSource clock;
         computeForces(timestep);
+        m_compute_time = double(clock.getTime()) * 1e-9;
+        m_total_compute_time += m_compute_time;
         }
 
     m_particles_sorted = false;
@@ -670,6 +674,7 @@ void export_ForceCompute(pybind11::module& m)
         .def("getEnergy", &ForceCompute::getEnergy)
         .def("getExternalEnergy", &ForceCompute::getExternalEnergy)
         .def("getExternalVirial", &ForceCompute::getExternalVirial)
+        .def("getComputeTime", &ForceCompute::getComputeTime)
         .def("calcEnergySum", &ForceCompute::calcEnergySum)
         .def("getEnergies", &ForceCompute::getEnergiesPython)
         .def("getForces", &ForceCompute::getForcesPython)
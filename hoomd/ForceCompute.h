@@ -15,8 +15,14 @@
 #include "Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <vector>
 
 /*! \file ForceCompute.h
     \brief Declares the ForceCompute class
@@ -157,6 +163,28 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         return m_external_energy;
         }
 
+    //! Get the wall clock time of the last force computation in seconds
+    /*! On the GPU, this is the time needed to launch the kernels.
+     */
+    double getComputeTime() const
+        {
+        return m_compute_time;
+        }
+
+    //! Get the total wall clock time of all force computations in seconds
+    double getTotalComputeTime() const
+        {
+        return m_total_compute_time;
+        }
+
+    //! Returns true if computeForces() may perform MPI communication
+    /*! The compute time of these forces includes the time a rank waits for the other ranks.
+     */
+    virtual bool communicatesInCompute()
+        {
+        return false;
+        }
+
 #ifdef ENABLE_MPI
     //! Get requested ghost communication flags
     virtual CommFlags getRequestedCommFlags(uint64_t timestep)
@@ -176,6 +204,36 @@ class PYBIND11_EXPORT ForceCompute : public Compute
         return false;
         }
 
+    //! Returns true if computeForces may run concurrently with other force computes
+    /*! Integrator::computeNetForce computes these forces in parallel tasks, only on the CPU. Their
+        computeForces() must only read the particle data and write to the arrays of this force.
+        State that is updated lazily during computeForces() and shared with other forces must be
+        reported by getSharedState().
+    */
+    virtual bool canComputeConcurrently()
+        {
+        return false;
+        }
+
+    //! Get the state that this force shares with other force computes
+    /*! Concurrent forces that return the same pointer are computed one after another in the same
+        task. By default, a force shares no state.
+    */
+    virtual const void* getSharedState()
+        {
+        return this;
+        }
+
+    //! Estimate the cost of computing the force on the local particles
+    /*! LoadBalancer balances the sum of the costs of all forces when requested. The cost is in
+        arbitrary units of one particle interaction, and by default a force interacts once with
+        each local particle.
+    */
+    virtual double getLocalCost()
+        {
+        return double(m_pdata->getN());
+        }
+
     unsigned int getN() const
         {
         return m_pdata->getN();
@@ -228,6 +286,8 @@ class PYBIND11_EXPORT ForceCompute : public Compute
 
     Scalar m_external_virial[6]; //!< Stores external contribution to virial
     Scalar m_external_energy;    //!< Stores external contribution to potential energy
+    double m_compute_time;       //!< Wall clock time of the last call to computeForces()
+    double m_total_compute_time; //!< Sum of m_compute_time over all calls to computeForces()
 
     /// Store the particle data flags used during the last computation
     PDataFlags m_computed_flags;
@@ -235,14 +295,163 @@ class PYBIND11_EXPORT ForceCompute : public Compute
     // whether the local force buffers exposed by this class should be read-only
     bool m_buffers_writeable;
 
+#ifdef ENABLE_TBB
+    /// Per-thread force accumulators used by loopParticles()
+    tbb::enumerable_thread_specific<std::vector<Scalar4>> m_thread_force;
+
+    /// Per-thread virial accumulators used by loopParticles()
+    tbb::enumerable_thread_specific<std::vector<Scalar>> m_thread_virial;
+#endif
+
     //! Actually perform the computation of the forces
     /*! This is pure virtual here. Sub-classes must implement this function. It will be called by
         the base class compute() when the forces need to be computed.
         \param timestep Current time step
     */
     virtual void computeForces(uint64_t timestep) { }
+
+    //! Apply a force kernel to all local particles, in parallel when possible
+    template<class Kernel>
+    void loopParticles(bool third_law,
+                       bool compute_virial,
+                       ArrayHandle<Scalar4>& h_force,
+                       ArrayHandle<Scalar>& h_virial,
+                       const Kernel& kernel,
+                       bool ghost_forces = false)
+        {
+        loopParticles(m_pdata->getN(),
+                      third_law,
+                      compute_virial,
+                      h_force,
+                      h_virial,
+                      kernel,
+                      ghost_forces);
+        }
+
+    //! Apply a force kernel to n work items, in parallel when possible
+    template<class Kernel>
+    void loopParticles(unsigned int n,
+                       bool third_law,
+                       bool compute_virial,
+                       ArrayHandle<Scalar4>& h_force,
+                       ArrayHandle<Scalar>& h_virial,
+                       const Kernel& kernel,
+                       bool ghost_forces = false);
     };
 
+/*! \param n Number of work items, the local particles by default
+    \param third_law Set to true when \a kernel also applies forces to the neighbors of a particle
+    \param compute_virial Set to true when \a kernel accumulates the virial
+    \param h_force Force array to accumulate into
+    \param h_virial Virial array to accumulate into
+    \param kernel Callable as kernel(first, last, force, virial, virial_pitch) that adds the
+           contributions of work items [first, last) to \a force and \a virial
+    \param ghost_forces Set to true when \a kernel also applies forces to ghost particles
+
+    Without TBB, or with a single thread, \a kernel is called once on all work items.
+    Otherwise, the work items are split into blocks that are processed in the task arena. When
+    \a third_law is set, each thread accumulates into its own zeroed copy of the force and virial
+    arrays, which are summed into \a h_force and \a h_virial once all blocks complete. The copies
+    only cover the local particles unless \a ghost_forces is set.
+*/
+template<class Kernel>
+void ForceCompute::loopParticles(unsigned int n,
+                                 bool third_law,
+                                 bool compute_virial,
+                                 ArrayHandle<Scalar4>& h_force,
+                                 ArrayHandle<Scalar>& h_virial,
+                                 const Kernel& kernel,
+                                 bool ghost_forces)
+    {
+    const unsigned int N = m_pdata->getN();
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        if (!third_law)
+            {
+            // each thread only writes to the particles in its own block
+            m_exec_conf->getTaskArena()->execute(
+                [&]
+                {
+                    tbb::parallel_for(
+                        tbb::blocked_range<unsigned int>(0, n),
+                        [&](const tbb::blocked_range<unsigned int>& r)
+                        {
+                            kernel(r.begin(), r.end(), h_force.data, h_virial.data, m_virial_pitch);
+                        });
+                });
+            return;
+            }
+
+        // the particles that forces may be applied to
+        const unsigned int n_scatter = ghost_forces ? N + m_pdata->getNGhosts() : N;
+
+        // reset the buffers left over from the previous call
+        for (auto& thread_force : m_thread_force)
+            thread_force.assign(n_scatter, make_scalar4(0, 0, 0, 0));
+        for (auto& thread_virial : m_thread_virial)
+            thread_virial.assign(compute_virial ? 6 * size_t(n_scatter) : 0, Scalar(0.0));
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        // buffers are created on the first use by a new thread
+                        std::vector<Scalar4>& thread_force = m_thread_force.local();
+                        std::vector<Scalar>& thread_virial = m_thread_virial.local();
+                        if (thread_force.size() != n_scatter)
+                            thread_force.assign(n_scatter, make_scalar4(0, 0, 0, 0));
+                        if (compute_virial && thread_virial.size() != 6 * size_t(n_scatter))
+                            thread_virial.assign(6 * size_t(n_scatter), Scalar(0.0));
+
+                        kernel(r.begin(),
+                               r.end(),
+                               thread_force.data(),
+                               thread_virial.data(),
+                               n_scatter);
+                    });
+
+                // reduce the per-thread buffers into the output arrays
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, n_scatter),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    {
+                        for (const auto& thread_force : m_thread_force)
+                            {
+                            for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                {
+                                h_force.data[i].x += thread_force[i].x;
+                                h_force.data[i].y += thread_force[i].y;
+                                h_force.data[i].z += thread_force[i].z;
+                                h_force.data[i].w += thread_force[i].w;
+                                }
+                            }
+
+                        if (!compute_virial)
+                            return;
+
+                        for (const auto& thread_virial : m_thread_virial)
+                            {
+                            for (unsigned int l = 0; l < 6; ++l)
+                                {
+                                for (unsigned int i = r.begin(); i != r.end(); ++i)
+                                    h_virial.data[l * m_virial_pitch + i]
+                                        += thread_virial[l * size_t(n_scatter) + i];
+                                }
+                            }
+                    });
+            });
+        return;
+        }
+#endif
+
+    kernel(0, n, h_force.data, h_virial.data, m_virial_pitch);
+    }
+
 /** Make the local particle data available to python via zero-copy access
  *
  * */
@@ -21,6 +21,7 @@
 
 #include "ExecutionConfiguration.h"
 #include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -583,10 +584,16 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
         m_acquired = false;
         }
 
+    //! Release a host read of the data pointer
+    inline void releaseHostRead() const
+        {
+        m_n_host_readers--;
+        }
+
     //! Returns the acquire state
     inline bool isAcquired() const
         {
-        return m_acquired;
+        return m_acquired || m_n_host_readers > 0;
         }
 
     //! Need to be friend with dispatch
@@ -604,6 +611,8 @@ template<class T> class GPUArray : public GPUArrayBase<T, GPUArray<T>>
     size_t m_height;       //!< Number of allocated rows
 
     mutable bool m_acquired;                     //!< Tracks whether the data has been acquired
+    //! Number of host reads in progress, which may happen concurrently
+    mutable std::atomic<unsigned int> m_n_host_readers {0};
     mutable data_location::Enum m_data_location; //!< Tracks the current location of the data
 #ifdef ENABLE_HIP
     bool m_mapped; //!< True if we are using mapped memory
@@ -681,19 +690,23 @@ ArrayHandleAsync<T>::ArrayHandleAsync(const GPUArrayBase<T, Derived>& array,
 template<class T> class GPUArrayDispatch : public ArrayHandleDispatch<T>
     {
     public:
-    GPUArrayDispatch(T* const _data, const GPUArray<T>& _gpu_array)
-        : ArrayHandleDispatch<T>(_data), gpu_array(_gpu_array)
+    GPUArrayDispatch(T* const _data, const GPUArray<T>& _gpu_array, bool _host_read = false)
+        : ArrayHandleDispatch<T>(_data), gpu_array(_gpu_array), host_read(_host_read)
         {
         }
 
     virtual ~GPUArrayDispatch()
         {
         assert(gpu_array.isAcquired());
-        gpu_array.release();
+        if (host_read)
+            gpu_array.releaseHostRead();
+        else
+            gpu_array.release();
         }
 
     private:
     const GPUArray<T>& gpu_array;
+    bool host_read; //!< True when the acquisition is a counted host read
     };
 
 //******************************************
@@ -834,7 +847,7 @@ template<class T> GPUArray<T>& GPUArray<T>::operator=(const GPUArray& rhs) noexc
     if (this != &rhs) // protect against invalid self-assignment
         {
         // sanity check
-        assert(!m_acquired && !rhs.m_acquired);
+        assert(!isAcquired() && !rhs.isAcquired());
 
         // copy over basic elements
         m_num_elements = rhs.m_num_elements;
@@ -920,7 +933,7 @@ and assignment operator.
 template<class T> void GPUArray<T>::swap(GPUArray& from)
     {
     // this may work, but really shouldn't be done when acquired
-    assert(!m_acquired && !from.m_acquired);
+    assert(!isAcquired() && !from.isAcquired());
     assert(&from != this);
 
     std::swap(m_num_elements, from.m_num_elements);
@@ -1160,6 +1173,20 @@ ArrayHandleDispatch<T> GPUArray<T>::acquire(const access_location::Enum location
         {
         throw std::runtime_error("Cannot acquire access to array in use.");
         }
+
+    // host reads of data on the host do not move the data, so several threads may read the array
+    // at the same time; they are counted so that other acquisitions still detect the array in use
+    if (location == access_location::host && mode == access_mode::read
+        && m_data_location == data_location::host)
+        {
+        m_n_host_readers++;
+        return GPUArrayDispatch<T>(isNull() ? nullptr : h_data.get(), *this, true);
+        }
+
+    if (m_n_host_readers > 0)
+        {
+        throw std::runtime_error("Cannot acquire access to array in use.");
+        }
     m_acquired = true;
 
     // base case - handle acquiring a NULL GPUArray by simply returning NULL to prevent any memcpys
@@ -1562,7 +1589,7 @@ T* GPUArray<T>::resize2DDeviceArray(size_t pitch,
  */
 template<class T> void GPUArray<T>::resize(size_t num_elements)
     {
-    assert(!m_acquired);
+    assert(!isAcquired());
     assert(num_elements > 0);
 
     // if not allocated, simply allocate
@@ -1603,7 +1630,7 @@ template<class T> void GPUArray<T>::resize(size_t num_elements)
  */
 template<class T> void GPUArray<T>::resize(size_t width, size_t height)
     {
-    assert(!m_acquired);
+    assert(!isAcquired());
 
     // make m_pitch the next multiple of 16 larger or equal to the given width
     size_t new_pitch = (width + (16 - (width & 15)));
@@ -13,6 +13,7 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl_bind.h>
 
+#include <algorithm>
 #include <limits>
 #include <list>
 #include <sstream>
@@ -120,6 +121,7 @@ void GSDDumpWriter::initFileIO()
         throw std::invalid_argument("Invalid GSD file mode: " + m_mode);
         }
 
+    m_nframes = gsd_get_nframes(&m_handle);
     m_is_initialized = true;
     }
 
@@ -134,11 +136,204 @@ GSDDumpWriter::~GSDDumpWriter()
 
     if (root && m_is_initialized)
         {
+        // write any queued frames before closing the file
+        try
+            {
+            stopWriter();
+            }
+        catch (const std::exception& e)
+            {
+            m_exec_conf->msg->error() << "GSD: " << e.what() << endl;
+            }
+
         m_exec_conf->msg->notice(5) << "GSD: close gsd file " << m_fname << endl;
         gsd_close(&m_handle);
         }
     }
 
+/*! \param async When true, write frames on a background thread
+
+    Disabling asynchronous output writes all queued frames and stops the writer thread.
+*/
+void GSDDumpWriter::setAsync(bool async)
+    {
+    if (async && m_mpi_io)
+        {
+        throw std::invalid_argument("GSD: async_write cannot be combined with mpi_io");
+        }
+    if (!async)
+        stopWriter();
+    m_async = async;
+    }
+
+/*! \param mpi_io When true, write particle data collectively with MPI-IO in domain decomposed
+    simulations
+*/
+void GSDDumpWriter::setMPIIO(bool mpi_io)
+    {
+    if (mpi_io && m_async)
+        {
+        throw std::invalid_argument("GSD: mpi_io cannot be combined with async_write");
+        }
+    m_mpi_io = mpi_io;
+    }
+
+/*! \param queue_depth Maximum number of frames waiting to be written
+ */
+void GSDDumpWriter::setQueueDepth(unsigned int queue_depth)
+    {
+    if (queue_depth == 0)
+        {
+        throw std::invalid_argument("GSD: queue_depth must be positive");
+        }
+
+    std::lock_guard<std::mutex> lock(m_queue_mutex);
+    m_queue_depth = queue_depth;
+    }
+
+/*! Wait for the writer thread to write all queued frames. Rethrows any error raised while writing.
+ */
+void GSDDumpWriter::flush()
+    {
+    if (m_writer_thread.joinable())
+        waitForWriter();
+    }
+
+void GSDDumpWriter::waitForWriter()
+    {
+    std::unique_lock<std::mutex> lock(m_queue_mutex);
+    m_queue_cv.wait(lock, [this] { return m_queue.empty() && !m_writer_busy; });
+
+    if (m_writer_error)
+        {
+        std::exception_ptr error = m_writer_error;
+        m_writer_error = nullptr;
+        std::rethrow_exception(error);
+        }
+    }
+
+void GSDDumpWriter::stopWriter()
+    {
+    if (!m_writer_thread.joinable())
+        return;
+
+        {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        m_stop_writer = true;
+        }
+    m_queue_cv.notify_all();
+    m_writer_thread.join();
+    m_stop_writer = false;
+
+    if (m_writer_error)
+        {
+        std::exception_ptr error = m_writer_error;
+        m_writer_error = nullptr;
+        std::rethrow_exception(error);
+        }
+    }
+
+/*! The writer thread owns the file handle while frames are queued. It exits when asked to stop and
+    the queue is empty.
+*/
+void GSDDumpWriter::writerLoop()
+    {
+    while (true)
+        {
+        std::vector<PendingChunk> frame;
+            {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this] { return m_stop_writer || !m_queue.empty(); });
+            if (m_queue.empty())
+                return;
+
+            frame = std::move(m_queue.front());
+            m_queue.pop_front();
+            m_writer_busy = true;
+            }
+        // wake analyze() when it waits for space in the queue
+        m_queue_cv.notify_all();
+
+        try
+            {
+            for (const auto& chunk : frame)
+                {
+                int retval = gsd_write_chunk(&m_handle,
+                                             chunk.name.c_str(),
+                                             chunk.type,
+                                             chunk.N,
+                                             chunk.M,
+                                             0,
+                                             chunk.data);
+                GSDUtils::checkError(retval, m_fname);
+                }
+            int retval = gsd_end_frame(&m_handle);
+            GSDUtils::checkError(retval, m_fname);
+            }
+        catch (...)
+            {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_writer_error = std::current_exception();
+            }
+
+            {
+            std::lock_guard<std::mutex> lock(m_queue_mutex);
+            m_writer_busy = false;
+            }
+        m_queue_cv.notify_all();
+        }
+    }
+
+/*! \param name Chunk name
+    \param type Data type
+    \param N Number of rows
+    \param M Number of columns
+    \param data Chunk data
+*/
+void GSDDumpWriter::writeChunk(const char* name,
+                               gsd_type type,
+                               uint64_t N,
+                               uint32_t M,
+                               const void* data)
+    {
+    if (!m_async)
+        {
+        int retval = gsd_write_chunk(&m_handle, name, type, N, M, 0, data);
+        GSDUtils::checkError(retval, m_fname);
+        return;
+        }
+
+    size_t size = gsd_sizeof_type(type) * N * M;
+    auto owner = std::make_shared<std::vector<char>>(size);
+    if (size > 0)
+        memcpy(owner->data(), data, size);
+    m_frame.push_back(PendingChunk {name, type, N, M, owner, owner->data()});
+    }
+
+void GSDDumpWriter::endFrame()
+    {
+    if (!m_async)
+        {
+        int retval = gsd_end_frame(&m_handle);
+        GSDUtils::checkError(retval, m_fname);
+        }
+    else
+        {
+        if (!m_writer_thread.joinable())
+            m_writer_thread = std::thread(&GSDDumpWriter::writerLoop, this);
+
+            {
+            std::unique_lock<std::mutex> lock(m_queue_mutex);
+            m_queue_cv.wait(lock, [this] { return m_queue.size() < m_queue_depth; });
+            m_queue.push_back(std::move(m_frame));
+            }
+        m_queue_cv.notify_all();
+        m_frame.clear();
+        }
+
+    m_nframes++;
+    }
+
 /*! \param timestep Current time step of the simulation
 
     The first call to analyze() will create or overwrite the file and write out the current system
@@ -148,58 +343,113 @@ GSDDumpWriter::~GSDDumpWriter()
 void GSDDumpWriter::analyze(uint64_t timestep)
     {
     Analyzer::analyze(timestep);
-    int retval;
     bool root = true;
 
     if (m_prof)
         m_prof->push("Dump GSD");
 
-    // take particle data snapshot
-    m_exec_conf->msg->notice(10) << "GSD: taking particle data snapshot" << endl;
-    SnapshotParticleData<float> snapshot;
-    const std::map<unsigned int, unsigned int>& map = m_pdata->takeSnapshot<float>(snapshot);
-
+    bool collective = false;
 #ifdef ENABLE_MPI
     // if we are not the root processor, do not perform file I/O
     root = m_exec_conf->isRoot();
+
+    // collective writes access the local particle data directly
+    collective = m_mpi_io && m_sysdef->isDomainDecomposed();
 #endif
 
     // open the file if it is not yet opened
     if (!m_is_initialized && root)
         initFileIO();
 
+    // report errors from previously queued frames
+    m_frame.clear();
+    if (m_async && root)
+        {
+        std::lock_guard<std::mutex> lock(m_queue_mutex);
+        if (m_writer_error)
+            {
+            std::exception_ptr error = m_writer_error;
+            m_writer_error = nullptr;
+            std::rethrow_exception(error);
+            }
+        }
+
     // truncate the file if requested
     if (m_truncate && root)
         {
+        // the writer thread must finish with the file before truncating it
+        flush();
+
         m_exec_conf->msg->notice(10) << "GSD: truncating file" << endl;
-        retval = gsd_truncate(&m_handle);
+        int retval = gsd_truncate(&m_handle);
         GSDUtils::checkError(retval, m_fname);
+        m_nframes = 0;
         }
 
     uint64_t nframes = 0;
     if (root)
         {
-        nframes = gsd_get_nframes(&m_handle);
+        nframes = m_nframes;
         m_exec_conf->msg->notice(10)
             << "GSD: " << m_fname << " has " << nframes << " frames" << endl;
         }
 
 #ifdef ENABLE_MPI
     bcast(nframes, 0, m_exec_conf->getMPICommunicator());
+    m_nframes = nframes;
 #endif
 
-    if (root)
+    // take a snapshot of the fields written in this frame
+    if (!collective)
+        {
+        SnapshotFields fields;
+        if (m_write_attribute || nframes == 0)
+            {
+            fields.set(snapshot_field::type);
+            fields.set(snapshot_field::mass);
+            fields.set(snapshot_field::charge);
+            fields.set(snapshot_field::diameter);
+            fields.set(snapshot_field::body);
+            fields.set(snapshot_field::inertia);
+            }
+        if (m_write_property || nframes == 0)
+            {
+            fields.set(snapshot_field::position);
+            fields.set(snapshot_field::orientation);
+            }
+        if (m_write_momentum || nframes == 0)
+            {
+            fields.set(snapshot_field::velocity);
+            fields.set(snapshot_field::angmom);
+            fields.set(snapshot_field::image);
+            }
+
+        m_exec_conf->msg->notice(10) << "GSD: taking particle data snapshot" << endl;
+        m_pdata->takeSnapshot<float>(m_snapshot, fields, m_snapshot_index);
+        }
+
+#ifdef ENABLE_MPI
+    if (collective)
+        {
+        if (root)
+            writeFrameHeader(timestep);
+
+        writeLocalParticleData();
+        }
+    else
+#endif
+        if (root)
         {
         // write out the frame header on all frames
         writeFrameHeader(timestep);
 
         // only write out data chunk categories if requested, or if on frame 0
         if (m_write_attribute || nframes == 0)
-            writeAttributes(snapshot, map);
+            writeAttributes(m_snapshot, m_snapshot_index);
         if (m_write_property || nframes == 0)
-            writeProperties(snapshot, map);
+            writeProperties(m_snapshot, m_snapshot_index);
         if (m_write_momentum || nframes == 0)
-            writeMomenta(snapshot, map);
+            writeMomenta(m_snapshot, m_snapshot_index);
         }
 
     // topology is only meaningful if this is the all group
@@ -233,6 +483,11 @@ void GSDDumpWriter::analyze(uint64_t timestep)
                           pdata_snapshot);
         }
 
+    // slots write to the file handle directly, wait for the writer thread to finish the previous
+    // frames so that their chunks land in this frame
+    if (m_write_signal_requested && root)
+        flush();
+
     // emit on all ranks, the slot needs to handle the mpi logic.
     m_write_signal.emit(m_handle);
 
@@ -244,8 +499,7 @@ void GSDDumpWriter::analyze(uint64_t timestep)
     if (root)
         {
         m_exec_conf->msg->notice(10) << "GSD: ending frame" << endl;
-        retval = gsd_end_frame(&m_handle);
-        GSDUtils::checkError(retval, m_fname);
+        endFrame();
         }
 
     if (m_prof)
@@ -266,14 +520,7 @@ void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string>
         std::vector<char> types(max_len * type_mapping.size());
         for (unsigned int i = 0; i < type_mapping.size(); i++)
             strncpy(&types[max_len * i], type_mapping[i].c_str(), max_len);
-        int retval = gsd_write_chunk(&m_handle,
-                                     chunk.c_str(),
-                                     GSD_TYPE_UINT8,
-                                     type_mapping.size(),
-                                     max_len,
-                                     0,
-                                     (void*)&types[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk(chunk.c_str(), GSD_TYPE_UINT8, type_mapping.size(), max_len, std::move(types));
         }
     }
 
@@ -287,25 +534,15 @@ void GSDDumpWriter::writeTypeMapping(std::string chunk, std::vector<std::string>
 */
 void GSDDumpWriter::writeFrameHeader(uint64_t timestep)
     {
-    int retval;
     m_exec_conf->msg->notice(10) << "GSD: writing configuration/step" << endl;
     uint64_t step = timestep;
-    retval
-        = gsd_write_chunk(&m_handle, "configuration/step", GSD_TYPE_UINT64, 1, 1, 0, (void*)&step);
-    GSDUtils::checkError(retval, m_fname);
+    writeChunk("configuration/step", GSD_TYPE_UINT64, 1, 1, (const void*)&step);
 
-    if (gsd_get_nframes(&m_handle) == 0)
+    if (m_nframes == 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing configuration/dimensions" << endl;
         uint8_t dimensions = (uint8_t)m_sysdef->getNDimensions();
-        retval = gsd_write_chunk(&m_handle,
-                                 "configuration/dimensions",
-                                 GSD_TYPE_UINT8,
-                                 1,
-                                 1,
-                                 0,
-                                 (void*)&dimensions);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("configuration/dimensions", GSD_TYPE_UINT8, 1, 1, (const void*)&dimensions);
         }
 
     m_exec_conf->msg->notice(10) << "GSD: writing configuration/box" << endl;
@@ -317,13 +554,11 @@ void GSDDumpWriter::writeFrameHeader(uint64_t timestep)
     box_a[3] = (float)box.getTiltFactorXY();
     box_a[4] = (float)box.getTiltFactorXZ();
     box_a[5] = (float)box.getTiltFactorYZ();
-    retval = gsd_write_chunk(&m_handle, "configuration/box", GSD_TYPE_FLOAT, 6, 1, 0, (void*)box_a);
-    GSDUtils::checkError(retval, m_fname);
+    writeChunk("configuration/box", GSD_TYPE_FLOAT, 6, 1, (const void*)box_a);
 
     m_exec_conf->msg->notice(10) << "GSD: writing particles/N" << endl;
     uint32_t N = m_group->getNumMembersGlobal();
-    retval = gsd_write_chunk(&m_handle, "particles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-    GSDUtils::checkError(retval, m_fname);
+    writeChunk("particles/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
     }
 
 /*! \param snapshot particle data snapshot to write out to the file
@@ -332,11 +567,10 @@ void GSDDumpWriter::writeFrameHeader(uint64_t timestep)
    particles/.
 */
 void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
-                                    const std::map<unsigned int, unsigned int>& map)
+                                    const std::vector<unsigned int>& index)
     {
     uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-    uint64_t nframes = gsd_get_nframes(&m_handle);
+    uint64_t nframes = m_nframes;
 
     writeTypeMapping("particles/types", snapshot.type_mapping);
 
@@ -350,26 +584,19 @@ void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.type[it->second] != 0)
+            if (snapshot.type[snap_id] != 0)
                 all_default = false;
 
-            type[group_idx] = uint32_t(snapshot.type[it->second]);
+            type[group_idx] = uint32_t(snapshot.type[snap_id]);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/typeid"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/typeid" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/typeid",
-                                     GSD_TYPE_UINT32,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&type[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/typeid", GSD_TYPE_UINT32, N, 1, std::move(type));
             if (nframes == 0)
                 m_nondefault["particles/typeid"] = true;
             }
@@ -385,87 +612,68 @@ void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.mass[it->second] != float(1.0))
+            if (snapshot.mass[snap_id] != float(1.0))
                 all_default = false;
 
-            data[group_idx] = float(snapshot.mass[it->second]);
+            data[group_idx] = float(snapshot.mass[snap_id]);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/mass"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/mass" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/mass",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/mass", GSD_TYPE_FLOAT, N, 1, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/mass"] = true;
             }
 
         all_default = true;
+        data.resize(N);
 
         for (unsigned int group_idx = 0; group_idx < N; group_idx++)
             {
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.charge[it->second] != float(0.0))
+            if (snapshot.charge[snap_id] != float(0.0))
                 all_default = false;
-            data[group_idx] = float(snapshot.charge[it->second]);
+            data[group_idx] = float(snapshot.charge[snap_id]);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/charge"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/charge" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/charge",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/charge", GSD_TYPE_FLOAT, N, 1, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/charge"] = true;
             }
 
         all_default = true;
+        data.resize(N);
 
         for (unsigned int group_idx = 0; group_idx < N; group_idx++)
             {
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.diameter[it->second] != float(1.0))
+            if (snapshot.diameter[snap_id] != float(1.0))
                 all_default = false;
 
-            data[group_idx] = float(snapshot.diameter[it->second]);
+            data[group_idx] = float(snapshot.diameter[snap_id]);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/diameter"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/diameter" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/diameter",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/diameter", GSD_TYPE_FLOAT, N, 1, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/diameter"] = true;
             }
@@ -481,26 +689,19 @@ void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.body[it->second] != NO_BODY)
+            if (snapshot.body[snap_id] != NO_BODY)
                 all_default = false;
 
-            body[group_idx] = int32_t(snapshot.body[it->second]);
+            body[group_idx] = int32_t(snapshot.body[snap_id]);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/body"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/body" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/body",
-                                     GSD_TYPE_INT32,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&body[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/body", GSD_TYPE_INT32, N, 1, std::move(body));
             if (nframes == 0)
                 m_nondefault["particles/body"] = true;
             }
@@ -516,32 +717,25 @@ void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.inertia[it->second].x != float(0.0)
-                || snapshot.inertia[it->second].y != float(0.0)
-                || snapshot.inertia[it->second].z != float(0.0))
+            if (snapshot.inertia[snap_id].x != float(0.0)
+                || snapshot.inertia[snap_id].y != float(0.0)
+                || snapshot.inertia[snap_id].z != float(0.0))
                 {
                 all_default = false;
                 }
 
-            data[group_idx * 3 + 0] = float(snapshot.inertia[it->second].x);
-            data[group_idx * 3 + 1] = float(snapshot.inertia[it->second].y);
-            data[group_idx * 3 + 2] = float(snapshot.inertia[it->second].z);
+            data[group_idx * 3 + 0] = float(snapshot.inertia[snap_id].x);
+            data[group_idx * 3 + 1] = float(snapshot.inertia[snap_id].y);
+            data[group_idx * 3 + 2] = float(snapshot.inertia[snap_id].z);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/moment_inertia"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/moment_inertia" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/moment_inertia",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     3,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/moment_inertia", GSD_TYPE_FLOAT, N, 3, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/moment_inertia"] = true;
             }
@@ -553,11 +747,10 @@ void GSDDumpWriter::writeAttributes(const SnapshotParticleData<float>& snapshot,
     Writes the data chunks position and orientation in particles/.
 */
 void GSDDumpWriter::writeProperties(const SnapshotParticleData<float>& snapshot,
-                                    const std::map<unsigned int, unsigned int>& map)
+                                    const std::vector<unsigned int>& index)
     {
     uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-    uint64_t nframes = gsd_get_nframes(&m_handle);
+    uint64_t nframes = m_nframes;
 
         {
         std::vector<float> data(uint64_t(N) * 3);
@@ -568,23 +761,16 @@ void GSDDumpWriter::writeProperties(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            data[group_idx * 3 + 0] = float(snapshot.pos[it->second].x);
-            data[group_idx * 3 + 1] = float(snapshot.pos[it->second].y);
-            data[group_idx * 3 + 2] = float(snapshot.pos[it->second].z);
+            data[group_idx * 3 + 0] = float(snapshot.pos[snap_id].x);
+            data[group_idx * 3 + 1] = float(snapshot.pos[snap_id].y);
+            data[group_idx * 3 + 2] = float(snapshot.pos[snap_id].z);
             }
 
         m_exec_conf->msg->notice(10) << "GSD: writing particles/position" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "particles/position",
-                                 GSD_TYPE_FLOAT,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)&data[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("particles/position", GSD_TYPE_FLOAT, N, 3, std::move(data));
         }
 
         {
@@ -597,34 +783,27 @@ void GSDDumpWriter::writeProperties(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.orientation[it->second].s != float(1.0)
-                || snapshot.orientation[it->second].v.x != float(0.0)
-                || snapshot.orientation[it->second].v.y != float(0.0)
-                || snapshot.orientation[it->second].v.z != float(0.0))
+            if (snapshot.orientation[snap_id].s != float(1.0)
+                || snapshot.orientation[snap_id].v.x != float(0.0)
+                || snapshot.orientation[snap_id].v.y != float(0.0)
+                || snapshot.orientation[snap_id].v.z != float(0.0))
                 {
                 all_default = false;
                 }
 
-            data[group_idx * 4 + 0] = float(snapshot.orientation[it->second].s);
-            data[group_idx * 4 + 1] = float(snapshot.orientation[it->second].v.x);
-            data[group_idx * 4 + 2] = float(snapshot.orientation[it->second].v.y);
-            data[group_idx * 4 + 3] = float(snapshot.orientation[it->second].v.z);
+            data[group_idx * 4 + 0] = float(snapshot.orientation[snap_id].s);
+            data[group_idx * 4 + 1] = float(snapshot.orientation[snap_id].v.x);
+            data[group_idx * 4 + 2] = float(snapshot.orientation[snap_id].v.y);
+            data[group_idx * 4 + 3] = float(snapshot.orientation[snap_id].v.z);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/orientation"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/orientation" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/orientation",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     4,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/orientation", GSD_TYPE_FLOAT, N, 4, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/orientation"] = true;
             }
@@ -636,11 +815,10 @@ void GSDDumpWriter::writeProperties(const SnapshotParticleData<float>& snapshot,
     Writes the data chunks velocity, angmom, and image in particles/.
 */
 void GSDDumpWriter::writeMomenta(const SnapshotParticleData<float>& snapshot,
-                                 const std::map<unsigned int, unsigned int>& map)
+                                 const std::vector<unsigned int>& index)
     {
     uint32_t N = m_group->getNumMembersGlobal();
-    int retval;
-    uint64_t nframes = gsd_get_nframes(&m_handle);
+    uint64_t nframes = m_nframes;
 
         {
         std::vector<float> data(uint64_t(N) * 3);
@@ -652,31 +830,24 @@ void GSDDumpWriter::writeMomenta(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.vel[it->second].x != float(0.0) || snapshot.vel[it->second].y != float(0.0)
-                || snapshot.vel[it->second].z != float(0.0))
+            if (snapshot.vel[snap_id].x != float(0.0) || snapshot.vel[snap_id].y != float(0.0)
+                || snapshot.vel[snap_id].z != float(0.0))
                 {
                 all_default = false;
                 }
 
-            data[group_idx * 3 + 0] = float(snapshot.vel[it->second].x);
-            data[group_idx * 3 + 1] = float(snapshot.vel[it->second].y);
-            data[group_idx * 3 + 2] = float(snapshot.vel[it->second].z);
+            data[group_idx * 3 + 0] = float(snapshot.vel[snap_id].x);
+            data[group_idx * 3 + 1] = float(snapshot.vel[snap_id].y);
+            data[group_idx * 3 + 2] = float(snapshot.vel[snap_id].z);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/velocity"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/velocity" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/velocity",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     3,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/velocity", GSD_TYPE_FLOAT, N, 3, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/velocity"] = true;
             }
@@ -692,34 +863,27 @@ void GSDDumpWriter::writeMomenta(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.angmom[it->second].s != float(0.0)
-                || snapshot.angmom[it->second].v.x != float(0.0)
-                || snapshot.angmom[it->second].v.y != float(0.0)
-                || snapshot.angmom[it->second].v.z != float(0.0))
+            if (snapshot.angmom[snap_id].s != float(0.0)
+                || snapshot.angmom[snap_id].v.x != float(0.0)
+                || snapshot.angmom[snap_id].v.y != float(0.0)
+                || snapshot.angmom[snap_id].v.z != float(0.0))
                 {
                 all_default = false;
                 }
 
-            data[group_idx * 4 + 0] = float(snapshot.angmom[it->second].s);
-            data[group_idx * 4 + 1] = float(snapshot.angmom[it->second].v.x);
-            data[group_idx * 4 + 2] = float(snapshot.angmom[it->second].v.y);
-            data[group_idx * 4 + 3] = float(snapshot.angmom[it->second].v.z);
+            data[group_idx * 4 + 0] = float(snapshot.angmom[snap_id].s);
+            data[group_idx * 4 + 1] = float(snapshot.angmom[snap_id].v.x);
+            data[group_idx * 4 + 2] = float(snapshot.angmom[snap_id].v.y);
+            data[group_idx * 4 + 3] = float(snapshot.angmom[snap_id].v.z);
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/angmom"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/angmom" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/angmom",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     4,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/angmom", GSD_TYPE_FLOAT, N, 4, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/angmom"] = true;
             }
@@ -735,37 +899,345 @@ void GSDDumpWriter::writeMomenta(const SnapshotParticleData<float>& snapshot,
             unsigned int t = m_group->getMemberTag(group_idx);
 
             // look up tag in snapshot
-            auto it = map.find(t);
-            assert(it != map.end());
+            unsigned int snap_id = index[t];
+            assert(snap_id != NOT_LOCAL);
 
-            if (snapshot.image[it->second].x != 0 || snapshot.image[it->second].y != 0
-                || snapshot.image[it->second].z != 0)
+            if (snapshot.image[snap_id].x != 0 || snapshot.image[snap_id].y != 0
+                || snapshot.image[snap_id].z != 0)
                 {
                 all_default = false;
                 }
 
-            data[group_idx * 3 + 0] = snapshot.image[it->second].x;
-            data[group_idx * 3 + 1] = snapshot.image[it->second].y;
-            data[group_idx * 3 + 2] = snapshot.image[it->second].z;
+            data[group_idx * 3 + 0] = snapshot.image[snap_id].x;
+            data[group_idx * 3 + 1] = snapshot.image[snap_id].y;
+            data[group_idx * 3 + 2] = snapshot.image[snap_id].z;
             }
 
         if (!all_default || (nframes > 0 && m_nondefault["particles/image"]))
             {
             m_exec_conf->msg->notice(10) << "GSD: writing particles/image" << endl;
-            retval = gsd_write_chunk(&m_handle,
-                                     "particles/image",
-                                     GSD_TYPE_INT32,
-                                     N,
-                                     3,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("particles/image", GSD_TYPE_INT32, N, 3, std::move(data));
             if (nframes == 0)
                 m_nondefault["particles/image"] = true;
             }
         }
     }
 
+#ifdef ENABLE_MPI
+/*! Determine the row in the file of every local group member. Rows are the positions of the member
+    tags in the sorted global member list. The local members are sorted by row so that every rank
+    writes a monotonically increasing set of rows.
+*/
+void GSDDumpWriter::findLocalRows()
+    {
+    const GlobalArray<unsigned int>& member_tags = m_group->getMemberTagArray();
+    const GlobalArray<unsigned int>& member_idx = m_group->getIndexArray();
+    unsigned int n_local = m_group->getNumMembers();
+    unsigned int n_global = m_group->getNumMembersGlobal();
+
+    ArrayHandle<unsigned int> h_member_tags(member_tags, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_member_idx(member_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_tag(m_pdata->getTags(), access_location::host, access_mode::read);
+
+    std::vector<std::pair<int, unsigned int>> rows(n_local);
+    for (unsigned int j = 0; j < n_local; j++)
+        {
+        unsigned int idx = h_member_idx.data[j];
+        unsigned int tag = h_tag.data[idx];
+        const unsigned int* row
+            = std::lower_bound(h_member_tags.data, h_member_tags.data + n_global, tag);
+        assert(row != h_member_tags.data + n_global && *row == tag);
+        rows[j] = std::make_pair(int(row - h_member_tags.data), idx);
+        }
+    std::sort(rows.begin(), rows.end());
+
+    m_local_rows.resize(n_local);
+    m_local_idx.resize(n_local);
+    for (unsigned int j = 0; j < n_local; j++)
+        {
+        m_local_rows[j] = rows[j].first;
+        m_local_idx[j] = rows[j].second;
+        }
+    }
+
+/*! \param name Chunk name
+    \param type Data type
+    \param M Number of columns
+    \param data Rows of the local group members, in the order of m_local_rows
+    \param local_default True when all local rows have the default value
+    \param skip_default When true, skip the chunk when all rows on all ranks are default and frame 0
+           does not store it
+
+    Must be called on all ranks. The root rank decides whether to skip the chunk, because only
+    the root rank reads the chunks of frame 0 when appending to a file.
+*/
+template<class T>
+void GSDDumpWriter::writeLocalChunk(const char* name,
+                                    gsd_type type,
+                                    uint32_t M,
+                                    const std::vector<T>& data,
+                                    bool local_default,
+                                    bool skip_default)
+    {
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    assert(data.size() == m_local_rows.size() * M);
+
+    if (skip_default)
+        {
+        int all_default = local_default;
+        MPI_Allreduce(MPI_IN_PLACE, &all_default, 1, MPI_INT, MPI_LAND, mpi_comm);
+
+        // only the root rank knows which chunks are in frame 0 of an appended file
+        int skip = all_default && !(m_nframes > 0 && m_nondefault[name]);
+        bcast(skip, 0, mpi_comm);
+        if (skip)
+            return;
+        if (m_nframes == 0)
+            m_nondefault[name] = true;
+        }
+
+    // the root rank reserves space for the chunk and tells the other ranks where it is
+    m_exec_conf->msg->notice(10) << "GSD: writing " << name << " collectively" << endl;
+    int retval = GSD_SUCCESS;
+    int64_t location = 0;
+    if (m_exec_conf->isRoot())
+        {
+        retval = gsd_reserve_chunk(&m_handle,
+                                   name,
+                                   type,
+                                   m_group->getNumMembersGlobal(),
+                                   M,
+                                   0,
+                                   &location);
+        }
+    bcast(retval, 0, mpi_comm);
+    GSDUtils::checkError(retval, m_fname);
+    bcast(location, 0, mpi_comm);
+
+    // each rank writes its rows into the reserved space
+    MPI_Datatype row_type, file_type;
+    MPI_Type_contiguous(int(sizeof(T) * M), MPI_BYTE, &row_type);
+    MPI_Type_create_indexed_block(int(m_local_rows.size()),
+                                  1,
+                                  m_local_rows.data(),
+                                  row_type,
+                                  &file_type);
+    MPI_Type_commit(&file_type);
+
+    MPI_File_set_view(m_mpi_file, location, MPI_BYTE, file_type, "native", MPI_INFO_NULL);
+    int mpi_retval = MPI_File_write_all(m_mpi_file,
+                                        data.data(),
+                                        int(data.size() * sizeof(T)),
+                                        MPI_BYTE,
+                                        MPI_STATUS_IGNORE);
+
+    MPI_Type_free(&file_type);
+    MPI_Type_free(&row_type);
+
+    if (mpi_retval != MPI_SUCCESS)
+        {
+        throw std::runtime_error("GSD: error writing " + std::string(name) + " to " + m_fname);
+        }
+    }
+
+/*! Write the attribute, property, and momentum chunks of the current frame without gathering the
+    particle data. Must be called on all ranks.
+*/
+void GSDDumpWriter::writeLocalParticleData()
+    {
+    const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
+    bool root = m_exec_conf->isRoot();
+    uint64_t nframes = m_nframes;
+    bool write_attribute = m_write_attribute || nframes == 0;
+    bool write_property = m_write_property || nframes == 0;
+    bool write_momentum = m_write_momentum || nframes == 0;
+
+    findLocalRows();
+    unsigned int n = (unsigned int)m_local_idx.size();
+
+    // the root rank created the file before the frame count was broadcast
+    MPI_Info info;
+    MPI_Info_create(&info);
+    if (m_mpi_io_writers > 0)
+        MPI_Info_set(info, (char*)"cb_nodes", (char*)std::to_string(m_mpi_io_writers).c_str());
+    int mpi_retval = MPI_File_open(mpi_comm,
+                                   (char*)m_fname.c_str(),
+                                   MPI_MODE_WRONLY,
+                                   info,
+                                   &m_mpi_file);
+    MPI_Info_free(&info);
+    if (mpi_retval != MPI_SUCCESS)
+        {
+        throw std::runtime_error("GSD: unable to open " + m_fname + " with MPI-IO");
+        }
+
+    if (write_attribute)
+        {
+        if (root)
+            {
+            std::vector<std::string> type_mapping;
+            for (unsigned int i = 0; i < m_pdata->getNTypes(); i++)
+                type_mapping.push_back(m_pdata->getNameByType(i));
+            writeTypeMapping("particles/types", type_mapping);
+            }
+
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar> h_charge(m_pdata->getCharges(),
+                                     access_location::host,
+                                     access_mode::read);
+        ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                       access_location::host,
+                                       access_mode::read);
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        ArrayHandle<Scalar3> h_inertia(m_pdata->getMomentsOfInertiaArray(),
+                                       access_location::host,
+                                       access_mode::read);
+
+        std::vector<uint32_t> type(n);
+        std::vector<float> mass(n), charge(n), diameter(n), inertia(uint64_t(n) * 3);
+        std::vector<int32_t> body(n);
+        bool type_default = true, mass_default = true, charge_default = true;
+        bool diameter_default = true, body_default = true, inertia_default = true;
+        for (unsigned int j = 0; j < n; j++)
+            {
+            unsigned int idx = m_local_idx[j];
+            type[j] = uint32_t(__scalar_as_int(h_pos.data[idx].w));
+            mass[j] = float(h_vel.data[idx].w);
+            charge[j] = float(h_charge.data[idx]);
+            diameter[j] = float(h_diameter.data[idx]);
+            body[j] = int32_t(h_body.data[idx]);
+            inertia[j * 3 + 0] = float(h_inertia.data[idx].x);
+            inertia[j * 3 + 1] = float(h_inertia.data[idx].y);
+            inertia[j * 3 + 2] = float(h_inertia.data[idx].z);
+
+            type_default = type_default && type[j] == 0;
+            mass_default = mass_default && mass[j] == float(1.0);
+            charge_default = charge_default && charge[j] == float(0.0);
+            diameter_default = diameter_default && diameter[j] == float(1.0);
+            body_default = body_default && h_body.data[idx] == NO_BODY;
+            inertia_default = inertia_default && inertia[j * 3 + 0] == float(0.0)
+                              && inertia[j * 3 + 1] == float(0.0)
+                              && inertia[j * 3 + 2] == float(0.0);
+            }
+
+        writeLocalChunk("particles/typeid", GSD_TYPE_UINT32, 1, type, type_default, true);
+        writeLocalChunk("particles/mass", GSD_TYPE_FLOAT, 1, mass, mass_default, true);
+        writeLocalChunk("particles/charge", GSD_TYPE_FLOAT, 1, charge, charge_default, true);
+        writeLocalChunk("particles/diameter", GSD_TYPE_FLOAT, 1, diameter, diameter_default, true);
+        writeLocalChunk("particles/body", GSD_TYPE_INT32, 1, body, body_default, true);
+        writeLocalChunk("particles/moment_inertia",
+                        GSD_TYPE_FLOAT,
+                        3,
+                        inertia,
+                        inertia_default,
+                        true);
+        }
+
+    if (write_property || write_momentum)
+        {
+        ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(),
+                                           access_location::host,
+                                           access_mode::read);
+        ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(),
+                                   access_location::host,
+                                   access_mode::read);
+        ArrayHandle<Scalar4> h_angmom(m_pdata->getAngularMomentumArray(),
+                                      access_location::host,
+                                      access_mode::read);
+        ArrayHandle<int3> h_image(m_pdata->getImages(), access_location::host, access_mode::read);
+
+        const BoxDim& global_box = m_pdata->getGlobalBox();
+        Scalar3 origin = m_pdata->getOrigin();
+        int3 origin_image = m_pdata->getOriginImage();
+
+        std::vector<float> position(uint64_t(n) * 3), orientation(uint64_t(n) * 4);
+        std::vector<float> velocity(uint64_t(n) * 3), angmom(uint64_t(n) * 4);
+        std::vector<int32_t> image(uint64_t(n) * 3);
+        bool orientation_default = true, velocity_default = true, angmom_default = true;
+        bool image_default = true;
+        for (unsigned int j = 0; j < n; j++)
+            {
+            unsigned int idx = m_local_idx[j];
+
+            // same conversion as ParticleData::takeSnapshot()
+            Scalar3 pos = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z)
+                          - origin;
+            int3 img = h_image.data[idx];
+            img.x -= origin_image.x;
+            img.y -= origin_image.y;
+            img.z -= origin_image.z;
+            global_box.wrap(pos, img);
+
+            position[j * 3 + 0] = float(pos.x);
+            position[j * 3 + 1] = float(pos.y);
+            position[j * 3 + 2] = float(pos.z);
+            image[j * 3 + 0] = img.x;
+            image[j * 3 + 1] = img.y;
+            image[j * 3 + 2] = img.z;
+            orientation[j * 4 + 0] = float(h_orientation.data[idx].x);
+            orientation[j * 4 + 1] = float(h_orientation.data[idx].y);
+            orientation[j * 4 + 2] = float(h_orientation.data[idx].z);
+            orientation[j * 4 + 3] = float(h_orientation.data[idx].w);
+            velocity[j * 3 + 0] = float(h_vel.data[idx].x);
+            velocity[j * 3 + 1] = float(h_vel.data[idx].y);
+            velocity[j * 3 + 2] = float(h_vel.data[idx].z);
+            angmom[j * 4 + 0] = float(h_angmom.data[idx].x);
+            angmom[j * 4 + 1] = float(h_angmom.data[idx].y);
+            angmom[j * 4 + 2] = float(h_angmom.data[idx].z);
+            angmom[j * 4 + 3] = float(h_angmom.data[idx].w);
+
+            orientation_default = orientation_default && orientation[j * 4 + 0] == float(1.0)
+                                  && orientation[j * 4 + 1] == float(0.0)
+                                  && orientation[j * 4 + 2] == float(0.0)
+                                  && orientation[j * 4 + 3] == float(0.0);
+            velocity_default = velocity_default && velocity[j * 3 + 0] == float(0.0)
+                               && velocity[j * 3 + 1] == float(0.0)
+                               && velocity[j * 3 + 2] == float(0.0);
+            angmom_default = angmom_default && angmom[j * 4 + 0] == float(0.0)
+                             && angmom[j * 4 + 1] == float(0.0) && angmom[j * 4 + 2] == float(0.0)
+                             && angmom[j * 4 + 3] == float(0.0);
+            image_default = image_default && img.x == 0 && img.y == 0 && img.z == 0;
+            }
+
+        if (write_property)
+            {
+            writeLocalChunk("particles/position", GSD_TYPE_FLOAT, 3, position, false, false);
+            writeLocalChunk("particles/orientation",
+                            GSD_TYPE_FLOAT,
+                            4,
+                            orientation,
+                            orientation_default,
+                            true);
+            }
+        if (write_momentum)
+            {
+            writeLocalChunk("particles/velocity",
+                            GSD_TYPE_FLOAT,
+                            3,
+                            velocity,
+                            velocity_default,
+                            true);
+            writeLocalChunk("particles/angmom", GSD_TYPE_FLOAT, 4, angmom, angmom_default, true);
+            writeLocalChunk("particles/image", GSD_TYPE_INT32, 3, image, image_default, true);
+            }
+        }
+
+    // all ranks must finish writing the data before the root rank writes the frame index
+    MPI_File_close(&m_mpi_file);
+    MPI_Barrier(mpi_comm);
+    }
+#endif
+
 /*! \param bond Bond data snapshot
     \param angle Angle data snapshot
     \param dihedral Dihedral data snapshot
@@ -786,126 +1258,64 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
         {
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/N" << endl;
         uint32_t N = bond.size;
-        int retval = gsd_write_chunk(&m_handle, "bonds/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("bonds/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         writeTypeMapping("bonds/types", bond.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "bonds/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&bond.type_id[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("bonds/typeid", GSD_TYPE_UINT32, N, 1, std::move(bond.type_id));
 
         m_exec_conf->msg->notice(10) << "GSD: writing bonds/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "bonds/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&bond.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("bonds/group", GSD_TYPE_UINT32, N, 2, std::move(bond.groups));
         }
     if (angle.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing angles/N" << endl;
         uint32_t N = angle.size;
-        int retval = gsd_write_chunk(&m_handle, "angles/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("angles/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         writeTypeMapping("angles/types", angle.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing angles/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "angles/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&angle.type_id[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("angles/typeid", GSD_TYPE_UINT32, N, 1, std::move(angle.type_id));
 
         m_exec_conf->msg->notice(10) << "GSD: writing angles/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "angles/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 3,
-                                 0,
-                                 (void*)&angle.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("angles/group", GSD_TYPE_UINT32, N, 3, std::move(angle.groups));
         }
     if (dihedral.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/N" << endl;
         uint32_t N = dihedral.size;
-        int retval = gsd_write_chunk(&m_handle, "dihedrals/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("dihedrals/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         writeTypeMapping("dihedrals/types", dihedral.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "dihedrals/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&dihedral.type_id[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("dihedrals/typeid", GSD_TYPE_UINT32, N, 1, std::move(dihedral.type_id));
 
         m_exec_conf->msg->notice(10) << "GSD: writing dihedrals/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "dihedrals/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)&dihedral.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("dihedrals/group", GSD_TYPE_UINT32, N, 4, std::move(dihedral.groups));
         }
     if (improper.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/N" << endl;
         uint32_t N = improper.size;
-        int retval = gsd_write_chunk(&m_handle, "impropers/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("impropers/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         writeTypeMapping("impropers/types", improper.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "impropers/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&improper.type_id[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("impropers/typeid", GSD_TYPE_UINT32, N, 1, std::move(improper.type_id));
 
         m_exec_conf->msg->notice(10) << "GSD: writing impropers/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "impropers/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 4,
-                                 0,
-                                 (void*)&improper.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("impropers/group", GSD_TYPE_UINT32, N, 4, std::move(improper.groups));
         }
 
     if (constraint.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/N" << endl;
         uint32_t N = constraint.size;
-        int retval
-            = gsd_write_chunk(&m_handle, "constraints/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("constraints/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/value" << endl;
             {
@@ -914,55 +1324,26 @@ void GSDDumpWriter::writeTopology(BondData::Snapshot& bond,
             for (unsigned int i = 0; i < N; i++)
                 data[i] = float(constraint.val[i]);
 
-            retval = gsd_write_chunk(&m_handle,
-                                     "constraints/value",
-                                     GSD_TYPE_FLOAT,
-                                     N,
-                                     1,
-                                     0,
-                                     (void*)&data[0]);
-            GSDUtils::checkError(retval, m_fname);
+            writeChunk("constraints/value", GSD_TYPE_FLOAT, N, 1, std::move(data));
             }
 
         m_exec_conf->msg->notice(10) << "GSD: writing constraints/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "constraints/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&constraint.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("constraints/group", GSD_TYPE_UINT32, N, 2, std::move(constraint.groups));
         }
 
     if (pair.size > 0)
         {
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/N" << endl;
         uint32_t N = pair.size;
-        int retval = gsd_write_chunk(&m_handle, "pairs/N", GSD_TYPE_UINT32, 1, 1, 0, (void*)&N);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("pairs/N", GSD_TYPE_UINT32, 1, 1, (const void*)&N);
 
         writeTypeMapping("pairs/types", pair.type_mapping);
 
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/typeid" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "pairs/typeid",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 1,
-                                 0,
-                                 (void*)&pair.type_id[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("pairs/typeid", GSD_TYPE_UINT32, N, 1, std::move(pair.type_id));
 
         m_exec_conf->msg->notice(10) << "GSD: writing pairs/group" << endl;
-        retval = gsd_write_chunk(&m_handle,
-                                 "pairs/group",
-                                 GSD_TYPE_UINT32,
-                                 N,
-                                 2,
-                                 0,
-                                 (void*)&pair.groups[0]);
-        GSDUtils::checkError(retval, m_fname);
+        writeChunk("pairs/group", GSD_TYPE_UINT32, N, 2, std::move(pair.groups));
         }
     }
 
@@ -1062,14 +1443,8 @@ void GSDDumpWriter::writeLogQuantities(pybind11::dict dict)
                 throw invalid_argument("Invalid numpy dimension in gsd log data [" + name + "]");
                 }
 
-            int retval = gsd_write_chunk(&m_handle,
-                                         name.c_str(),
-                                         type,
-                                         N,
-                                         (uint32_t)M,
-                                         0,
-                                         (void*)arr.data());
-            GSDUtils::checkError(retval, m_fname);
+            // the array is copied when writing asynchronously
+            writeChunk(name.c_str(), type, N, (uint32_t)M, arr.data());
             }
         }
     }
@@ -1129,6 +1504,13 @@ void export_GSDDumpWriter(pybind11::module& m)
         .def("setWriteMomentum", &GSDDumpWriter::setWriteMomentum)
         .def("setWriteTopology", &GSDDumpWriter::setWriteTopology)
         .def("writeLogQuantities", &GSDDumpWriter::writeLogQuantities)
+        .def("flush", &GSDDumpWriter::flush)
+        .def_property("async_write", &GSDDumpWriter::getAsync, &GSDDumpWriter::setAsync)
+        .def_property("queue_depth", &GSDDumpWriter::getQueueDepth, &GSDDumpWriter::setQueueDepth)
+        .def_property("mpi_io", &GSDDumpWriter::getMPIIO, &GSDDumpWriter::setMPIIO)
+        .def_property("mpi_io_writers",
+                      &GSDDumpWriter::getMPIIOWriters,
+                      &GSDDumpWriter::setMPIIOWriters)
         .def_property("log_writer", &GSDDumpWriter::getLogWriter, &GSDDumpWriter::setLogWriter)
         .def_property_readonly("filename", &GSDDumpWriter::getFilename)
         .def_property_readonly("mode", &GSDDumpWriter::getMode)
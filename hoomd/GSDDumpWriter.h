@@ -8,8 +8,14 @@
 #include "SharedSignal.h"
 
 #include "hoomd/extern/gsd.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 /*! \file GSDDumpWriter.h
     \brief Declares the GSDDumpWriter class
@@ -30,6 +36,23 @@ namespace hoomd
 
     The file is not opened until the first call to analyze().
 
+    <b>Asynchronous output:</b> When async is enabled, analyze() gathers the frame on the calling
+    thread and hands the chunk buffers to a background thread that performs the gsd_write_chunk()
+    and gsd_end_frame() calls while the simulation continues. At most queue_depth frames wait to be
+    written; analyze() blocks when the queue is full. Log quantities written by the log writer are
+    buffered with the frame they belong to. Slots connected to the write signal write directly to
+    the file handle, so analyze() waits for the previously queued frames to finish before emitting
+    it. flush() waits for all queued frames and is called at the end of every run.
+
+    <b>Collective output:</b> When mpi_io is enabled in a domain decomposed simulation, analyze()
+    does not gather the particle data to the root rank. The root rank reserves space for each
+    per-particle chunk in the file (gsd_reserve_chunk()) and every rank writes the rows of its local
+    group members directly to their place in the chunk with collective MPI-IO. The resulting file is
+    a standard GSD file. mpi_io_writers sets the number of aggregator ranks that perform the file
+    system writes (the cb_nodes hint, 0 selects the MPI implementation default). Topology and log
+    quantities are still gathered and written by the root rank. Collective output cannot be combined
+    with asynchronous output.
+
     \ingroup analyzers
 */
 class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
@@ -101,14 +124,70 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
         return pybind11::tuple(result);
         }
 
+    /// Get whether frames are written on a background thread
+    bool getAsync()
+        {
+        return m_async;
+        }
+
+    /// Set whether frames are written on a background thread
+    void setAsync(bool async);
+
+    /// Get the maximum number of frames waiting to be written
+    unsigned int getQueueDepth()
+        {
+        return m_queue_depth;
+        }
+
+    /// Set the maximum number of frames waiting to be written
+    void setQueueDepth(unsigned int queue_depth);
+
+    /// Get whether particle data is written collectively with MPI-IO
+    bool getMPIIO()
+        {
+        return m_mpi_io;
+        }
+
+    /// Set whether particle data is written collectively with MPI-IO
+    void setMPIIO(bool mpi_io);
+
+    /// Get the number of ranks that aggregate collective writes
+    unsigned int getMPIIOWriters()
+        {
+        return m_mpi_io_writers;
+        }
+
+    /// Set the number of ranks that aggregate collective writes
+    void setMPIIOWriters(unsigned int mpi_io_writers)
+        {
+        m_mpi_io_writers = mpi_io_writers;
+        }
+
     //! Destructor
     ~GSDDumpWriter();
 
     //! Write out the data for the current timestep
     void analyze(uint64_t timestep);
 
+    /// Wait until all queued frames are written to the file
+    void flush();
+
+    /// Flush queued frames at the end of the run
+    virtual void finalizeRun()
+        {
+        flush();
+        }
+
+    /// Flush queued frames when removed from the simulation
+    virtual void notifyDetach()
+        {
+        flush();
+        }
+
     hoomd::detail::SharedSignal<int(gsd_handle&)>& getWriteSignal()
         {
+        // slots write to the file handle directly, see analyze()
+        m_write_signal_requested = true;
         return m_write_signal;
         }
 
@@ -150,6 +229,7 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     bool m_write_momentum;  //!< True if momenta should be written
     bool m_write_topology;  //!< True if topology should be written
     gsd_handle m_handle;    //!< Handle to the file
+    uint64_t m_nframes = 0; //!< Number of frames in the file, including queued frames
 
     static std::list<std::string> particle_chunks;
 
@@ -160,7 +240,87 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
     std::map<std::string, bool>
         m_nondefault; //!< Map of quantities (true when non-default in frame 0)
 
+    SnapshotParticleData<float> m_snapshot;    //!< Particle data snapshot, reused between frames
+    std::vector<unsigned int> m_snapshot_index; //!< Snapshot index of each particle tag
+
     hoomd::detail::SharedSignal<int(gsd_handle&)> m_write_signal;
+    bool m_write_signal_requested = false; //!< True when slots may be connected to m_write_signal
+
+    /// Chunk waiting to be written by the background thread
+    struct PendingChunk
+        {
+        std::string name;            //!< Chunk name
+        gsd_type type;               //!< Data type
+        uint64_t N;                  //!< Number of rows
+        uint32_t M;                  //!< Number of columns
+        std::shared_ptr<void> owner; //!< Keeps the buffer alive until it is written
+        const void* data;            //!< Chunk data
+        };
+
+    bool m_async = false;           //!< True when frames are written on a background thread
+    unsigned int m_queue_depth = 2; //!< Maximum number of frames waiting to be written
+
+    std::vector<PendingChunk> m_frame;              //!< Chunks of the frame being assembled
+    std::deque<std::vector<PendingChunk>> m_queue;  //!< Frames waiting to be written
+    std::mutex m_queue_mutex;                       //!< Protects the queue and writer state
+    std::condition_variable m_queue_cv;             //!< Signals queue and writer state changes
+    std::thread m_writer_thread;                    //!< Background writer thread
+    bool m_stop_writer = false;                     //!< Request the writer thread to exit
+    bool m_writer_busy = false;                     //!< True while the writer writes a frame
+    std::exception_ptr m_writer_error;              //!< Error raised on the writer thread
+
+    //! Write a chunk now, or copy it into the pending frame when writing asynchronously
+    void writeChunk(const char* name, gsd_type type, uint64_t N, uint32_t M, const void* data);
+
+    //! Write a chunk now, or move the buffer into the pending frame when writing asynchronously
+    template<class T>
+    void writeChunk(const char* name, gsd_type type, uint64_t N, uint32_t M, std::vector<T>&& data)
+        {
+        if (!m_async)
+            {
+            writeChunk(name, type, N, M, (const void*)data.data());
+            return;
+            }
+
+        auto owner = std::make_shared<std::vector<T>>(std::move(data));
+        m_frame.push_back(PendingChunk {name, type, N, M, owner, owner->data()});
+        }
+
+    //! End the frame now, or queue it when writing asynchronously
+    void endFrame();
+
+    bool m_mpi_io = false;             //!< True when particle data is written collectively
+    unsigned int m_mpi_io_writers = 0; //!< Number of aggregator ranks (0 for the MPI default)
+
+#ifdef ENABLE_MPI
+    MPI_File m_mpi_file;                   //!< File handle for collective writes
+    std::vector<unsigned int> m_local_idx; //!< Local indices of the group members in file order
+    std::vector<int> m_local_rows;         //!< File rows of the local group members (increasing)
+
+    //! Write the per-particle chunks of the frame collectively
+    void writeLocalParticleData();
+
+    //! Find the file rows of the local group members
+    void findLocalRows();
+
+    //! Write a per-particle chunk from the local rows of every rank
+    template<class T>
+    void writeLocalChunk(const char* name,
+                         gsd_type type,
+                         uint32_t M,
+                         const std::vector<T>& data,
+                         bool local_default,
+                         bool skip_default);
+#endif
+
+    //! Wait for the writer thread to finish all queued frames and rethrow its errors
+    void waitForWriter();
+
+    //! Stop and join the writer thread after it writes all queued frames
+    void stopWriter();
+
+    //! Entry point of the writer thread
+    void writerLoop();
 
     //! Write a type mapping out to the file
     void writeTypeMapping(std::string chunk, std::vector<std::string> type_mapping);
@@ -173,15 +333,15 @@ class PYBIND11_EXPORT GSDDumpWriter : public Analyzer
 
     //! Write particle attributes
     void writeAttributes(const SnapshotParticleData<float>& snapshot,
-                         const std::map<unsigned int, unsigned int>& map);
+                         const std::vector<unsigned int>& index);
 
     //! Write particle properties
     void writeProperties(const SnapshotParticleData<float>& snapshot,
-                         const std::map<unsigned int, unsigned int>& map);
+                         const std::vector<unsigned int>& index);
 
     //! Write particle momenta
     void writeMomenta(const SnapshotParticleData<float>& snapshot,
-                      const std::map<unsigned int, unsigned int>& map);
+                      const std::vector<unsigned int>& index);
 
     //! Write bond topology
     void writeTopology(BondData::Snapshot& bond,
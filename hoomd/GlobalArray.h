@@ -35,6 +35,7 @@
 #include "GPUArray.h"
 #include "MemoryTraceback.h"
 
+#include <atomic>
 #include <cxxabi.h>
 #include <utility>
 
@@ -311,6 +312,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             m_acquired = false;
             m_align_bytes = rhs.m_align_bytes;
             m_tag = rhs.m_tag;
+            m_modification_count++;
 
             if (rhs.m_data.get())
                 {
@@ -349,7 +351,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
           m_data(std::move(other.m_data)), m_num_elements(std::move(other.m_num_elements)),
           m_pitch(std::move(other.m_pitch)), m_height(std::move(other.m_height)),
           m_acquired(std::move(other.m_acquired)), m_tag(std::move(other.m_tag)),
-          m_align_bytes(std::move(other.m_align_bytes)), m_is_managed(std::move(other.m_is_managed))
+          m_align_bytes(std::move(other.m_align_bytes)), m_is_managed(std::move(other.m_is_managed)),
+          m_modification_count(other.m_modification_count)
 #ifdef ENABLE_HIP
           ,
           m_event(std::move(other.m_event))
@@ -375,6 +378,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             m_tag = std::move(other.m_tag);
             m_align_bytes = std::move(other.m_align_bytes);
             m_is_managed = std::move(other.m_is_managed);
+            m_modification_count
+                = std::max(m_modification_count, other.m_modification_count) + 1;
 #ifdef ENABLE_HIP
             m_event = std::move(other.m_event);
 #endif
@@ -430,7 +435,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     //! Swap the pointers of two GlobalArrays
     inline void swap(GlobalArray& from)
         {
-        if (from.m_acquired || m_acquired)
+        if (from.isAcquired() || isAcquired())
             {
             throw std::runtime_error("Cannot swap arrays in use.");
             }
@@ -450,6 +455,20 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         m_fallback.swap(from.m_fallback);
 #endif
+
+        // both arrays hold different data than before, give them counts neither had so far
+        m_modification_count = std::max(m_modification_count, from.m_modification_count) + 1;
+        from.m_modification_count = m_modification_count;
+        }
+
+    //! Get the modification count
+    /*! The count increases whenever the array is acquired with a mode other than
+        access_mode::read, resized, assigned, or swapped. Callers can cache data derived from the
+        array and compare the count to detect when the cache is out of date.
+    */
+    uint64_t getModificationCount() const
+        {
+        return m_modification_count;
         }
 
     //! Get the underlying raw pointer
@@ -530,6 +549,8 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     */
     inline void resize(size_t num_elements)
         {
+        m_modification_count++;
+
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         if (!this->m_exec_conf || !m_is_managed)
             {
@@ -539,7 +560,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             }
 #endif
 
-        if (m_acquired)
+        if (isAcquired())
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
@@ -581,6 +602,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     inline void resize(size_t width, size_t height)
         {
         assert(this->m_exec_conf);
+        m_modification_count++;
 
 #ifndef ALWAYS_USE_MANAGED_MEMORY
         if (!m_is_managed)
@@ -591,7 +613,7 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
             }
 #endif
 
-        if (m_acquired)
+        if (isAcquired())
             {
             throw std::runtime_error("Cannot resize array in use.");
             }
@@ -720,10 +742,16 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
         m_acquired = false;
         }
 
+    //! Release a host read of the data pointer
+    inline void releaseHostRead() const
+        {
+        m_n_host_readers--;
+        }
+
     //! Returns the acquire state
     inline bool isAcquired() const
         {
-        return m_acquired;
+        return m_acquired || m_n_host_readers > 0;
         }
 
     //! Need to be friends with ArrayHandle
@@ -751,12 +779,16 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
     size_t m_height;       //!< Height of 2D array
 
     mutable bool m_acquired; //!< Tracks if the array is already acquired
+    //! Number of host reads in progress, which may happen concurrently
+    mutable std::atomic<unsigned int> m_n_host_readers {0};
 
     std::string m_tag; //!< Name tag of this buffer (optional)
 
     size_t m_align_bytes; //!< Size of alignment in bytes
     bool m_is_managed;    //!< Whether or not this array is stored using managed memory.
 
+    mutable uint64_t m_modification_count = 0; //!< Number of modifications of the array
+
 #ifdef ENABLE_HIP
     std::unique_ptr<hipEvent_t, hoomd::detail::event_deleter>
         m_event; //! CUDA event for synchronization
@@ -869,19 +901,25 @@ template<class T> class GlobalArray : public GPUArrayBase<T, GlobalArray<T>>
 template<class T> class GlobalArrayDispatch : public ArrayHandleDispatch<T>
     {
     public:
-    GlobalArrayDispatch(T* const _data, const GlobalArray<T>& _global_array)
-        : ArrayHandleDispatch<T>(_data), global_array(_global_array)
+    GlobalArrayDispatch(T* const _data,
+                        const GlobalArray<T>& _global_array,
+                        bool _host_read = false)
+        : ArrayHandleDispatch<T>(_data), global_array(_global_array), host_read(_host_read)
         {
         }
 
     virtual ~GlobalArrayDispatch()
         {
         assert(global_array.isAcquired());
-        global_array.release();
+        if (host_read)
+            global_array.releaseHostRead();
+        else
+            global_array.release();
         }
 
     private:
     const GlobalArray<T>& global_array;
+    bool host_read; //!< True when the acquisition is a counted host read
     };
 
 // ***********************************************
@@ -898,6 +936,9 @@ inline ArrayHandleDispatch<T> GlobalArray<T>::acquire(const access_location::Enu
 ) const
 
     {
+    if (mode != access_mode::read)
+        m_modification_count++;
+
 #ifndef ALWAYS_USE_MANAGED_MEMORY
     if (!this->m_exec_conf || !m_is_managed)
         return m_fallback.acquire(location,
@@ -913,6 +954,20 @@ inline ArrayHandleDispatch<T> GlobalArray<T>::acquire(const access_location::Enu
         {
         throw std::runtime_error("Cannot acquire access to array in use [" + this->m_tag + "]");
         }
+
+    // host reads on the CPU do not move the data, so several threads may read the array at the
+    // same time; they are counted so that other acquisitions still detect the array in use
+    if (location == access_location::host && mode == access_mode::read
+        && !(this->m_exec_conf && this->m_exec_conf->isCUDAEnabled()))
+        {
+        m_n_host_readers++;
+        return GlobalArrayDispatch<T>(isNull() ? nullptr : m_data.get(), *this, true);
+        }
+
+    if (m_n_host_readers > 0)
+        {
+        throw std::runtime_error("Cannot acquire access to array in use [" + this->m_tag + "]");
+        }
     m_acquired = true;
 
     // make sure a null array can be acquired
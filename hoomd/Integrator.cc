@@ -11,6 +11,12 @@
 #include "Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/task_group.h>
+#endif
+
+#include <map>
+
 #include <pybind11/stl_bind.h>
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<hoomd::ForceConstraint>>);
 PYBIND11_MAKE_OPAQUE(std::vector<std::shared_ptr<hoomd::ForceCompute>>);
@@ -214,9 +220,20 @@ Scalar Integrator::computeTotalMomentum(uint64_t timestep)
 */
 void Integrator::computeNetForce(uint64_t timestep)
     {
-    for (auto& force : m_forces)
+    ClockSource clock;
+
+#ifdef ENABLE_TBB
+    if (canComputeForcesConcurrently())
         {
-        force->compute(timestep);
+        computeForcesConcurrently(timestep);
+        }
+    else
+#endif
+        {
+        for (auto& force : m_forces)
+            {
+            force->compute(timestep);
+            }
         }
 
     if (m_prof)
@@ -248,7 +265,8 @@ void Integrator::computeNetForce(uint64_t timestep)
 
         external_energy = Scalar(0.0);
 
-        // now, add up the net forces
+        // now, add up the net forces in the order of m_forces, which makes the sum independent of
+        // the order in which concurrent forces finish
         // also sum up forces for ghosts, in case they are needed by the communicator
         unsigned int nparticles = m_pdata->getN() + m_pdata->getNGhosts();
         size_t net_virial_pitch = net_virial.getPitch();
@@ -257,46 +275,17 @@ void Integrator::computeNetForce(uint64_t timestep)
         assert(6 * nparticles <= net_virial.getNumElements());
         assert(nparticles <= net_torque.getNumElements());
 
+        NetForceArrays net {h_net_force.data,
+                            h_net_virial.data,
+                            net_virial_pitch,
+                            h_net_torque.data,
+                            nparticles,
+                            external_virial,
+                            &external_energy};
+
         for (const auto& force : m_forces)
             {
-            const GlobalArray<Scalar4>& h_force_array = force->getForceArray();
-            const GlobalArray<Scalar>& h_virial_array = force->getVirialArray();
-            const GlobalArray<Scalar4>& h_torque_array = force->getTorqueArray();
-
-            assert(nparticles <= h_force_array.getNumElements());
-            assert(6 * nparticles <= h_virial_array.getNumElements());
-            assert(nparticles <= h_torque_array.getNumElements());
-
-            ArrayHandle<Scalar4> h_force(h_force_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar> h_virial(h_virial_array, access_location::host, access_mode::read);
-            ArrayHandle<Scalar4> h_torque(h_torque_array, access_location::host, access_mode::read);
-
-            size_t virial_pitch = h_virial_array.getPitch();
-            for (unsigned int j = 0; j < nparticles; j++)
-                {
-                h_net_force.data[j].x += h_force.data[j].x;
-                h_net_force.data[j].y += h_force.data[j].y;
-                h_net_force.data[j].z += h_force.data[j].z;
-                h_net_force.data[j].w += h_force.data[j].w;
-
-                h_net_torque.data[j].x += h_torque.data[j].x;
-                h_net_torque.data[j].y += h_torque.data[j].y;
-                h_net_torque.data[j].z += h_torque.data[j].z;
-                h_net_torque.data[j].w += h_torque.data[j].w;
-
-                for (unsigned int k = 0; k < 6; k++)
-                    {
-                    h_net_virial.data[k * net_virial_pitch + j]
-                        += h_virial.data[k * virial_pitch + j];
-                    }
-                }
-
-            for (unsigned int k = 0; k < 6; k++)
-                {
-                external_virial[k] += force->getExternalVirial(k);
-                }
-
-            external_energy += force->getExternalEnergy();
+            addToNetForce(*force, net);
             }
         }
 
@@ -313,6 +302,8 @@ void Integrator::computeNetForce(uint64_t timestep)
         m_prof->pop();
         }
 
+    m_net_force_time = double(clock.getTime()) * 1e-9;
+
     // return early if there are no constraint forces or no HalfStepHook set
     if (m_constraint_forces.size() == 0)
         return;
@@ -409,6 +400,123 @@ void Integrator::computeNetForce(uint64_t timestep)
         }
     }
 
+/** @param force Force compute to add
+    @param net Net force arrays to add to
+*/
+void Integrator::addToNetForce(ForceCompute& force, const NetForceArrays& net)
+    {
+    const GlobalArray<Scalar4>& h_force_array = force.getForceArray();
+    const GlobalArray<Scalar>& h_virial_array = force.getVirialArray();
+    const GlobalArray<Scalar4>& h_torque_array = force.getTorqueArray();
+
+    assert(net.nparticles <= h_force_array.getNumElements());
+    assert(6 * net.nparticles <= h_virial_array.getNumElements());
+    assert(net.nparticles <= h_torque_array.getNumElements());
+
+    ArrayHandle<Scalar4> h_force(h_force_array, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_virial(h_virial_array, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_torque(h_torque_array, access_location::host, access_mode::read);
+
+    size_t virial_pitch = h_virial_array.getPitch();
+    for (unsigned int j = 0; j < net.nparticles; j++)
+        {
+        net.force[j].x += h_force.data[j].x;
+        net.force[j].y += h_force.data[j].y;
+        net.force[j].z += h_force.data[j].z;
+        net.force[j].w += h_force.data[j].w;
+
+        net.torque[j].x += h_torque.data[j].x;
+        net.torque[j].y += h_torque.data[j].y;
+        net.torque[j].z += h_torque.data[j].z;
+        net.torque[j].w += h_torque.data[j].w;
+
+        for (unsigned int k = 0; k < 6; k++)
+            {
+            net.virial[k * net.virial_pitch + j] += h_virial.data[k * virial_pitch + j];
+            }
+        }
+
+    for (unsigned int k = 0; k < 6; k++)
+        {
+        net.external_virial[k] += force.getExternalVirial(k);
+        }
+
+    *net.external_energy += force.getExternalEnergy();
+    }
+
+#ifdef ENABLE_TBB
+/** Forces are computed concurrently only on a single rank on the CPU with several threads, and
+    when profiling is off.
+*/
+bool Integrator::canComputeForcesConcurrently()
+    {
+    if (m_exec_conf->getNumThreads() < 2 || m_exec_conf->isCUDAEnabled() || m_prof
+        || m_forces.size() < 2)
+        return false;
+
+#ifdef ENABLE_MPI
+    // forces may communicate, which must happen in the same order on all ranks
+    if (m_sysdef->isDomainDecomposed())
+        return false;
+#endif
+
+    unsigned int n_concurrent = 0;
+    for (const auto& force : m_forces)
+        {
+        if (force->canComputeConcurrently())
+            n_concurrent++;
+        }
+
+    return n_concurrent > 1;
+    }
+
+/** @param timestep Current time step of the simulation
+
+    First computes the forces that do not support concurrency one after another on the calling
+    thread, in the order of m_forces. Then groups the other forces into chains of forces that share
+    state (ForceCompute::getSharedState()), again in the order of m_forces, and computes the chains
+    in parallel tasks. The caller sums the forces after all tasks have finished.
+*/
+void Integrator::computeForcesConcurrently(uint64_t timestep)
+    {
+    std::vector<std::vector<std::shared_ptr<ForceCompute>>> chains;
+    std::map<const void*, size_t> chain_index;
+
+    for (const auto& force : m_forces)
+        {
+        if (!force->canComputeConcurrently())
+            {
+            // these forces may call into python or modify any state
+            force->compute(timestep);
+            continue;
+            }
+
+        auto result = chain_index.insert(std::make_pair(force->getSharedState(), chains.size()));
+        if (result.second)
+            chains.emplace_back();
+        chains[result.first->second].push_back(force);
+        }
+
+    m_exec_conf->getTaskArena()->execute(
+        [&]
+        {
+            tbb::task_group group;
+            for (const auto& chain : chains)
+                {
+                group.run(
+                    [&]
+                    {
+                        for (const auto& force : chain)
+                            {
+                            force->compute(timestep);
+                            }
+                    });
+                }
+            group.wait();
+        });
+    }
+#endif
+
 #ifdef ENABLE_HIP
 /** @param timestep Current time step of the simulation
     \post All added force computes in \a m_forces are computed and totaled up in \a m_net_force and
@@ -421,6 +529,8 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         throw runtime_error("Cannot compute net force on the GPU if CUDA is disabled.");
         }
 
+    ClockSource clock;
+
     // compute all the normal forces first
 
     for (auto& force : m_forces)
@@ -659,6 +769,8 @@ void Integrator::computeNetForceGPU(uint64_t timestep)
         m_prof->pop(m_exec_conf);
         }
 
+    m_net_force_time = double(clock.getTime()) * 1e-9;
+
     // return early if there are no constraint forces or no HalfStepHook set
     if (m_constraint_forces.size() == 0)
         return;
@@ -967,6 +1079,46 @@ void Integrator::computeCallback(uint64_t timestep)
     }
 #endif
 
+/** Forces that communicate while they compute (ForceCompute::communicatesInCompute()) are left
+    out, as their time includes the time this rank waits for the other ranks.
+*/
+double Integrator::getTotalLocalForceTime()
+    {
+    double time = 0.0;
+    for (auto& force : m_forces)
+        {
+        if (!force->communicatesInCompute())
+            time += force->getTotalComputeTime();
+        }
+
+    for (auto& constraint_force : m_constraint_forces)
+        {
+        if (!constraint_force->communicatesInCompute())
+            time += constraint_force->getTotalComputeTime();
+        }
+
+    return time;
+    }
+
+/** The cost is one unit per local particle for the integration, plus the costs of the forces
+    reported by ForceCompute::getLocalCost().
+*/
+double Integrator::getLocalCost()
+    {
+    double cost = double(m_pdata->getN());
+    for (auto& force : m_forces)
+        {
+        cost += force->getLocalCost();
+        }
+
+    for (auto& constraint_force : m_constraint_forces)
+        {
+        cost += constraint_force->getLocalCost();
+        }
+
+    return cost;
+    }
+
 bool Integrator::areForcesAnisotropic()
     {
     bool aniso = false;
@@ -995,7 +1147,8 @@ void export_Integrator(pybind11::module& m)
         .def("updateGroupDOF", &Integrator::updateGroupDOF)
         .def_property("dt", &Integrator::getDeltaT, &Integrator::setDeltaT)
         .def_property_readonly("forces", &Integrator::getForces)
-        .def_property_readonly("constraints", &Integrator::getConstraintForces);
+        .def_property_readonly("constraints", &Integrator::getConstraintForces)
+        .def("getNetForceTime", &Integrator::getNetForceTime);
     }
 
     } // end namespace detail
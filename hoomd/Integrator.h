@@ -36,14 +36,16 @@ namespace hoomd
     this way.
 
     All forces added to m_forces are computed independently and then totaled up to calculate the net
-    force and energy on each particle. Constraint forces (ForceConstraint) are unique in that they
-    need to be computed \b after the net forces is already available. To implement this behavior,
-    add constraint forces to m_constraint_forces through getConstraintForces. All constraint forces
-    will be computed independently and will be able to read the current unconstrained net force.
-    The particles that separate constraint forces interact with should not overlap. Degrees of
-    freedom removed via the constraint forces can be totaled up with a call to getNDOFRemoved for
-    convenience in derived classes implementing correct counting in getTranslationalDOF() and
-    getRotationalDOF().
+    force and energy on each particle. On the CPU with several threads, the forces that support it
+    (ForceCompute::canComputeConcurrently()) are computed in parallel tasks and summed in the
+    order of m_forces after all tasks finish. Constraint forces
+    (ForceConstraint) are unique in that they need to be computed \b after the net forces is
+    already available. To implement this behavior, add constraint forces to m_constraint_forces
+    through getConstraintForces. All constraint forces will be computed independently and will be
+    able to read the current unconstrained net force. The particles that separate constraint forces
+    interact with should not overlap. Degrees of freedom removed via the constraint forces can be
+    totaled up with a call to getNDOFRemoved for convenience in derived classes implementing
+    correct counting in getTranslationalDOF() and getRotationalDOF().
 
     Integrators take "ownership" of the particle's accelerations. Any other updater that modifies
     the particles accelerations will produce undefined results. If accelerations are to be modified,
@@ -130,6 +132,21 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// Prepare for the run
     virtual void prepRun(uint64_t timestep);
 
+    /// Get the wall clock time of the last computation of the net force in seconds
+    /** Includes the computation of the forces and their summation, but not the constraint forces.
+        Compare to ForceCompute::getComputeTime() to find the critical path.
+    */
+    double getNetForceTime() const
+        {
+        return m_net_force_time;
+        }
+
+    /// Get the total wall clock time of the forces that compute without communication in seconds
+    virtual double getTotalLocalForceTime();
+
+    /// Estimate the cost of a time step on the local particles
+    virtual double getLocalCost();
+
 #ifdef ENABLE_MPI
     /// Callback for pre-computing the forces
     void computeCallback(uint64_t timestep);
@@ -148,6 +165,32 @@ class PYBIND11_EXPORT Integrator : public Updater
     /// The HalfStepHook, if active
     std::shared_ptr<HalfStepHook> m_half_step_hook;
 
+    /// Wall clock time of the last computation of the net force
+    double m_net_force_time = 0.0;
+
+    /// Pointers to the net force arrays and external terms that forces are added to
+    struct NetForceArrays
+        {
+        Scalar4* force;          //!< Net force
+        Scalar* virial;          //!< Net virial
+        size_t virial_pitch;     //!< Pitch of the net virial
+        Scalar4* torque;         //!< Net torque
+        unsigned int nparticles; //!< Number of local and ghost particles to sum
+        Scalar* external_virial; //!< External virial (6 values)
+        Scalar* external_energy; //!< External energy
+        };
+
+    /// Add the forces, torques, virials and external terms of one force compute
+    void addToNetForce(ForceCompute& force, const NetForceArrays& net);
+
+#ifdef ENABLE_TBB
+    /// Check if the forces should be computed in parallel tasks
+    bool canComputeForcesConcurrently();
+
+    /// Compute the forces in m_forces in parallel tasks
+    void computeForcesConcurrently(uint64_t timestep);
+#endif
+
     /// helper function to compute initial accelerations
     void computeAccelerations(uint64_t timestep);
 
@@ -7,6 +7,8 @@
 
 #include "LoadBalancer.h"
 #include "Communicator.h"
+#include "Integrator.h"
+#include "System.h"
 
 #include "hoomd/extern/BVLSSolver.h"
 #include <Eigen/Dense>
@@ -32,10 +34,12 @@ LoadBalancer::LoadBalancer(std::shared_ptr<SystemDefinition> sysdef,
 #ifdef ENABLE_MPI
       m_mpi_comm(m_exec_conf->getMPICommunicator()),
 #endif
-      m_max_imbalance(Scalar(1.0)), m_recompute_max_imbalance(true), m_needs_migrate(false),
-      m_needs_recount(false), m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)),
-      m_N_own(m_pdata->getN()), m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0),
-      m_n_iterations(0), m_n_rebalances(0)
+      m_mode(LoadMode::particles), m_last_force_time(0.0), m_max_imbalance(Scalar(1.0)),
+      m_recompute_max_imbalance(true), m_needs_migrate(false), m_needs_recount(false),
+      m_tolerance(Scalar(1.05)), m_maxiter(1), m_max_scale(Scalar(0.05)), m_N_own(m_pdata->getN()),
+      m_load_own(Scalar(m_pdata->getN())), m_cost_per_particle(Scalar(1.0)),
+      m_max_max_imbalance(1.0), m_total_max_imbalance(0.0), m_n_calls(0), m_n_iterations(0),
+      m_n_rebalances(0)
     {
     m_exec_conf->msg->notice(5) << "Constructing LoadBalancer" << endl;
 
@@ -66,6 +70,45 @@ LoadBalancer::~LoadBalancer()
     m_exec_conf->msg->notice(5) << "Destroying LoadBalancer" << endl;
     }
 
+/*!
+ * \param mode Measure of the load to balance: "particles", "time", or "weights"
+ */
+void LoadBalancer::setMode(const std::string& mode)
+    {
+    if (mode == "particles")
+        m_mode = LoadMode::particles;
+    else if (mode == "time")
+        m_mode = LoadMode::time;
+    else if (mode == "weights")
+        m_mode = LoadMode::weights;
+    else
+        throw std::invalid_argument("Invalid load balancing mode: " + mode);
+    }
+
+std::string LoadBalancer::getMode()
+    {
+    if (m_mode == LoadMode::time)
+        return "time";
+    else if (m_mode == LoadMode::weights)
+        return "weights";
+    else
+        return "particles";
+    }
+
+/*!
+ * \param system System whose current integrator measures the load
+ *
+ * The integrator is looked up on every update, so the load follows changes of the integrator. The
+ * time mode balances the time spent computing forces after this call.
+ */
+void LoadBalancer::setSystem(std::shared_ptr<System> system)
+    {
+    m_system = system;
+    std::shared_ptr<Integrator> integrator = system->getIntegrator();
+    m_timed_integrator = integrator;
+    m_last_force_time = integrator ? integrator->getTotalLocalForceTime() : 0.0;
+    }
+
 /*!
  * \param timestep Current time step of the simulation
  *
@@ -84,7 +127,9 @@ void LoadBalancer::update(uint64_t timestep)
     if (m_prof)
         m_prof->push(m_exec_conf, "balance");
 
-    // no adjustment has been made yet, so set m_N_own to the number of particles on the rank
+    // no adjustment has been made yet, so set m_N_own to the number of particles on the rank and
+    // the load to the measured load
+    measureCost();
     resetNOwn(m_pdata->getN());
 
     // figure out which rank is the reduction root for broadcasting
@@ -142,17 +187,17 @@ void LoadBalancer::update(uint64_t timestep)
                 min_frac_i = min_domain_frac.z;
                 }
 
-            vector<unsigned int> N_i;
+            vector<Scalar> load_i;
             bool adjusted = false;
 
-            // reduce the number of particles in the slice along dim
-            bool active = reduce(N_i, dim, reduce_root);
+            // reduce the load in the slice along dim
+            bool active = reduce(load_i, dim, reduce_root);
 
             // attempt an adjustment
             vector<Scalar> cum_frac = m_decomposition->getCumulativeFractions(dim);
             if (active)
                 {
-                adjusted = adjust(cum_frac, N_i, L_i, min_frac_i);
+                adjusted = adjust(cum_frac, load_i, L_i, min_frac_i);
                 }
 
             // broadcast if an adjustment has been made on the root
@@ -170,8 +215,13 @@ void LoadBalancer::update(uint64_t timestep)
         // force a particle migration if one is needed
         if (m_needs_migrate)
             {
+            // the received particles keep the cost of their previous owner
+            const Scalar load = getLoad();
+
             m_comm->forceMigrate();
             m_comm->communicate(timestep);
+            if (m_pdata->getN() > 0)
+                m_cost_per_particle = load / Scalar(m_pdata->getN());
             resetNOwn(m_pdata->getN());
             m_needs_migrate = false;
 
@@ -188,15 +238,20 @@ void LoadBalancer::update(uint64_t timestep)
 #ifdef ENABLE_MPI
 
 /*!
- * Computes the imbalance factor I = N / <N> for each rank, and computes the maximum among all
- * ranks.
+ * Computes the imbalance factor I = L / <L> of the load L for each rank, and computes the maximum
+ * among all ranks.
  */
 Scalar LoadBalancer::getMaxImbalance()
     {
     if (m_recompute_max_imbalance)
         {
-        Scalar cur_imb = Scalar(getNOwn())
-                         / (Scalar(m_pdata->getNGlobal()) / Scalar(m_exec_conf->getNRanks()));
+        Scalar cur_load = getLoad();
+        Scalar total_load(0.0);
+        MPI_Allreduce(&cur_load, &total_load, 1, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+
+        Scalar cur_imb(1.0);
+        if (total_load > Scalar(0.0))
+            cur_imb = cur_load / (total_load / Scalar(m_exec_conf->getNRanks()));
         Scalar max_imb(0.0);
         MPI_Allreduce(&cur_imb, &max_imb, 1, MPI_HOOMD_SCALAR, MPI_MAX, m_mpi_comm);
 
@@ -211,37 +266,93 @@ Scalar LoadBalancer::getMaxImbalance()
     }
 
 /*!
- * \param N_i Vector holding the total number of particles in each slice (will be allocated on call)
+ * The load of the rank is measured according to m_mode. When the load has not been measured on any
+ * rank, for example before the first time step, or there is no integrator, the particles are
+ * balanced instead.
+ *
+ * \note measureCost() relies on collective MPI calls, and so all ranks must call it.
+ */
+void LoadBalancer::measureCost()
+    {
+    const unsigned int N = m_pdata->getN();
+    Scalar load = Scalar(N);
+
+    // the integrator may have been replaced since the last update
+    std::shared_ptr<System> system = m_system.lock();
+    std::shared_ptr<Integrator> integrator = system ? system->getIntegrator() : nullptr;
+    if (integrator && m_mode == LoadMode::time)
+        {
+        // all the time of a new integrator was spent since the last update, and the total drops
+        // when forces are removed
+        const double total_time = integrator->getTotalLocalForceTime();
+        if (integrator != m_timed_integrator.lock() || total_time < m_last_force_time)
+            m_last_force_time = 0.0;
+        load = Scalar(total_time - m_last_force_time);
+        m_timed_integrator = integrator;
+        m_last_force_time = total_time;
+        }
+    else if (integrator && m_mode == LoadMode::weights)
+        {
+        load = Scalar(integrator->getLocalCost());
+        }
+
+    Scalar total_load(0.0);
+    MPI_Allreduce(&load, &total_load, 1, MPI_HOOMD_SCALAR, MPI_SUM, m_mpi_comm);
+
+    if (total_load <= Scalar(0.0) || m_pdata->getNGlobal() == 0)
+        {
+        m_cost_per_particle = Scalar(1.0);
+        }
+    else if (N > 0)
+        {
+        m_cost_per_particle = load / Scalar(N);
+        }
+    else
+        {
+        // a rank without particles assumes the average cost of the particles it receives
+        m_cost_per_particle = total_load / Scalar(m_pdata->getNGlobal());
+        }
+    }
+
+/*!
+ * \param load_i Vector holding the total load in each slice (will be allocated on call)
  * \param dim The dimension of the slices (x=0, y=1, z=2)
  * \param reduce_root The rank to perform the reduction on
- * \returns true if the current rank holds the active \a N_i
+ * \returns true if the current rank holds the active \a load_i
  *
- * \post \a N_i holds the number of particles in each slice along \a dim
+ * \post \a load_i holds the load in each slice along \a dim
  *
  * \note reduce() relies on collective MPI calls, and so all ranks must call it. However, for
  * efficiency the data will be active only on Cartesian rank \a reduce_root, as indicated by the
- * return value. As a result, only \a reduce_root actually needs to allocate memory for \a N_i.
+ * return value. As a result, only \a reduce_root actually needs to allocate memory for \a load_i.
  *
  * The reduction is performed by performing an all-to-one gather, followed by summation on \a
  * reduce_root. This operation may be suboptimal for very large numbers of processors, and could be
  * replaced by cascading send operations down dimensions. Generally, load balancing should not be
  * performed too frequently, and so we do not pursue this optimization right now.
  */
-bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
+bool LoadBalancer::reduce(std::vector<Scalar>& load_i,
                           unsigned int dim,
                           unsigned int reduce_root)
     {
     // do nothing if there is only one rank
-    if (N_i.size() == 1)
+    if (load_i.size() == 1)
         return false;
 
     const Index3D& di = m_decomposition->getDomainIndexer();
-    std::vector<unsigned int> N_per_rank(di.getNumElements());
+    std::vector<Scalar> load_per_rank(di.getNumElements());
 
-    // get the number of particles the current rank owns (the quantity to be reduced)
-    unsigned int N_own = getNOwn();
+    // get the load of the particles the current rank owns (the quantity to be reduced)
+    Scalar load_own = getLoad();
 
-    MPI_Gather(&N_own, 1, MPI_UNSIGNED, &N_per_rank[0], 1, MPI_UNSIGNED, reduce_root, m_mpi_comm);
+    MPI_Gather(&load_own,
+               1,
+               MPI_HOOMD_SCALAR,
+               &load_per_rank[0],
+               1,
+               MPI_HOOMD_SCALAR,
+               reduce_root,
+               m_mpi_comm);
 
     // only the root rank performs the reduction
     if (m_exec_conf->getRank() != reduce_root)
@@ -251,57 +362,57 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
     ArrayHandle<unsigned int> h_cart_ranks_inv(m_decomposition->getInverseCartRanks(),
                                                access_location::host,
                                                access_mode::read);
-    std::vector<unsigned int> N_per_cart_rank(di.getNumElements());
+    std::vector<Scalar> load_per_cart_rank(di.getNumElements());
     for (unsigned int cur_rank = 0; cur_rank < di.getNumElements(); ++cur_rank)
         {
-        N_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = N_per_rank[cur_rank];
+        load_per_cart_rank[h_cart_ranks_inv.data[cur_rank]] = load_per_rank[cur_rank];
         }
 
     // perform the summation along dim in as cache friendly of a way as we can manage
     if (dim == 0) // to x
         {
-        N_i.clear();
-        N_i.resize(di.getW());
+        load_i.clear();
+        load_i.resize(di.getW());
         for (unsigned int i = 0; i < di.getW(); ++i)
             {
-            N_i[i] = 0;
+            load_i[i] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int j = 0; j < di.getH(); ++j)
                     {
-                    N_i[i] += N_per_cart_rank[di(i, j, k)];
+                    load_i[i] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 1) // to y
         {
-        N_i.clear();
-        N_i.resize(di.getH());
+        load_i.clear();
+        load_i.resize(di.getH());
         for (unsigned int j = 0; j < di.getH(); ++j)
             {
-            N_i[j] = 0;
+            load_i[j] = Scalar(0.0);
             for (unsigned int k = 0; k < di.getD(); ++k)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[j] += N_per_cart_rank[di(i, j, k)];
+                    load_i[j] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
         }
     else if (dim == 2) // to z
         {
-        N_i.clear();
-        N_i.resize(di.getD());
+        load_i.clear();
+        load_i.resize(di.getD());
         for (unsigned int k = 0; k < di.getD(); ++k)
             {
-            N_i[k] = 0;
+            load_i[k] = Scalar(0.0);
             for (unsigned int j = 0; j < di.getH(); ++j)
                 {
                 for (unsigned int i = 0; i < di.getW(); ++i)
                     {
-                    N_i[k] += N_per_cart_rank[di(i, j, k)];
+                    load_i[k] += load_per_cart_rank[di(i, j, k)];
                     }
                 }
             }
@@ -316,7 +427,7 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
 
 /*!
  * \param cum_frac_i The cumulative fraction array to write output into
- * \param N_i The reduced number of particles along the dimension
+ * \param load_i The reduced load along the dimension
  * \param L_i The global box length along the dimension
  * \param min_frac_i The minimum fractional width of a domain
  *
@@ -335,31 +446,34 @@ bool LoadBalancer::reduce(std::vector<unsigned int>& N_i,
  * minimization was successful, apply the adjustment to \a cum_frac_i.
  */
 bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
-                          const vector<unsigned int>& N_i,
+                          const vector<Scalar>& load_i,
                           Scalar L_i,
                           Scalar min_frac_i)
     {
-    if (N_i.size() == 1)
+    if (load_i.size() == 1)
         return false;
 
-    // target particles per rank is uniform distribution
-    const Scalar target = Scalar(m_pdata->getNGlobal()) / Scalar(N_i.size());
+    // target load per slice is the average
+    const Scalar target
+        = std::accumulate(load_i.begin(), load_i.end(), Scalar(0.0)) / Scalar(load_i.size());
+    if (target <= Scalar(0.0))
+        return false;
 
     // make the minimum domain slightly bigger so that the optimization won't fail at equality
     const Scalar min_domain_size = Scalar(1.00001) * min_frac_i * L_i;
     // if system is overconstrained (exactly decomposed) don't do any adjusting
-    if (min_domain_size * Scalar(N_i.size()) >= L_i)
+    if (min_domain_size * Scalar(load_i.size()) >= L_i)
         {
         return false;
         }
 
     // imbalance factors for each rank
-    vector<Scalar> new_widths(N_i.size());
-    for (unsigned int i = 0; i < N_i.size(); ++i)
+    vector<Scalar> new_widths(load_i.size());
+    for (unsigned int i = 0; i < load_i.size(); ++i)
         {
-        const Scalar imb_factor = Scalar(N_i[i]) / target;
+        const Scalar imb_factor = load_i[i] / target;
         Scalar scale_factor
-            = (N_i[i] > 0)
+            = (load_i[i] > Scalar(0.0))
                   ? Scalar(1.0) / imb_factor
                   : (Scalar(1.0)
                      + m_max_scale); // as in gromacs, use half the imbalance factor to scale
@@ -384,7 +498,7 @@ bool LoadBalancer::adjust(vector<Scalar>& cum_frac_i,
     // setup the augmented A matrix, with scale factor eps for the actual least squares part (to
     // enforce the inequality constraints correctly)
     const Scalar eps(0.001);
-    unsigned int m = (unsigned int)N_i.size();
+    unsigned int m = (unsigned int)load_i.size();
     unsigned int n = m - 1;
     Eigen::MatrixXd A = Eigen::MatrixXd::Zero(2 * m, n + m);
     A(0, 0) = 1.0;
@@ -545,7 +659,9 @@ void LoadBalancer::countParticlesOffRank(std::map<unsigned int, unsigned int>& c
 /*!
  * Each rank calls countParticlesOffRank() to count the number of particles to send to other ranks.
  * Neighboring ranks then perform send/receive calls, and count the new number of particles they own
- * as the number they owned locally plus the number received minus the number sent.
+ * as the number they owned locally plus the number received minus the number sent. The ranks also
+ * exchange their cost per particle, and the particles that are sent or received change the load by
+ * the cost per particle of the sending rank.
  *
  * \note All ranks must participate in this call since it involves send/receive operations between
  * neighboring domains.
@@ -570,12 +686,13 @@ void LoadBalancer::computeOwnedParticles()
         }
     countParticlesOffRank(cnts);
 
-    MPI_Request req[2 * m_comm->getNUniqueNeighbors()];
-    MPI_Status stat[2 * m_comm->getNUniqueNeighbors()];
+    MPI_Request req[4 * m_comm->getNUniqueNeighbors()];
+    MPI_Status stat[4 * m_comm->getNUniqueNeighbors()];
     unsigned int nreq = 0;
 
     unsigned int n_send_ptls[m_comm->getNUniqueNeighbors()];
     unsigned int n_recv_ptls[m_comm->getNUniqueNeighbors()];
+    Scalar recv_cost[m_comm->getNUniqueNeighbors()];
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         unsigned int neigh_rank = h_unique_neigh.data[cur_neigh];
@@ -595,19 +712,39 @@ void LoadBalancer::computeOwnedParticles()
                   0,
                   m_mpi_comm,
                   &req[nreq++]);
+
+        MPI_Isend(&m_cost_per_particle,
+                  1,
+                  MPI_HOOMD_SCALAR,
+                  neigh_rank,
+                  1,
+                  m_mpi_comm,
+                  &req[nreq++]);
+        MPI_Irecv(&recv_cost[cur_neigh],
+                  1,
+                  MPI_HOOMD_SCALAR,
+                  neigh_rank,
+                  1,
+                  m_mpi_comm,
+                  &req[nreq++]);
         }
     MPI_Waitall(nreq, req, stat);
 
     // reduce the particles sent to me
     int N_own = m_pdata->getN();
+    Scalar load_own = m_cost_per_particle * Scalar(m_pdata->getN());
     for (unsigned int cur_neigh = 0; cur_neigh < m_comm->getNUniqueNeighbors(); ++cur_neigh)
         {
         N_own += n_recv_ptls[cur_neigh];
         N_own -= n_send_ptls[cur_neigh];
+
+        load_own += recv_cost[cur_neigh] * Scalar(n_recv_ptls[cur_neigh]);
+        load_own -= m_cost_per_particle * Scalar(n_send_ptls[cur_neigh]);
         }
 
-    // set the count
+    // set the count and the load
     resetNOwn(N_own);
+    m_load_own = load_own;
     }
 
 #endif // ENABLE_MPI
@@ -634,7 +771,9 @@ void export_LoadBalancer(pybind11::module& m)
                       &LoadBalancer::setMaxIterations)
         .def_property("x", &LoadBalancer::getEnableX, &LoadBalancer::setEnableX)
         .def_property("y", &LoadBalancer::getEnableY, &LoadBalancer::setEnableY)
-        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ);
+        .def_property("z", &LoadBalancer::getEnableZ, &LoadBalancer::setEnableZ)
+        .def_property("mode", &LoadBalancer::getMode, &LoadBalancer::setMode)
+        .def("setSystem", &LoadBalancer::setSystem);
     }
 
     } // end namespace detail
@@ -21,11 +21,25 @@
 
 namespace hoomd
     {
+class Integrator;
+class System;
+
 //! Updates domain decompositions to balance the load
 /*!
  * Adjusts the boundaries of the processor domains to distribute the load close to evenly between
- * them. The load imbalance is defined as the number of particles owned by a rank divided by the
- * average number of particles per rank if the particles had a uniform distribution.
+ * them. The load imbalance is defined as the load of a rank divided by the average load per rank.
+ * The load is measured according to the balancing mode:
+ *  - particles: The number of particles owned by the rank.
+ *  - time: The wall clock time the integrator spent computing forces on the rank since the last
+ *    update (Integrator::getTotalLocalForceTime()). Forces that communicate while they compute,
+ *    such as PPPM, are not timed, as a rank would count the time it waits for slower ranks.
+ *  - weights: The cost weights of the integrator and its forces (Integrator::getLocalCost()), such
+ *    as the number of pair neighbors.
+ *
+ * The time and weights modes measure the load once per update() and assign each rank a cost per
+ * particle. Trial adjustments of the domain boundaries estimate the new load of a rank from the
+ * number of particles it would keep and receive, weighted by the cost per particle of the rank
+ * that owns them now. In the particles mode, every particle costs 1.
  *
  * At each load balancing step, we attempt to rescale the domain size by the inverse of the load
  * balance, subject to the following constraints that are imposed to both maintain a stable
@@ -136,6 +150,15 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_enable_z;
         }
 
+    /// Set the balancing mode ("particles", "time", or "weights")
+    void setMode(const std::string& mode);
+
+    /// Get the balancing mode
+    std::string getMode();
+
+    /// Set the system whose current integrator measures the load in the time and weights modes
+    void setSystem(std::shared_ptr<System> system);
+
     //! Take one timestep forward
     virtual void update(uint64_t timestep);
 
@@ -155,8 +178,11 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     //! Computes the maximum imbalance factor
     Scalar getMaxImbalance();
 
-    //! Reduce the particle numbers per rank down to one dimension
-    bool reduce(std::vector<unsigned int>& N_i, unsigned int dim, unsigned int reduce_root);
+    //! Measure the load of the rank and set the cost per particle
+    void measureCost();
+
+    //! Reduce the loads per rank down to one dimension
+    bool reduce(std::vector<Scalar>& load_i, unsigned int dim, unsigned int reduce_root);
 
     //! Set flags within the class that a resize has been performed
     void signalResize()
@@ -168,11 +194,11 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
 
     //! Adjust the partitioning along a single dimension
     bool adjust(std::vector<Scalar>& cum_frac_i,
-                const std::vector<unsigned int>& N_i,
+                const std::vector<Scalar>& load_i,
                 Scalar L_i,
                 Scalar min_domain_frac);
 
-    //! Compute the number of particles on each rank after an adjustment
+    //! Compute the number of particles and the load of each rank after an adjustment
     void computeOwnedParticles();
 
     //! Count the number of particles that have gone off the rank
@@ -185,6 +211,13 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
         return m_N_own;
         }
 
+    //! Gets the load of the rank, updating if necessary
+    Scalar getLoad()
+        {
+        computeOwnedParticles();
+        return m_load_own;
+        }
+
     //! Force a reset of the number of owned particles without counting
     /*!
      * \param N number of particles owned by the rank
@@ -192,11 +225,25 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     void resetNOwn(unsigned int N)
         {
         m_N_own = N;
+        m_load_own = m_cost_per_particle * Scalar(N);
         m_recompute_max_imbalance = true;
         m_needs_recount = false;
         }
 #endif // ENABLE_MPI
 
+    //! Measures of the load
+    enum class LoadMode
+        {
+        particles, //!< Number of particles
+        time,      //!< Wall clock time of the force computation
+        weights    //!< Cost weights of the forces
+        };
+
+    LoadMode m_mode;                              //!< Measure of the load to balance
+    std::weak_ptr<System> m_system;               //!< System that holds the integrator
+    std::weak_ptr<Integrator> m_timed_integrator; //!< Integrator m_last_force_time refers to
+    double m_last_force_time;                     //!< Total local force time at the last update
+
     Scalar m_max_imbalance;         //!< Maximum imbalance
     bool m_recompute_max_imbalance; //!< Flag if maximum imbalance needs to be computed
 
@@ -212,7 +259,9 @@ class PYBIND11_EXPORT LoadBalancer : public Tuner
     const Scalar m_max_scale; //!< Maximum fraction to rescale either direction (5%)
 
     private:
-    unsigned int m_N_own; //!< Number of particles owned by this rank
+    unsigned int m_N_own;       //!< Number of particles owned by this rank
+    Scalar m_load_own;          //!< Load of the particles owned by this rank
+    Scalar m_cost_per_particle; //!< Load per particle of this rank
 
     Scalar m_max_max_imbalance;   //!< The maximum imbalance of any check
     double m_total_max_imbalance; //!< The average imbalance over checks
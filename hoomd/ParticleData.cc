@@ -1351,240 +1351,295 @@ template<class Real>
 std::map<unsigned int, unsigned int>
 ParticleData::takeSnapshot(SnapshotParticleData<Real>& snapshot)
     {
+    std::vector<unsigned int> index;
+    takeSnapshot(snapshot, SnapshotFields().set(), index);
+
     // a map to contain a particle tag-> snapshot idx lookup
-    std::map<unsigned int, unsigned int> index;
+    std::map<unsigned int, unsigned int> map;
+    for (unsigned int tag = 0; tag < index.size(); tag++)
+        {
+        if (index[tag] != NOT_LOCAL)
+            map.insert(std::make_pair(tag, index[tag]));
+        }
 
+    return map;
+    }
+
+#ifdef ENABLE_MPI
+namespace
+    {
+//! Gather a particle data array of all ranks on the root rank, in rank order
+/*! \param local Local particle data
+    \param n Number of local particles
+    \param global Output: concatenated particle data (root rank only)
+    \param buf Rank counts and offsets, in particles, on the root rank
+    \param root True on the root rank
+    \param mpi_comm MPI communicator
+
+    The counts and offsets are given in elements of a contiguous datatype the size of \a T, so
+    they remain valid for arrays larger than 2 GiB.
+*/
+template<class T, class Buffers>
+void gather_snapshot_array(const T* local,
+                           unsigned int n,
+                           std::vector<T>& global,
+                           Buffers& buf,
+                           bool root,
+                           MPI_Comm mpi_comm)
+    {
+    if (root)
+        global.resize(size_t(buf.displs.back()) + size_t(buf.counts.back()));
+
+    MPI_Datatype element_type;
+    MPI_Type_contiguous(int(sizeof(T)), MPI_BYTE, &element_type);
+    MPI_Type_commit(&element_type);
+
+    MPI_Gatherv((void*)local,
+                int(n),
+                element_type,
+                global.data(),
+                buf.counts.data(),
+                buf.displs.data(),
+                element_type,
+                0,
+                mpi_comm);
+
+    MPI_Type_free(&element_type);
+    }
+    } // end anonymous namespace
+#endif
+
+//! take a snapshot of selected particle data fields
+/* \param snapshot The snapshot to write to
+   \param fields Fields to copy, the other fields of \a snapshot are left unchanged
+   \param index Output: lookup from a particle tag to its snapshot index, NOT_LOCAL for unused tags
+
+   Only the selected arrays are accessed and, with MPI, gathered to the root rank. The snapshot,
+   the index, and the gather buffers keep their memory between calls, so writers that take a
+   snapshot of the same system every frame do not allocate. With MPI, \a snapshot and \a index are
+   only written on the root rank and all ranks must pass the same \a fields.
+*/
+template<class Real>
+void ParticleData::takeSnapshot(SnapshotParticleData<Real>& snapshot,
+                                SnapshotFields fields,
+                                std::vector<unsigned int>& index)
+    {
     m_exec_conf->msg->notice(4) << "ParticleData: taking snapshot" << std::endl;
 
-    ArrayHandle<Scalar4> h_pos(m_pos, access_location::host, access_mode::read);
-    ArrayHandle<Scalar4> h_vel(m_vel, access_location::host, access_mode::read);
-    ArrayHandle<Scalar3> h_accel(m_accel, access_location::host, access_mode::read);
-    ArrayHandle<int3> h_image(m_image, access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_charge(m_charge, access_location::host, access_mode::read);
-    ArrayHandle<Scalar> h_diameter(m_diameter, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_body(m_body, access_location::host, access_mode::read);
-    ArrayHandle<Scalar4> h_orientation(m_orientation, access_location::host, access_mode::read);
-    ArrayHandle<Scalar4> h_angmom(m_angmom, access_location::host, access_mode::read);
-    ArrayHandle<Scalar3> h_inertia(m_inertia, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_rtag, access_location::host, access_mode::read);
+    // positions are wrapped into the global box, which updates the image
+    const bool need_image = fields[snapshot_field::position] || fields[snapshot_field::image];
+    const bool need_pos = need_image || fields[snapshot_field::type];
+    const bool need_vel = fields[snapshot_field::velocity] || fields[snapshot_field::mass];
 
+    // acquire only the selected arrays
+    ArrayHandle<unsigned int> h_tag(m_tag, access_location::host, access_mode::read);
+    std::unique_ptr<ArrayHandle<Scalar4>> h_pos, h_vel, h_orientation, h_angmom;
+    std::unique_ptr<ArrayHandle<Scalar3>> h_accel, h_inertia;
+    std::unique_ptr<ArrayHandle<Scalar>> h_charge, h_diameter;
+    std::unique_ptr<ArrayHandle<int3>> h_image;
+    std::unique_ptr<ArrayHandle<unsigned int>> h_body;
+
+    if (need_pos)
+        h_pos.reset(new ArrayHandle<Scalar4>(m_pos, access_location::host, access_mode::read));
+    if (need_vel)
+        h_vel.reset(new ArrayHandle<Scalar4>(m_vel, access_location::host, access_mode::read));
+    if (fields[snapshot_field::acceleration])
+        h_accel.reset(new ArrayHandle<Scalar3>(m_accel, access_location::host, access_mode::read));
+    if (fields[snapshot_field::charge])
+        h_charge.reset(
+            new ArrayHandle<Scalar>(m_charge, access_location::host, access_mode::read));
+    if (fields[snapshot_field::diameter])
+        h_diameter.reset(
+            new ArrayHandle<Scalar>(m_diameter, access_location::host, access_mode::read));
+    if (need_image)
+        h_image.reset(new ArrayHandle<int3>(m_image, access_location::host, access_mode::read));
+    if (fields[snapshot_field::body])
+        h_body.reset(
+            new ArrayHandle<unsigned int>(m_body, access_location::host, access_mode::read));
+    if (fields[snapshot_field::orientation])
+        h_orientation.reset(
+            new ArrayHandle<Scalar4>(m_orientation, access_location::host, access_mode::read));
+    if (fields[snapshot_field::angmom])
+        h_angmom.reset(
+            new ArrayHandle<Scalar4>(m_angmom, access_location::host, access_mode::read));
+    if (fields[snapshot_field::inertia])
+        h_inertia.reset(
+            new ArrayHandle<Scalar3>(m_inertia, access_location::host, access_mode::read));
+
+    // the particles to copy into the snapshot, in any order
+    unsigned int n_particles = m_nparticles;
+    const unsigned int* tag = h_tag.data;
+    const Scalar4* pos = h_pos ? h_pos->data : nullptr;
+    const Scalar4* vel = h_vel ? h_vel->data : nullptr;
+    const Scalar3* accel = h_accel ? h_accel->data : nullptr;
+    const Scalar* charge = h_charge ? h_charge->data : nullptr;
+    const Scalar* diameter = h_diameter ? h_diameter->data : nullptr;
+    const int3* image = h_image ? h_image->data : nullptr;
+    const unsigned int* body = h_body ? h_body->data : nullptr;
+    const Scalar4* orientation = h_orientation ? h_orientation->data : nullptr;
+    const Scalar4* angmom = h_angmom ? h_angmom->data : nullptr;
+    const Scalar3* inertia = h_inertia ? h_inertia->data : nullptr;
+
+    bool root = true;
 #ifdef ENABLE_MPI
     if (m_decomposition)
         {
-        // gather a global snapshot
-        std::vector<Scalar3> pos(m_nparticles);
-        std::vector<Scalar3> vel(m_nparticles);
-        std::vector<Scalar3> accel(m_nparticles);
-        std::vector<unsigned int> type(m_nparticles);
-        std::vector<Scalar> mass(m_nparticles);
-        std::vector<Scalar> charge(m_nparticles);
-        std::vector<Scalar> diameter(m_nparticles);
-        std::vector<int3> image(m_nparticles);
-        std::vector<unsigned int> body(m_nparticles);
-        std::vector<Scalar4> orientation(m_nparticles);
-        std::vector<Scalar4> angmom(m_nparticles);
-        std::vector<Scalar3> inertia(m_nparticles);
-        std::vector<unsigned int> tag(m_nparticles);
-        std::map<unsigned int, unsigned int> rtag_map;
-        for (unsigned int idx = 0; idx < m_nparticles; idx++)
-            {
-            pos[idx]
-                = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z) - m_origin;
-            vel[idx] = make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z);
-            accel[idx] = h_accel.data[idx];
-            type[idx] = __scalar_as_int(h_pos.data[idx].w);
-            mass[idx] = h_vel.data[idx].w;
-            charge[idx] = h_charge.data[idx];
-            diameter[idx] = h_diameter.data[idx];
-            image[idx] = h_image.data[idx];
-            image[idx].x -= m_o_image.x;
-            image[idx].y -= m_o_image.y;
-            image[idx].z -= m_o_image.z;
-            body[idx] = h_body.data[idx];
-            orientation[idx] = h_orientation.data[idx];
-            angmom[idx] = h_angmom.data[idx];
-            inertia[idx] = h_inertia.data[idx];
-
-            // insert reverse lookup global tag -> idx
-            rtag_map.insert(std::pair<unsigned int, unsigned int>(h_tag.data[idx], idx));
-            }
-
-        std::vector<std::vector<Scalar3>> pos_proc;       // Position array of every processor
-        std::vector<std::vector<Scalar3>> vel_proc;       // Velocities array of every processor
-        std::vector<std::vector<Scalar3>> accel_proc;     // Accelerations array of every processor
-        std::vector<std::vector<unsigned int>> type_proc; // Particle types array of every processor
-        std::vector<std::vector<Scalar>> mass_proc;   // Particle masses array of every processor
-        std::vector<std::vector<Scalar>> charge_proc; // Particle charges array of every processor
-        std::vector<std::vector<Scalar>>
-            diameter_proc;                         // Particle diameters array of every processor
-        std::vector<std::vector<int3>> image_proc; // Particle images array of every processor
-        std::vector<std::vector<unsigned int>> body_proc;   // Body ids of every processor
-        std::vector<std::vector<Scalar4>> orientation_proc; // Orientations of every processor
-        std::vector<std::vector<Scalar4>> angmom_proc;      // Angular momenta of every processor
-        std::vector<std::vector<Scalar3>> inertia_proc;     // Moments of inertia of every processor
-
-        std::vector<std::map<unsigned int, unsigned int>>
-            rtag_map_proc; // List of reverse-lookup maps
-
+        // gather the selected arrays on the root rank
         const MPI_Comm mpi_comm = m_exec_conf->getMPICommunicator();
-        unsigned int size = m_exec_conf->getNRanks();
-        unsigned int rank = m_exec_conf->getRank();
+        root = m_exec_conf->isRoot();
+        SnapshotGatherBuffers& buf = m_snapshot_gather;
 
-        // resize to number of ranks in communicator
-        pos_proc.resize(size);
-        vel_proc.resize(size);
-        accel_proc.resize(size);
-        type_proc.resize(size);
-        mass_proc.resize(size);
-        charge_proc.resize(size);
-        diameter_proc.resize(size);
-        image_proc.resize(size);
-        body_proc.resize(size);
-        orientation_proc.resize(size);
-        angmom_proc.resize(size);
-        inertia_proc.resize(size);
-        rtag_map_proc.resize(size);
-
-        unsigned int root = 0;
-
-        // collect all particle data on the root processor
-        gather_v(pos, pos_proc, root, mpi_comm);
-        gather_v(vel, vel_proc, root, mpi_comm);
-        gather_v(accel, accel_proc, root, mpi_comm);
-        gather_v(type, type_proc, root, mpi_comm);
-        gather_v(mass, mass_proc, root, mpi_comm);
-        gather_v(charge, charge_proc, root, mpi_comm);
-        gather_v(diameter, diameter_proc, root, mpi_comm);
-        gather_v(image, image_proc, root, mpi_comm);
-        gather_v(body, body_proc, root, mpi_comm);
-        gather_v(orientation, orientation_proc, root, mpi_comm);
-        gather_v(angmom, angmom_proc, root, mpi_comm);
-        gather_v(inertia, inertia_proc, root, mpi_comm);
-
-        // gather the reverse-lookup maps
-        gather_v(rtag_map, rtag_map_proc, root, mpi_comm);
-
-        if (rank == root)
+        unsigned int n_ranks = m_exec_conf->getNRanks();
+        int n_local = int(m_nparticles);
+        if (root)
             {
-            // allocate memory in snapshot
-            snapshot.resize(getNGlobal());
-
-            unsigned int n_ranks = m_exec_conf->getNRanks();
-            assert(rtag_map_proc.size() == n_ranks);
-
-            // create single map of all particle ranks and indices
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>> rank_rtag_map;
-            std::map<unsigned int, unsigned int>::iterator it;
-            for (unsigned int irank = 0; irank < n_ranks; ++irank)
-                for (it = rtag_map_proc[irank].begin(); it != rtag_map_proc[irank].end(); ++it)
-                    rank_rtag_map.insert(
-                        std::pair<unsigned int, std::pair<unsigned int, unsigned int>>(
-                            it->first,
-                            std::pair<unsigned int, unsigned int>(irank, it->second)));
-
-            // add particles to snapshot
-            assert(m_tag_set.size() == getNGlobal());
-            std::set<unsigned int>::const_iterator tag_set_it = m_tag_set.begin();
-
-            std::map<unsigned int, std::pair<unsigned int, unsigned int>>::iterator rank_rtag_it;
-            for (unsigned int snap_id = 0; snap_id < getNGlobal(); snap_id++)
-                {
-                unsigned int tag = *tag_set_it;
-                assert(tag <= getMaximumTag());
-                rank_rtag_it = rank_rtag_map.find(tag);
-
-                if (rank_rtag_it == rank_rtag_map.end())
-                    {
-                    ostringstream o;
-                    o << "Error gathering ParticleData: Could not find particle " << tag
-                      << " on any processor.";
-                    throw std::runtime_error(o.str());
-                    }
+            buf.counts.resize(n_ranks);
+            buf.displs.resize(n_ranks);
+            }
+        MPI_Gather(&n_local, 1, MPI_INT, buf.counts.data(), 1, MPI_INT, 0, mpi_comm);
+        if (root)
+            {
+            for (unsigned int i = 0; i < n_ranks; i++)
+                buf.displs[i] = (i > 0) ? buf.displs[i - 1] + buf.counts[i - 1] : 0;
+            n_particles = buf.displs.back() + buf.counts.back();
+            }
 
-                // rank contains the processor rank on which the particle was found
-                std::pair<unsigned int, unsigned int> rank_idx = rank_rtag_it->second;
-                unsigned int rank = rank_idx.first;
-                unsigned int idx = rank_idx.second;
-
-                // store tag in index map
-                index.insert(std::make_pair(tag, snap_id));
-
-                snapshot.pos[snap_id] = vec3<Real>(pos_proc[rank][idx]);
-                snapshot.vel[snap_id] = vec3<Real>(vel_proc[rank][idx]);
-                snapshot.accel[snap_id] = vec3<Real>(accel_proc[rank][idx]);
-                snapshot.type[snap_id] = type_proc[rank][idx];
-                snapshot.mass[snap_id] = Real(mass_proc[rank][idx]);
-                snapshot.charge[snap_id] = Real(charge_proc[rank][idx]);
-                snapshot.diameter[snap_id] = Real(diameter_proc[rank][idx]);
-                snapshot.image[snap_id] = image_proc[rank][idx];
-                snapshot.body[snap_id] = body_proc[rank][idx];
-                snapshot.orientation[snap_id] = quat<Real>(orientation_proc[rank][idx]);
-                snapshot.angmom[snap_id] = quat<Real>(angmom_proc[rank][idx]);
-                snapshot.inertia[snap_id] = vec3<Real>(inertia_proc[rank][idx]);
-
-                // make sure the position stored in the snapshot is within the boundaries
-                Scalar3 tmp = vec_to_scalar3(snapshot.pos[snap_id]);
-                m_global_box.wrap(tmp, snapshot.image[snap_id]);
-                snapshot.pos[snap_id] = vec3<Real>(tmp);
+        gather_snapshot_array(tag, m_nparticles, buf.tag, buf, root, mpi_comm);
+        tag = buf.tag.data();
 
-                std::advance(tag_set_it, 1);
-                }
+        if (pos)
+            {
+            gather_snapshot_array(pos, m_nparticles, buf.pos, buf, root, mpi_comm);
+            pos = buf.pos.data();
+            }
+        if (vel)
+            {
+            gather_snapshot_array(vel, m_nparticles, buf.vel, buf, root, mpi_comm);
+            vel = buf.vel.data();
+            }
+        if (accel)
+            {
+            gather_snapshot_array(accel, m_nparticles, buf.accel, buf, root, mpi_comm);
+            accel = buf.accel.data();
+            }
+        if (charge)
+            {
+            gather_snapshot_array(charge, m_nparticles, buf.charge, buf, root, mpi_comm);
+            charge = buf.charge.data();
+            }
+        if (diameter)
+            {
+            gather_snapshot_array(diameter, m_nparticles, buf.diameter, buf, root, mpi_comm);
+            diameter = buf.diameter.data();
+            }
+        if (image)
+            {
+            gather_snapshot_array(image, m_nparticles, buf.image, buf, root, mpi_comm);
+            image = buf.image.data();
+            }
+        if (body)
+            {
+            gather_snapshot_array(body, m_nparticles, buf.body, buf, root, mpi_comm);
+            body = buf.body.data();
+            }
+        if (orientation)
+            {
+            gather_snapshot_array(orientation,
+                                  m_nparticles,
+                                  buf.orientation,
+                                  buf,
+                                  root,
+                                  mpi_comm);
+            orientation = buf.orientation.data();
+            }
+        if (angmom)
+            {
+            gather_snapshot_array(angmom, m_nparticles, buf.angmom, buf, root, mpi_comm);
+            angmom = buf.angmom.data();
+            }
+        if (inertia)
+            {
+            gather_snapshot_array(inertia, m_nparticles, buf.inertia, buf, root, mpi_comm);
+            inertia = buf.inertia.data();
             }
         }
-    else
 #endif
+
+    if (!root)
+        return;
+
+    if (n_particles != getNGlobal())
         {
-        // allocate memory in snapshot
-        snapshot.resize(getNGlobal());
+        ostringstream o;
+        o << "Error gathering ParticleData: found " << n_particles << " of " << getNGlobal()
+          << " particles.";
+        throw std::runtime_error(o.str());
+        }
+
+    // allocate memory in snapshot
+    snapshot.resize(getNGlobal());
+
+    // particles are stored in the snapshot in tag order
+    assert(m_tag_set.size() == getNGlobal());
+    index.assign(m_tag_set.empty() ? 0 : getMaximumTag() + 1, NOT_LOCAL);
+    unsigned int n_active = 0;
+    for (unsigned int t : m_tag_set)
+        index[t] = n_active++;
 
-        assert(m_tag_set.size() == m_nparticles);
-        std::set<unsigned int>::const_iterator it = m_tag_set.begin();
+    for (unsigned int i = 0; i < n_particles; i++)
+        {
+        assert(tag[i] < index.size());
+        unsigned int snap_id = index[tag[i]];
+        if (snap_id == NOT_LOCAL)
+            {
+            ostringstream o;
+            o << "Error gathering ParticleData: particle " << tag[i] << " is not active.";
+            throw std::runtime_error(o.str());
+            }
 
-        // iterate through active tags
-        for (unsigned int snap_id = 0; snap_id < m_nparticles; snap_id++)
+        if (need_image)
             {
-            unsigned int tag = *it;
-            assert(tag <= getMaximumTag());
-            unsigned int idx = h_rtag.data[tag];
-            assert(idx < m_nparticles);
-
-            // store tag in index map
-            index.insert(std::make_pair(tag, snap_id));
-
-            snapshot.pos[snap_id] = vec3<Real>(
-                make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z) - m_origin);
-            snapshot.vel[snap_id]
-                = vec3<Real>(make_scalar3(h_vel.data[idx].x, h_vel.data[idx].y, h_vel.data[idx].z));
-            snapshot.accel[snap_id] = vec3<Real>(h_accel.data[idx]);
-            snapshot.type[snap_id] = __scalar_as_int(h_pos.data[idx].w);
-            snapshot.mass[snap_id] = Real(h_vel.data[idx].w);
-            snapshot.charge[snap_id] = Real(h_charge.data[idx]);
-            snapshot.diameter[snap_id] = Real(h_diameter.data[idx]);
-            snapshot.image[snap_id] = h_image.data[idx];
-            snapshot.image[snap_id].x -= m_o_image.x;
-            snapshot.image[snap_id].y -= m_o_image.y;
-            snapshot.image[snap_id].z -= m_o_image.z;
-            snapshot.body[snap_id] = h_body.data[idx];
-            snapshot.orientation[snap_id] = quat<Real>(h_orientation.data[idx]);
-            snapshot.angmom[snap_id] = quat<Real>(h_angmom.data[idx]);
-            snapshot.inertia[snap_id] = vec3<Real>(h_inertia.data[idx]);
+            int3 img = image[i];
+            img.x -= m_o_image.x;
+            img.y -= m_o_image.y;
+            img.z -= m_o_image.z;
 
             // make sure the position stored in the snapshot is within the boundaries
-            Scalar3 tmp = vec_to_scalar3(snapshot.pos[snap_id]);
-            m_global_box.wrap(tmp, snapshot.image[snap_id]);
-            snapshot.pos[snap_id] = vec3<Real>(tmp);
+            Scalar3 tmp = make_scalar3(pos[i].x, pos[i].y, pos[i].z) - m_origin;
+            tmp = vec_to_scalar3(vec3<Real>(tmp));
+            m_global_box.wrap(tmp, img);
 
-            std::advance(it, 1);
+            if (fields[snapshot_field::position])
+                snapshot.pos[snap_id] = vec3<Real>(tmp);
+            if (fields[snapshot_field::image])
+                snapshot.image[snap_id] = img;
             }
+        if (fields[snapshot_field::type])
+            snapshot.type[snap_id] = __scalar_as_int(pos[i].w);
+        if (fields[snapshot_field::velocity])
+            snapshot.vel[snap_id] = vec3<Real>(make_scalar3(vel[i].x, vel[i].y, vel[i].z));
+        if (fields[snapshot_field::mass])
+            snapshot.mass[snap_id] = Real(vel[i].w);
+        if (accel)
+            snapshot.accel[snap_id] = vec3<Real>(accel[i]);
+        if (charge)
+            snapshot.charge[snap_id] = Real(charge[i]);
+        if (diameter)
+            snapshot.diameter[snap_id] = Real(diameter[i]);
+        if (body)
+            snapshot.body[snap_id] = body[i];
+        if (orientation)
+            snapshot.orientation[snap_id] = quat<Real>(orientation[i]);
+        if (angmom)
+            snapshot.angmom[snap_id] = quat<Real>(angmom[i]);
+        if (inertia)
+            snapshot.inertia[snap_id] = vec3<Real>(inertia[i]);
         }
 
     snapshot.type_mapping = m_type_mapping;
 
     // copy over acceleration set flag (this is a copy in case users take a snapshot before running)
     snapshot.is_accel_set = m_accel_set;
-
-    return index;
     }
 
 //! Add ghost particles at the end of the local particle data
@@ -2718,6 +2773,9 @@ ParticleData::initializeFromSnapshot<double>(const SnapshotParticleData<double>&
                                              bool ignore_bodies);
 template std::map<unsigned int, unsigned int>
 ParticleData::takeSnapshot<double>(SnapshotParticleData<double>& snapshot);
+template void ParticleData::takeSnapshot<double>(SnapshotParticleData<double>& snapshot,
+                                           SnapshotFields fields,
+                                           std::vector<unsigned int>& index);
 
 template ParticleData::ParticleData(const SnapshotParticleData<float>& snapshot,
                                     const BoxDim& global_box,
@@ -2728,6 +2786,9 @@ ParticleData::initializeFromSnapshot<float>(const SnapshotParticleData<float>& s
                                             bool ignore_bodies);
 template std::map<unsigned int, unsigned int>
 ParticleData::takeSnapshot<float>(SnapshotParticleData<float>& snapshot);
+template void ParticleData::takeSnapshot<float>(SnapshotParticleData<float>& snapshot,
+                                           SnapshotFields fields,
+                                           std::vector<unsigned int>& index);
 
 namespace detail
     {
@@ -90,6 +90,30 @@ struct pdata_flag
 //! valid
 typedef std::bitset<32> PDataFlags;
 
+//! List of fields that can be selected in a particle data snapshot
+struct snapshot_field
+    {
+    //! The enum
+    enum Enum
+        {
+        position = 0, //!< Bit id in SnapshotFields for the position
+        velocity,     //!< Bit id in SnapshotFields for the velocity
+        acceleration, //!< Bit id in SnapshotFields for the acceleration
+        type,         //!< Bit id in SnapshotFields for the type id
+        mass,         //!< Bit id in SnapshotFields for the mass
+        charge,       //!< Bit id in SnapshotFields for the charge
+        diameter,     //!< Bit id in SnapshotFields for the diameter
+        image,        //!< Bit id in SnapshotFields for the image
+        body,         //!< Bit id in SnapshotFields for the body id
+        orientation,  //!< Bit id in SnapshotFields for the orientation
+        angmom,       //!< Bit id in SnapshotFields for the angular momentum
+        inertia       //!< Bit id in SnapshotFields for the moment of inertia
+        };
+    };
+
+//! Selects the fields ParticleData::takeSnapshot() copies into a snapshot
+typedef std::bitset<32> SnapshotFields;
+
 //! Defines a simple structure to deal with complex numbers
 /*! This structure is useful to deal with complex numbers for such situations
     as Fourier transforms. Note that we do not need any to define any operations and the
@@ -1173,6 +1197,12 @@ class PYBIND11_EXPORT ParticleData
     template<class Real>
     std::map<unsigned int, unsigned int> takeSnapshot(SnapshotParticleData<Real>& snapshot);
 
+    //! Take a snapshot of selected fields
+    template<class Real>
+    void takeSnapshot(SnapshotParticleData<Real>& snapshot,
+                      SnapshotFields fields,
+                      std::vector<unsigned int>& index);
+
     //! Add ghost particles at the end of the local particle data
     void addGhostParticles(const unsigned int nghosts);
 
@@ -1346,6 +1376,28 @@ class PYBIND11_EXPORT ParticleData
         m_cached_tag_set;       //!< Cached constant-time lookup table for tags by active index
     bool m_invalid_cached_tags; //!< true if m_cached_tag_set needs to be rebuilt
 
+#ifdef ENABLE_MPI
+    //! Particle data of all ranks, gathered on the root rank by takeSnapshot()
+    struct SnapshotGatherBuffers
+        {
+        std::vector<unsigned int> tag;    //!< Tags
+        std::vector<Scalar4> pos;         //!< Positions and types
+        std::vector<Scalar4> vel;         //!< Velocities and masses
+        std::vector<Scalar3> accel;       //!< Accelerations
+        std::vector<Scalar> charge;       //!< Charges
+        std::vector<Scalar> diameter;     //!< Diameters
+        std::vector<int3> image;          //!< Images
+        std::vector<unsigned int> body;   //!< Body ids
+        std::vector<Scalar4> orientation; //!< Orientations
+        std::vector<Scalar4> angmom;      //!< Angular momenta
+        std::vector<Scalar3> inertia;     //!< Moments of inertia
+        std::vector<int> counts;          //!< Number of particles per rank
+        std::vector<int> displs;          //!< Offset of the particles of each rank
+        };
+
+    SnapshotGatherBuffers m_snapshot_gather; //!< Reused between snapshots to avoid allocations
+#endif
+
     /* Alternate particle data arrays are provided for fast swapping in and out of particle data
        The size of these arrays is updated in sync with the main particle data arrays.
 
@@ -183,6 +183,10 @@ void System::run(uint64_t nsteps, bool write_at_start)
             }
         }
 
+    // complete any output deferred by the analyzers
+    for (auto& analyzer_trigger_pair : m_analyzers)
+        analyzer_trigger_pair.first->finalizeRun();
+
 #ifdef ENABLE_MPI
     // make sure all ranks return the same TPS after the run completes
     if (m_sysdef->isDomainDecomposed())
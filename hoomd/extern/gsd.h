@@ -532,6 +532,43 @@ gsd_find_chunk(struct gsd_handle* handle, uint64_t frame, const char* name);
 */
 int gsd_read_chunk(struct gsd_handle* handle, void* data, const struct gsd_index_entry* chunk);
 
+/** Reserve space for a data chunk in the current frame
+
+    @param handle Handle to an open GSD file.
+    @param name Name of the data chunk.
+    @param type type ID that identifies the type of data in the chunk.
+    @param N Number of rows in the data.
+    @param M Number of columns in the data.
+    @param flags set to 0, non-zero values reserved for future use.
+    @param location Output: offset in the file where the chunk data must be written.
+
+    @pre *handle* was opened by gsd_open().
+    @pre *name* is a unique name for data chunks in the given frame.
+
+    @post `N * M * gsd_sizeof_type(type)` bytes are reserved at the end of the file and the chunk is
+    added to the in-memory index of the current frame.
+
+    Use gsd_reserve_chunk() when the chunk data is written by other means (such as collective MPI-IO
+    from several processes). The caller must write the data to *location* before calling
+    gsd_end_frame(), which writes the index entry that makes the chunk visible to readers.
+
+    @return
+      - GSD_SUCCESS (0) on success. Negative value on failure:
+      - GSD_ERROR_IO: IO error (check errno).
+      - GSD_ERROR_INVALID_ARGUMENT: *handle* is NULL, *M* == 0, *type* is invalid, or
+        *flags* != 0.
+      - GSD_ERROR_FILE_MUST_BE_WRITABLE: The file was opened read-only.
+      - GSD_ERROR_NAMELIST_FULL: The file cannot store any additional unique chunk names.
+      - GSD_ERROR_MEMORY_ALLOCATION_FAILED: failed to allocate memory.
+*/
+int gsd_reserve_chunk(struct gsd_handle* handle,
+                      const char* name,
+                      enum gsd_type type,
+                      uint64_t N,
+                      uint32_t M,
+                      uint8_t flags,
+                      int64_t* location);
+
 /** Get the number of frames in the GSD file
 
     @param handle Handle to an open GSD file
@@ -99,6 +99,8 @@ std::unique_ptr<llvm::Module> ClangCompiler::compileCode(const std::string& code
     clang_args.push_back("-D");
     clang_args.push_back("HOOMD_LLVMJIT_BUILD");
     clang_args.push_back("--std=c++14");
+    // optimize the generated code, eval_batch relies on the loop vectorizer
+    clang_args.push_back("-O3");
     // prevent the driver from creating empty output files in /tmp
     clang_args.push_back("-S");
     clang_args.push_back("-emit-llvm");
@@ -34,6 +34,10 @@ struct hpmc_counters_t
     unsigned long long int overlap_checks;         //!< Count of the number of overlap checks
     unsigned int
         overlap_err_count; //!< Count of the number of times overlap checks encounter errors
+    unsigned long long int
+        neighbor_cache_hits; //!< Count of trial moves checked against the candidate neighbor cache
+    unsigned long long int
+        neighbor_cache_rebuilds; //!< Count of the number of candidate neighbor cache builds
 
     //! Construct a zero set of counters
     DEVICE hpmc_counters_t()
@@ -44,6 +48,8 @@ struct hpmc_counters_t
         rotate_reject_count = 0;
         overlap_checks = 0;
         overlap_err_count = 0;
+        neighbor_cache_hits = 0;
+        neighbor_cache_rebuilds = 0;
         }
 
 #ifndef NVCC
@@ -84,6 +90,8 @@ DEVICE inline hpmc_counters_t operator-(const hpmc_counters_t& a, const hpmc_cou
     result.rotate_reject_count = a.rotate_reject_count - b.rotate_reject_count;
     result.overlap_checks = a.overlap_checks - b.overlap_checks;
     result.overlap_err_count = a.overlap_err_count - b.overlap_err_count;
+    result.neighbor_cache_hits = a.neighbor_cache_hits - b.neighbor_cache_hits;
+    result.neighbor_cache_rebuilds = a.neighbor_cache_rebuilds - b.neighbor_cache_rebuilds;
     return result;
     }
 
@@ -97,6 +105,8 @@ DEVICE inline hpmc_counters_t operator+(const hpmc_counters_t& a, const hpmc_cou
     result.rotate_reject_count = a.rotate_reject_count + b.rotate_reject_count;
     result.overlap_checks = a.overlap_checks + b.overlap_checks;
     result.overlap_err_count = a.overlap_err_count + b.overlap_err_count;
+    result.neighbor_cache_hits = a.neighbor_cache_hits + b.neighbor_cache_hits;
+    result.neighbor_cache_rebuilds = a.neighbor_cache_rebuilds + b.neighbor_cache_rebuilds;
     return result;
     }
 
@@ -222,6 +222,18 @@ hpmc_counters_t IntegratorHPMC::getCounters(unsigned int mode)
                       MPI_UNSIGNED,
                       MPI_SUM,
                       m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &result.neighbor_cache_hits,
+                      1,
+                      MPI_LONG_LONG_INT,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &result.neighbor_cache_rebuilds,
+                      1,
+                      MPI_LONG_LONG_INT,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
         }
 #endif
     return result;
@@ -251,11 +263,16 @@ void export_IntegratorHPMC(pybind11::module& m)
         .def_property("nselect", &IntegratorHPMC::getNSelect, &IntegratorHPMC::setNSelect)
         .def_property("translation_move_probability",
                       &IntegratorHPMC::getTranslationMoveProbability,
-                      &IntegratorHPMC::setTranslationMoveProbability);
+                      &IntegratorHPMC::setTranslationMoveProbability)
+        .def_property("neighbor_cache",
+                      &IntegratorHPMC::getNeighborCache,
+                      &IntegratorHPMC::setNeighborCache);
 
     pybind11::class_<hpmc_counters_t>(m, "hpmc_counters_t")
         .def_readonly("overlap_checks", &hpmc_counters_t::overlap_checks)
         .def_readonly("overlap_errors", &hpmc_counters_t::overlap_err_count)
+        .def_readonly("neighbor_cache_hits", &hpmc_counters_t::neighbor_cache_hits)
+        .def_readonly("neighbor_cache_rebuilds", &hpmc_counters_t::neighbor_cache_rebuilds)
         .def_property_readonly("translate", &hpmc_counters_t::getTranslateCounts)
         .def_property_readonly("rotate", &hpmc_counters_t::getRotateCounts);
     }
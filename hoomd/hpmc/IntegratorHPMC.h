@@ -18,6 +18,7 @@
 
 #include "ExternalField.h"
 #include "HPMCCounters.h"
+#include "PatchEnergyBatch.h"
 
 #ifndef __HIPCC__
 #include <pybind11/pybind11.h>
@@ -169,6 +170,37 @@ class PatchEnergy
         return 0;
         }
 
+    //! evaluate the energies of the patch interactions between particle i and a batch of particles
+    /*! \param type_i Integer type index of particle i
+        \param q_i Orientation quaternion of particle i
+        \param d_i Diameter of particle i
+        \param charge_i Charge of particle i
+        \param batch The j particles. On return, batch.energy[k] holds the energy of pair k.
+
+        The default implementation calls energy() once per pair.
+    */
+    virtual void energyBatch(unsigned int type_i,
+                             const quat<float>& q_i,
+                             float d_i,
+                             float charge_i,
+                             PatchEnergyBatch& batch)
+        {
+        for (unsigned int k = 0; k < batch.n; k++)
+            {
+            vec3<float> r_ij(batch.r_x[k], batch.r_y[k], batch.r_z[k]);
+            quat<float> q_j(batch.q_s[k], vec3<float>(batch.q_x[k], batch.q_y[k], batch.q_z[k]));
+            batch.energy[k] = energy(r_ij,
+                                     type_i,
+                                     q_i,
+                                     d_i,
+                                     charge_i,
+                                     batch.type_j[k],
+                                     q_j,
+                                     batch.d_j[k],
+                                     batch.charge_j[k]);
+            }
+        }
+
 #ifdef ENABLE_HIP
     //! Set autotuner parameters
     /*! \param enable Enable/disable autotuning
@@ -339,6 +371,18 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
         return m_nselect;
         }
 
+    //! Enable or disable the per-sweep candidate neighbor cache
+    void setNeighborCache(bool neighbor_cache)
+        {
+        m_neighbor_cache = neighbor_cache;
+        }
+
+    //! Get whether the per-sweep candidate neighbor cache is enabled
+    bool getNeighborCache()
+        {
+        return m_neighbor_cache;
+        }
+
     //! Get performance in moves per second
     virtual double getMPS()
         {
@@ -449,6 +493,7 @@ class PYBIND11_EXPORT IntegratorHPMC : public Integrator
     protected:
     unsigned int m_translation_move_probability; //!< Fraction of moves that are translation moves.
     unsigned int m_nselect;                      //!< Number of particles to select for trial moves
+    bool m_neighbor_cache = false; //!< Use the per-sweep candidate neighbor cache for trial moves
 
     GPUVector<Scalar> m_d; //!< Maximum move displacement by type
     GPUVector<Scalar> m_a; //!< Maximum angular displacement by type
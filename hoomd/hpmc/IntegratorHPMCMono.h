@@ -265,6 +265,21 @@ class IntegratorHPMCMono : public IntegratorHPMC
             this->m_external_base = (ExternalField*)external.get();
             }
 
+        //! Enable or disable the near-contact pair cache in box moves
+        /*! When disabled, every box move uses the full overlap check. The results are identical.
+        */
+        void setBoxPairCacheEnabled(bool enabled)
+            {
+            m_box_pair_cache_enabled = enabled;
+            m_box_pair_cache_valid = false;
+            }
+
+        //! Get whether box moves use the near-contact pair cache
+        bool getBoxPairCacheEnabled()
+            {
+            return m_box_pair_cache_enabled;
+            }
+
         //! Get the particle parameters
         virtual std::vector<param_type, hoomd::detail::managed_allocator<param_type> >& getParams()
             {
@@ -433,6 +448,12 @@ class IntegratorHPMCMono : public IntegratorHPMC
 
         void invalidateAABBTree(){ m_aabb_tree_invalid = true; }
 
+        //! Add a particle to the system and to the AABB tree
+        unsigned int insertParticle(unsigned int type, const vec3<Scalar>& pos, const quat<Scalar>& orientation);
+
+        //! Remove a particle from the system and from the AABB tree
+        void removeParticle(unsigned int tag);
+
         //! Method that is called whenever the GSD file is written if connected to a GSD file.
         int slotWriteGSDState(gsd_handle&, std::string name) const;
 
@@ -487,6 +508,9 @@ class IntegratorHPMCMono : public IntegratorHPMC
         hoomd::detail::AABB* m_aabbs;                      //!< list of AABBs, one per particle
         unsigned int m_aabbs_capacity;              //!< Capacity of m_aabbs list
         bool m_aabb_tree_invalid;                   //!< Flag if the aabb tree has been invalidated
+        bool m_aabb_tree_refit_valid;               //!< Flag if the aabb tree topology can be refit
+        Scalar m_aabb_tree_build_cost;              //!< Cost of the aabb tree after the last full build
+        bool m_aabb_tree_incremental;               //!< True while the tree is updated incrementally on a particle sort
 
         Scalar m_extra_image_width;                 //! Extra width to extend the image list
 
@@ -512,9 +536,62 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! Set the nominal width appropriate for looped moves
         virtual void updateCellWidth();
 
+        #ifdef ENABLE_TBB
+        std::vector<unsigned int> m_checkerboard_cell_start;     //!< First entry of each cell in m_checkerboard_particles
+        std::vector<unsigned int> m_checkerboard_particles;      //!< Particles sorted by checkerboard cell
+        std::vector<unsigned int> m_checkerboard_cell;           //!< Checkerboard cell of each particle
+        std::vector< std::vector<unsigned int> > m_checkerboard_color_cells; //!< Cells of each checkerboard color
+
+        //! Perform the trial moves of one step concurrently on a checkerboard of independent cells
+        bool updateCheckerboard(uint64_t timestep, hpmc_counters_t& counters);
+        #endif
+
+        std::vector<unsigned int> m_neighbor_cache_start;   //!< First candidate of each particle (N+1 entries)
+        std::vector<unsigned int> m_neighbor_cache_j;       //!< Candidate neighbor particle indices
+        std::vector<unsigned int> m_neighbor_cache_image;   //!< Image list index of each candidate
+
+        //! Find the candidate neighbors of every local particle for one sweep
+        void buildNeighborCache(hpmc_counters_t& counters);
+
+        /* Pairs near contact, used by attemptBoxResize() */
+
+        bool m_box_pair_cache_enabled;                      //!< True when box moves may use the cached pairs
+        bool m_box_pair_cache_valid;                        //!< True when the cached pairs may be used
+        BoxDim m_box_pair_cache_box;                        //!< Box in which the pairs were found
+        Scalar m_box_pair_cache_range;                      //!< Maximum separation of the cached pairs
+        std::vector<vec3<Scalar> > m_box_pair_cache_frac;   //!< Fractional coordinates when the pairs were found
+        std::vector<unsigned int> m_box_pair_cache_i;       //!< First particle of each pair
+        std::vector<unsigned int> m_box_pair_cache_j;       //!< Second particle of each pair
+        std::vector<int3> m_box_pair_cache_hkl;             //!< Image of the second particle
+        std::vector<vec3<Scalar> > m_box_resize_frac;       //!< Fractional coordinates of the current configuration
+        std::vector<int3> m_box_resize_shift;               //!< Periodic shift of each particle since the pairs were found
+
+        //! Find the pairs near contact in the current configuration
+        void buildBoxPairCache();
+
+        //! Bound the factor by which mapping vectors from box to into box from stretches them
+        Scalar getBoxStretchBound(const BoxDim& from, const BoxDim& to);
+
+        //! Scale the box and check only the cached pairs near contact for overlaps
+        bool attemptBoxResizeCached(const BoxDim& new_box, bool& result);
+
         //! Grow the m_aabbs list
         virtual void growAABBList(unsigned int N);
 
+        //! Get the AABB of a particle for the AABB tree
+        hoomd::detail::AABB getParticleAABB(const Scalar4& postype, const Scalar4& orientation)
+            {
+            unsigned int typ_i = __scalar_as_int(postype.w);
+            Shape shape(quat<Scalar>(orientation), m_params[typ_i]);
+
+            if (!this->m_patch)
+                return shape.getAABB(vec3<Scalar>(postype));
+
+            Scalar radius = std::max(0.5*shape.getCircumsphereDiameter(),
+                0.5*this->m_patch->getAdditiveCutoff(typ_i));
+            return hoomd::detail::AABB(vec3<Scalar>(postype), radius);
+            }
+
         //! Limit the maximum move distances
         virtual void limitMoveDistances();
 
@@ -531,7 +608,16 @@ class IntegratorHPMCMono : public IntegratorHPMC
         //! callback so that the particle sort signal can invalidate the AABB tree
         virtual void slotSorted()
             {
+            // the cached box move pairs refer to the old particle indices
+            m_box_pair_cache_valid = false;
+
+            // insertParticle() and removeParticle() update the tree themselves
+            if (m_aabb_tree_incremental)
+                return;
+
             m_aabb_tree_invalid = true;
+            // particles are reordered, the old tree topology no longer groups nearby particles
+            m_aabb_tree_refit_valid = false;
             }
     };
 
@@ -572,6 +658,13 @@ IntegratorHPMCMono<Shape>::IntegratorHPMCMono(std::shared_ptr<SystemDefinition>
     m_aabbs = NULL;
     m_aabbs_capacity = 0;
     m_aabb_tree_invalid = true;
+    m_aabb_tree_refit_valid = false;
+    m_aabb_tree_build_cost = 0;
+    m_aabb_tree_incremental = false;
+
+    m_box_pair_cache_enabled = true;
+    m_box_pair_cache_valid = false;
+    m_box_pair_cache_range = 0;
 
     m_depletant_idx = Index2D(this->m_pdata->getNTypes());
     m_fugacity.resize(m_depletant_idx.getNumElements(), 0.0);
@@ -693,11 +786,27 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
 
     uint16_t seed = m_sysdef->getSeed();
 
+    // move particles in independent cells concurrently when possible
+    bool checkerboard = false;
+    #ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1 && !has_depletants && !m_external && !m_sysdef->isDomainDecomposed())
+        {
+        checkerboard = updateCheckerboard(timestep, counters);
+        }
+    #endif
+
+    // find the candidate neighbors of each particle once for all nselect trial moves
+    bool neighbor_cache = m_neighbor_cache && !checkerboard;
+    if (neighbor_cache)
+        {
+        buildNeighborCache(counters);
+        }
+
     // access interaction matrix
     ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
 
-    // loop over local particles nselect times
-    for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
+    // loop over local particles nselect times (unless the checkerboard sweeps made the moves)
+    for (unsigned int i_nselect = 0; i_nselect < m_nselect && !checkerboard; i_nselect++)
         {
         // access particle data and system box
         ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
@@ -797,107 +906,146 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
             // patch + field interaction deltaU
             double patch_field_energy_diff = 0;
 
-            // check for overlaps with neighboring particle's positions (also calculate the new energy)
-            // All image boxes (including the primary)
-            const unsigned int n_images = (unsigned int)m_image_list.size();
-            for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            // patch interactions within the cutoff, evaluated in batches
+            PatchEnergyBatch patch_batch;
+            auto flush_patch_batch = [&](const quat<float>& q_i, double sign)
+                {
+                m_patch->energyBatch(typ_i, q_i, float(h_diameter.data[i]), float(h_charge.data[i]), patch_batch);
+                for (unsigned int k = 0; k < patch_batch.n; k++)
+                    patch_field_energy_diff += sign * patch_batch.energy[k];
+                patch_batch.clear();
+                };
+
+            // check for overlaps with particle j in image cur_image (also calculate the new energy)
+            auto check_new = [&](unsigned int j, unsigned int cur_image) -> bool
                 {
                 vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
-                hoomd::detail::AABB aabb = aabb_i_local;
-                aabb.translate(pos_i_image);
+                Scalar4 postype_j;
+                Scalar4 orientation_j;
 
-                // stackless search
-                for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                // handle j==i situations
+                if ( j != i )
                     {
-                    if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                    // load the position and orientation of the j particle
+                    postype_j = h_postype.data[j];
+                    orientation_j = h_orientation.data[j];
+                    }
+                else
+                    {
+                    if (cur_image == 0)
                         {
-                        if (m_aabb_tree.isNodeLeaf(cur_node_idx))
-                            {
-                            for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
-                                {
-                                // read in its position and orientation
-                                unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+                        // in the first image, skip i == j
+                        return false;
+                        }
+                    else
+                        {
+                        // If this is particle i and we are in an outside image, use the translated position and orientation
+                        postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
+                        orientation_j = quat_to_scalar4(shape_i.orientation);
+                        }
+                    }
 
-                                Scalar4 postype_j;
-                                Scalar4 orientation_j;
+                // put particles in coordinate system of particle i
+                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
 
-                                // handle j==i situations
-                                if ( j != i )
-                                    {
-                                    // load the position and orientation of the j particle
-                                    postype_j = h_postype.data[j];
-                                    orientation_j = h_orientation.data[j];
-                                    }
-                                else
-                                    {
-                                    if (cur_image == 0)
-                                        {
-                                        // in the first image, skip i == j
-                                        continue;
-                                        }
-                                    else
-                                        {
-                                        // If this is particle i and we are in an outside image, use the translated position and orientation
-                                        postype_j = make_scalar4(pos_i.x, pos_i.y, pos_i.z, postype_i.w);
-                                        orientation_j = quat_to_scalar4(shape_i.orientation);
-                                        }
-                                    }
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
+                Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
 
-                                // put particles in coordinate system of particle i
-                                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                Scalar rcut = 0.0;
+                if (m_patch)
+                    rcut = r_cut_patch + 0.5 *
+                        static_cast<OverlapReal>(m_patch->getAdditiveCutoff(typ_j));
 
-                                unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
+                counters.overlap_checks++;
+                if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                    && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                    && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
+                    {
+                    return true;
+                    }
+                else if (m_patch && dot(r_ij,r_ij) <= rcut*rcut) // If there is no overlap and m_patch is not NULL, calculate energy
+                    {
+                    // deltaU = U_old - U_new: subtract energy of new configuration
+                    patch_batch.push(r_ij, typ_j, quat<float>(orientation_j),
+                                     float(h_diameter.data[j]), float(h_charge.data[j]));
+                    if (patch_batch.full())
+                        flush_patch_batch(quat<float>(shape_i.orientation), -1.0);
+                    }
+                return false;
+                };
 
-                                Scalar rcut = 0.0;
-                                if (m_patch)
-                                    rcut = r_cut_patch + 0.5 *
-                                        static_cast<OverlapReal>(m_patch->getAdditiveCutoff(typ_j));
+            // add the patch energy of the old configuration with particle j in image cur_image
+            auto add_old_energy = [&](unsigned int j, unsigned int cur_image)
+                {
+                vec3<Scalar> pos_i_image = pos_old + m_image_list[cur_image];
+                Scalar4 postype_j;
+                Scalar4 orientation_j;
 
-                                counters.overlap_checks++;
-                                if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
-                                    && check_circumsphere_overlap(r_ij, shape_i, shape_j)
-                                    && test_overlap(r_ij, shape_i, shape_j, counters.overlap_err_count))
-                                    {
-                                    overlap = true;
-                                    break;
-                                    }
-                                else if (m_patch && dot(r_ij,r_ij) <= rcut*rcut) // If there is no overlap and m_patch is not NULL, calculate energy
-                                    {
-                                    // deltaU = U_old - U_new: subtract energy of new configuration
-                                    patch_field_energy_diff -= m_patch->energy(r_ij, typ_i,
-                                                               quat<float>(shape_i.orientation),
-                                                               float(h_diameter.data[i]),
-                                                               float(h_charge.data[i]),
-                                                               typ_j,
-                                                               quat<float>(orientation_j),
-                                                               float(h_diameter.data[j]),
-                                                               float(h_charge.data[j])
-                                                               );
-                                    }
-                                }
-                            }
+                // handle j==i situations
+                if ( j != i )
+                    {
+                    // load the position and orientation of the j particle
+                    postype_j = h_postype.data[j];
+                    orientation_j = h_orientation.data[j];
+                    }
+                else
+                    {
+                    if (cur_image == 0)
+                        {
+                        // in the first image, skip i == j
+                        return;
                         }
                     else
                         {
-                        // skip ahead
-                        cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                        // If this is particle i and we are in an outside image, use the translated position and orientation
+                        postype_j = make_scalar4(pos_old.x, pos_old.y, pos_old.z, postype_i.w);
+                        orientation_j = quat_to_scalar4(shape_old.orientation);
                         }
+                    }
 
-                    if (overlap)
-                        break;
-                    }  // end loop over AABB nodes
+                // put particles in coordinate system of particle i
+                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
 
-                if (overlap)
-                    break;
-                } // end loop over images
+                Scalar rcut = r_cut_patch + 0.5 * m_patch->getAdditiveCutoff(typ_j);
 
-            // calculate old patch energy only if m_patch not NULL and no overlaps
-            if (m_patch && !overlap)
+                // deltaU = U_old - U_new: add energy of old configuration
+                if (dot(r_ij,r_ij) <= rcut*rcut)
+                    {
+                    patch_batch.push(r_ij, typ_j, quat<float>(orientation_j),
+                                     float(h_diameter.data[j]), float(h_charge.data[j]));
+                    if (patch_batch.full())
+                        flush_patch_batch(quat<float>(orientation_i), 1.0);
+                    }
+                };
+
+            const unsigned int n_images = (unsigned int)m_image_list.size();
+            if (neighbor_cache)
                 {
+                // the candidates of i cover every position i and its neighbors can reach in this sweep
+                counters.neighbor_cache_hits++;
+                for (unsigned int k = m_neighbor_cache_start[i]; k < m_neighbor_cache_start[i+1] && !overlap; k++)
+                    {
+                    overlap = check_new(m_neighbor_cache_j[k], m_neighbor_cache_image[k]);
+                    }
+
+                if (m_patch && !overlap)
+                    {
+                    flush_patch_batch(quat<float>(shape_i.orientation), -1.0);
+                    for (unsigned int k = m_neighbor_cache_start[i]; k < m_neighbor_cache_start[i+1]; k++)
+                        {
+                        add_old_energy(m_neighbor_cache_j[k], m_neighbor_cache_image[k]);
+                        }
+                    flush_patch_batch(quat<float>(orientation_i), 1.0);
+                    }
+                }
+            else
+                {
+                // check for overlaps with neighboring particle's positions (also calculate the new energy)
+                // All image boxes (including the primary)
                 for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                     {
-                    vec3<Scalar> pos_i_image = pos_old + m_image_list[cur_image];
+                    vec3<Scalar> pos_i_image = pos_i + m_image_list[cur_image];
                     hoomd::detail::AABB aabb = aabb_i_local;
                     aabb.translate(pos_i_image);
 
@@ -910,52 +1058,11 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                                 {
                                 for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
                                     {
-                                    // read in its position and orientation
-                                    unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
-
-                                    Scalar4 postype_j;
-                                    Scalar4 orientation_j;
-
-                                    // handle j==i situations
-                                    if ( j != i )
-                                        {
-                                        // load the position and orientation of the j particle
-                                        postype_j = h_postype.data[j];
-                                        orientation_j = h_orientation.data[j];
-                                        }
-                                    else
+                                    if (check_new(m_aabb_tree.getNodeParticle(cur_node_idx, cur_p), cur_image))
                                         {
-                                        if (cur_image == 0)
-                                            {
-                                            // in the first image, skip i == j
-                                            continue;
-                                            }
-                                        else
-                                            {
-                                            // If this is particle i and we are in an outside image, use the translated position and orientation
-                                            postype_j = make_scalar4(pos_old.x, pos_old.y, pos_old.z, postype_i.w);
-                                            orientation_j = quat_to_scalar4(shape_old.orientation);
-                                            }
+                                        overlap = true;
+                                        break;
                                         }
-
-                                    // put particles in coordinate system of particle i
-                                    vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
-                                    unsigned int typ_j = __scalar_as_int(postype_j.w);
-                                    Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
-
-                                    Scalar rcut = r_cut_patch + 0.5 * m_patch->getAdditiveCutoff(typ_j);
-
-                                    // deltaU = U_old - U_new: add energy of old configuration
-                                    if (dot(r_ij,r_ij) <= rcut*rcut)
-                                        patch_field_energy_diff += m_patch->energy(r_ij,
-                                                                   typ_i,
-                                                                   quat<float>(orientation_i),
-                                                                   float(h_diameter.data[i]),
-                                                                   float(h_charge.data[i]),
-                                                                   typ_j,
-                                                                   quat<float>(orientation_j),
-                                                                   float(h_diameter.data[j]),
-                                                                   float(h_charge.data[j]));
                                     }
                                 }
                             }
@@ -964,9 +1071,48 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
                             // skip ahead
                             cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
                             }
+
+                        if (overlap)
+                            break;
                         }  // end loop over AABB nodes
+
+                    if (overlap)
+                        break;
                     } // end loop over images
-                } // end if (m_patch)
+
+                // calculate old patch energy only if m_patch not NULL and no overlaps
+                if (m_patch && !overlap)
+                    {
+                    flush_patch_batch(quat<float>(shape_i.orientation), -1.0);
+                    for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+                        {
+                        vec3<Scalar> pos_i_image = pos_old + m_image_list[cur_image];
+                        hoomd::detail::AABB aabb = aabb_i_local;
+                        aabb.translate(pos_i_image);
+
+                        // stackless search
+                        for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                            {
+                            if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                                {
+                                if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                                    {
+                                    for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                                        {
+                                        add_old_energy(m_aabb_tree.getNodeParticle(cur_node_idx, cur_p), cur_image);
+                                        }
+                                    }
+                                }
+                            else
+                                {
+                                // skip ahead
+                                cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                                }
+                            }  // end loop over AABB nodes
+                        } // end loop over images
+                    flush_patch_batch(quat<float>(orientation_i), 1.0);
+                    } // end if (m_patch)
+                }
 
             // Add external energetic contribution if there are no overlaps
             if (m_external && !overlap)
@@ -1086,6 +1232,308 @@ void IntegratorHPMCMono<Shape>::update(uint64_t timestep)
     m_mps = double(run_counters.getNMoves()) / cur_time;
     }
 
+#ifdef ENABLE_TBB
+/*! \param timestep Current time step
+    \param counters Counters to accumulate the move statistics in
+    \returns false when the box is too small for a checkerboard and update() must perform the moves
+
+    The box is split into a grid of cells at least m_nominal_width wide with an even number of
+    cells along every periodic direction. Cells are colored by the parity of their grid
+    coordinates, so two cells with the same color are separated by at least one cell of another
+    color. Trial moves that would take a particle out of its cell are rejected. Particles in two
+    cells with the same color therefore can never interact and the cells of one color are updated
+    concurrently while all other particles are fixed. The grid is shifted by a random offset every
+    step so that every configuration remains reachable, and the colors are visited in forward or
+    reverse order with equal probability in every sweep, mirroring the update order shuffle of the
+    serial moves.
+
+    Each trial move uses the same random number stream as in the serial loop, so the result does not
+    depend on the number of threads.
+*/
+template <class Shape>
+bool IntegratorHPMCMono<Shape>::updateCheckerboard(uint64_t timestep, hpmc_counters_t& counters)
+    {
+    const BoxDim& box = m_pdata->getBox();
+    unsigned int ndim = this->m_sysdef->getNDimensions();
+    const unsigned int N = m_pdata->getN();
+
+    if (m_nominal_width <= Scalar(0.0))
+        return false;
+
+    // use an even number of cells in every direction so that the coloring is periodic
+    Scalar3 npd = box.getNearestPlaneDistance();
+    uint3 dim = make_uint3((unsigned int)(npd.x / m_nominal_width) & ~1u,
+                           (unsigned int)(npd.y / m_nominal_width) & ~1u,
+                           ndim == 2 ? 1 : (unsigned int)(npd.z / m_nominal_width) & ~1u);
+    if (dim.x < 2 || dim.y < 2 || dim.z < 1 || (ndim == 3 && dim.z < 2))
+        return false;
+
+    uint16_t seed = m_sysdef->getSeed();
+    hoomd::RandomGenerator rng_grid(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoCheckerboard, timestep, seed),
+                                    hoomd::Counter(m_exec_conf->getRank()));
+    Scalar3 shift = make_scalar3(hoomd::detail::generate_canonical<Scalar>(rng_grid),
+                                 hoomd::detail::generate_canonical<Scalar>(rng_grid),
+                                 ndim == 2 ? Scalar(0.0) : hoomd::detail::generate_canonical<Scalar>(rng_grid));
+
+    Index3D cell_idx(dim.x, dim.y, dim.z);
+    auto cell_coord = [&box, &dim, &shift](const vec3<Scalar>& pos) -> int3
+        {
+        Scalar3 f = box.makeFraction(vec_to_scalar3(pos));
+        int3 c = make_int3(int(slow::floor(f.x * Scalar(dim.x) + shift.x)),
+                           int(slow::floor(f.y * Scalar(dim.y) + shift.y)),
+                           int(slow::floor(f.z * Scalar(dim.z) + shift.z)));
+        c.x = ((c.x % int(dim.x)) + int(dim.x)) % int(dim.x);
+        c.y = ((c.y % int(dim.y)) + int(dim.y)) % int(dim.y);
+        c.z = ((c.z % int(dim.z)) + int(dim.z)) % int(dim.z);
+        return c;
+        };
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::readwrite);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_a(m_a, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    // bin the particles, in update order within each cell
+    const unsigned int n_cells = cell_idx.getNumElements();
+    m_checkerboard_cell.resize(N);
+    m_checkerboard_cell_start.assign(n_cells + 1, 0);
+    m_checkerboard_particles.resize(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        int3 c = cell_coord(vec3<Scalar>(h_postype.data[i]));
+        m_checkerboard_cell[i] = cell_idx(c.x, c.y, c.z);
+        m_checkerboard_cell_start[m_checkerboard_cell[i] + 1]++;
+        }
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_checkerboard_cell_start[cell + 1] += m_checkerboard_cell_start[cell];
+
+    std::vector<unsigned int> cell_fill(m_checkerboard_cell_start.begin(), m_checkerboard_cell_start.end() - 1);
+    for (unsigned int cur_particle = 0; cur_particle < N; cur_particle++)
+        {
+        unsigned int i = m_update_order[cur_particle];
+        m_checkerboard_particles[cell_fill[m_checkerboard_cell[i]]++] = i;
+        }
+
+    const unsigned int n_colors = 1 << ndim;
+    m_checkerboard_color_cells.resize(n_colors);
+    for (unsigned int color = 0; color < n_colors; color++)
+        m_checkerboard_color_cells[color].clear();
+    for (unsigned int k = 0; k < dim.z; k++)
+        for (unsigned int j = 0; j < dim.y; j++)
+            for (unsigned int i = 0; i < dim.x; i++)
+                {
+                unsigned int cell = cell_idx(i, j, k);
+                if (m_checkerboard_cell_start[cell + 1] > m_checkerboard_cell_start[cell])
+                    m_checkerboard_color_cells[(i & 1) | ((j & 1) << 1) | ((k & 1) << 2)].push_back(cell);
+                }
+
+    // neighboring cells, without duplicates when there are only two cells in a direction
+    std::vector<int3> cell_offsets;
+    int max_dz = ndim == 2 ? 0 : 1;
+    for (int dz = -max_dz; dz <= max_dz; dz++)
+        for (int dy = (dim.y == 2 ? 0 : -1); dy <= 1; dy++)
+            for (int dx = (dim.x == 2 ? 0 : -1); dx <= 1; dx++)
+                {
+                if (dim.z == 2 && dz == -1)
+                    continue;
+                cell_offsets.push_back(make_int3(dx, dy, dz));
+                }
+
+    // evaluate the interactions of particle i (with the given configuration) with all neighbors
+    // returns true on overlap
+    auto check_neighbors = [&](unsigned int i, const vec3<Scalar>& pos_i, const Shape& shape_i, unsigned int typ_i,
+                               bool check_overlaps, OverlapReal r_cut_patch, double& patch_energy,
+                               hpmc_counters_t& thread_counters) -> bool
+        {
+        // patch interactions within the cutoff, evaluated in batches
+        PatchEnergyBatch patch_batch;
+        auto flush_patch_batch = [&]()
+            {
+            m_patch->energyBatch(typ_i, quat<float>(shape_i.orientation), float(h_diameter.data[i]),
+                                 float(h_charge.data[i]), patch_batch);
+            for (unsigned int k = 0; k < patch_batch.n; k++)
+                patch_energy += patch_batch.energy[k];
+            patch_batch.clear();
+            };
+
+        int3 c = cell_coord(pos_i);
+        for (const int3& offset : cell_offsets)
+            {
+            unsigned int neigh_cell = cell_idx((c.x + offset.x + dim.x) % dim.x,
+                                               (c.y + offset.y + dim.y) % dim.y,
+                                               (c.z + offset.z + dim.z) % dim.z);
+            for (unsigned int k = m_checkerboard_cell_start[neigh_cell]; k < m_checkerboard_cell_start[neigh_cell + 1]; k++)
+                {
+                unsigned int j = m_checkerboard_particles[k];
+                if (j == i)
+                    continue;
+
+                Scalar4 postype_j = h_postype.data[j];
+                Scalar4 orientation_j = h_orientation.data[j];
+
+                // the grid guarantees that the box is at least two interaction ranges wide
+                vec3<Scalar> r_ij = vec3<Scalar>(box.minImage(vec_to_scalar3(vec3<Scalar>(postype_j) - pos_i)));
+
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
+                Shape shape_j(quat<Scalar>(orientation_j), m_params[typ_j]);
+
+                if (check_overlaps)
+                    {
+                    thread_counters.overlap_checks++;
+                    if (h_overlaps.data[m_overlap_idx(typ_i, typ_j)]
+                        && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+                        && test_overlap(r_ij, shape_i, shape_j, thread_counters.overlap_err_count))
+                        {
+                        return true;
+                        }
+                    }
+
+                if (m_patch)
+                    {
+                    Scalar rcut = r_cut_patch + 0.5 * m_patch->getAdditiveCutoff(typ_j);
+                    if (dot(r_ij,r_ij) <= rcut*rcut)
+                        {
+                        patch_batch.push(r_ij, typ_j, quat<float>(orientation_j),
+                                         float(h_diameter.data[j]), float(h_charge.data[j]));
+                        if (patch_batch.full())
+                            flush_patch_batch();
+                        }
+                    }
+                }
+            }
+        if (m_patch)
+            flush_patch_batch();
+        return false;
+        };
+
+    // attempt one trial move of particle i, which must stay in its cell
+    auto trial_move = [&](unsigned int i, unsigned int i_nselect, hpmc_counters_t& thread_counters)
+        {
+        Scalar4 postype_i = h_postype.data[i];
+        Scalar4 orientation_i = h_orientation.data[i];
+        vec3<Scalar> pos_i = vec3<Scalar>(postype_i);
+
+        hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::HPMCMonoTrialMove, timestep, seed),
+                                     hoomd::Counter(i, m_exec_conf->getRank(), i_nselect));
+        int typ_i = __scalar_as_int(postype_i.w);
+        Shape shape_i(quat<Scalar>(orientation_i), m_params[typ_i]);
+        unsigned int move_type_select = hoomd::UniformIntDistribution(0xffff)(rng_i);
+        bool move_type_translate = !shape_i.hasOrientation() || (move_type_select < m_translation_move_probability);
+
+        Shape shape_old(quat<Scalar>(orientation_i), m_params[typ_i]);
+        vec3<Scalar> pos_old = pos_i;
+
+        bool accept = true;
+        if (move_type_translate)
+            {
+            if (h_d.data[typ_i] == 0.0)
+                {
+                if (!shape_i.ignoreStatistics())
+                    thread_counters.translate_accept_count++;
+                return;
+                }
+
+            move_translate(pos_i, rng_i, h_d.data[typ_i], ndim);
+
+            // reject moves that leave the cell
+            int3 c = cell_coord(pos_i);
+            accept = cell_idx(c.x, c.y, c.z) == m_checkerboard_cell[i];
+            }
+        else
+            {
+            if (h_a.data[typ_i] == 0.0)
+                {
+                if (!shape_i.ignoreStatistics())
+                    thread_counters.rotate_accept_count++;
+                return;
+                }
+
+            if (ndim == 2)
+                move_rotate<2>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+            else
+                move_rotate<3>(shape_i.orientation, rng_i, h_a.data[typ_i]);
+            }
+
+        if (accept)
+            {
+            OverlapReal r_cut_patch = 0;
+            if (m_patch)
+                {
+                r_cut_patch = static_cast<OverlapReal>(m_patch->getRCut()) +
+                    static_cast<OverlapReal>(0.5) * static_cast<OverlapReal>(m_patch->getAdditiveCutoff(typ_i));
+                }
+
+            // deltaU = U_old - U_new
+            double energy_new = 0.0;
+            bool overlap = check_neighbors(i, pos_i, shape_i, typ_i, true, r_cut_patch, energy_new, thread_counters);
+
+            double energy_old = 0.0;
+            if (m_patch && !overlap)
+                check_neighbors(i, pos_old, shape_old, typ_i, false, r_cut_patch, energy_old, thread_counters);
+
+            accept = !overlap && hoomd::detail::generate_canonical<double>(rng_i) < slow::exp(energy_old - energy_new);
+            }
+
+        if (accept)
+            {
+            if (!shape_i.ignoreStatistics())
+                {
+                if (move_type_translate)
+                    thread_counters.translate_accept_count++;
+                else
+                    thread_counters.rotate_accept_count++;
+                }
+
+            h_postype.data[i] = make_scalar4(pos_i.x,pos_i.y,pos_i.z,postype_i.w);
+            if (shape_i.hasOrientation())
+                h_orientation.data[i] = quat_to_scalar4(shape_i.orientation);
+            }
+        else
+            {
+            if (!shape_i.ignoreStatistics())
+                {
+                if (move_type_translate)
+                    thread_counters.translate_reject_count++;
+                else
+                    thread_counters.rotate_reject_count++;
+                }
+            }
+        };
+
+    tbb::enumerable_thread_specific<hpmc_counters_t> thread_counters;
+    m_exec_conf->getTaskArena()->execute([&]{
+    for (unsigned int i_nselect = 0; i_nselect < m_nselect; i_nselect++)
+        {
+        // visit the colors in forward or reverse order
+        bool reverse = hoomd::UniformIntDistribution(1)(rng_grid);
+        for (unsigned int cur_color = 0; cur_color < n_colors; cur_color++)
+            {
+            const std::vector<unsigned int>& cells = m_checkerboard_color_cells[reverse ? n_colors - 1 - cur_color : cur_color];
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, cells.size()),
+                [&](const tbb::blocked_range<size_t>& r)
+                {
+                hpmc_counters_t& local_counters = thread_counters.local();
+                for (size_t k = r.begin(); k != r.end(); ++k)
+                    {
+                    unsigned int cell = cells[k];
+                    for (unsigned int cur_p = m_checkerboard_cell_start[cell]; cur_p < m_checkerboard_cell_start[cell + 1]; cur_p++)
+                        trial_move(m_checkerboard_particles[cur_p], i_nselect, local_counters);
+                    }
+                });
+            }
+        }
+    }); // end task arena execute()
+
+    for (auto i = thread_counters.begin(); i != thread_counters.end(); ++i)
+        counters = counters + *i;
+
+    return true;
+    }
+#endif
+
 /*! \param timestep current step
     \param early_exit exit at first overlap found if true
     \returns number of overlaps if early_exit=false, 1 if early_exit=true
@@ -1727,10 +2175,15 @@ void IntegratorHPMCMono<Shape>::growAABBList(unsigned int N)
 
     buildAABBTree() relies on the member variable m_aabb_tree_invalid to work correctly. Any time particles
     are moved (and not updated with m_aabb_tree->update()) or the particle list changes order, m_aabb_tree_invalid
-    needs to be set to true. Then buildAABBTree() will know to rebuild the tree from scratch on the next call. Typically
+    needs to be set to true. Then buildAABBTree() will know to update the tree on the next call. Typically
     this is on the next timestep. But in some cases (i.e. NPT), the tree may need to be rebuilt several times in a
     single step because of box volume moves.
 
+    Particles move only a little between calls, so the tree is refit to the new particle AABBs (keeping its
+    topology) when the number of particles is unchanged and the particles have not been sorted. A refit tree is
+    exact, but its nodes grow as particles drift apart. When the cost of the refit tree (the sum of the node
+    surface areas) exceeds the cost after the last full build by more than 50%, the tree is rebuilt from scratch.
+
     Subclasses that override update() or other methods must be user to set m_aabb_tree_invalid appropriately, or
     erroneous simulations will result.
 
@@ -1753,22 +2206,26 @@ const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
             if (n_aabb > 0)
                 {
                 growAABBList(n_aabb);
-                for (unsigned int cur_particle = 0; cur_particle < n_aabb; cur_particle++)
+                for (unsigned int i = 0; i < n_aabb; i++)
+                    m_aabbs[i] = getParticleAABB(h_postype.data[i], h_orientation.data[i]);
+
+                bool rebuild = true;
+                if (m_aabb_tree_refit_valid && n_aabb == m_aabb_tree.getNumParticles())
                     {
-                    unsigned int i = cur_particle;
-                    unsigned int typ_i = __scalar_as_int(h_postype.data[i].w);
-                    Shape shape(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+                    Scalar cost = m_aabb_tree.refit(m_aabbs, n_aabb);
+                    rebuild = cost > Scalar(1.5) * m_aabb_tree_build_cost;
+                    }
 
-                    if (!this->m_patch)
-                        m_aabbs[i] = shape.getAABB(vec3<Scalar>(h_postype.data[i]));
-                    else
-                        {
-                        Scalar radius = std::max(0.5*shape.getCircumsphereDiameter(),
-                            0.5*this->m_patch->getAdditiveCutoff(typ_i));
-                        m_aabbs[i] = hoomd::detail::AABB(vec3<Scalar>(h_postype.data[i]), radius);
-                        }
+                if (rebuild)
+                    {
+                    m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                    m_aabb_tree_build_cost = m_aabb_tree.getCost();
+                    m_aabb_tree_refit_valid = true;
                     }
-                m_aabb_tree.buildTree(m_aabbs, n_aabb);
+                }
+            else
+                {
+                m_aabb_tree_refit_valid = false;
                 }
             }
 
@@ -1779,6 +2236,176 @@ const hoomd::detail::AABBTree& IntegratorHPMCMono<Shape>::buildAABBTree()
     return m_aabb_tree;
     }
 
+/*! \param type Type of the new particle
+    \param pos Position of the new particle
+    \param orientation Orientation of the new particle
+    \returns The tag of the new particle
+
+    Add a particle with ParticleData::addParticle() and place it. When the AABB tree is up to date,
+    the particle is inserted into the tree instead of invalidating it (see AABBTree::insert()), so
+    grand canonical insertions do not cause a full tree rebuild. The tree is only updated
+    incrementally without domain decomposition.
+*/
+template <class Shape>
+unsigned int IntegratorHPMCMono<Shape>::insertParticle(unsigned int type,
+                                                       const vec3<Scalar>& pos,
+                                                       const quat<Scalar>& orientation)
+    {
+    bool incremental = !m_aabb_tree_invalid && m_aabb_tree_refit_valid
+                       && !m_sysdef->isDomainDecomposed();
+
+    m_aabb_tree_incremental = incremental;
+    unsigned int tag = m_pdata->addParticle(type);
+
+    // setPosition() takes into account the grid shift, so subtract that one
+    Scalar3 p = vec_to_scalar3(pos) - m_pdata->getOrigin();
+    int3 img = make_int3(0, 0, 0);
+    m_pdata->getGlobalBox().wrap(p, img);
+    m_pdata->setPosition(tag, p);
+    m_pdata->setOrientation(tag, quat_to_scalar4(orientation));
+    m_aabb_tree_incremental = false;
+
+    if (incremental)
+        {
+        unsigned int idx = m_pdata->getRTag(tag);
+        hoomd::detail::AABB aabb;
+            {
+            ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+            ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+            aabb = getParticleAABB(h_postype.data[idx], h_orientation.data[idx]);
+            }
+
+        if (!m_aabb_tree.insert(idx, aabb))
+            {
+            m_aabb_tree_invalid = true;
+            m_aabb_tree_refit_valid = false;
+            }
+        }
+
+    return tag;
+    }
+
+/*! \param tag Tag of the particle to remove
+
+    Remove a particle with ParticleData::removeParticle(). When the AABB tree is up to date, the
+    particle is removed from the tree instead of invalidating it (see AABBTree::remove()).
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::removeParticle(unsigned int tag)
+    {
+    bool incremental = !m_aabb_tree_invalid && m_aabb_tree_refit_valid
+                       && !m_sysdef->isDomainDecomposed();
+
+    if (incremental)
+        {
+        unsigned int idx = m_pdata->getRTag(tag);
+        incremental = idx < m_pdata->getN() && m_aabb_tree.remove(idx);
+        }
+
+    m_aabb_tree_incremental = incremental;
+    m_pdata->removeParticle(tag);
+    m_aabb_tree_incremental = false;
+
+    if (!incremental)
+        {
+        m_aabb_tree_invalid = true;
+        m_aabb_tree_refit_valid = false;
+        }
+    }
+
+/*! The candidate neighbors of particle i are all particles j (in any image) that may overlap or interact
+    with i at any point during the nselect trial moves of the current sweep. Each trial move displaces a
+    particle by at most d, so i and j each move by at most nselect*d from their current positions. Rotations
+    do not move the particle centers and shapes never extend beyond their circumsphere, so the cache does
+    not depend on a. The cache is padded by the move sizes at the time it is built and must be rebuilt every
+    sweep (after d changes, the particles are wrapped into the box, or migrate).
+
+    Trial moves then loop over the candidates instead of traversing the AABB tree once per image, which saves
+    the repeated tree traversals in dense systems where most moves are rejected.
+
+    \param counters Counters to record the rebuild in
+*/
+template <class Shape>
+void IntegratorHPMCMono<Shape>::buildNeighborCache(hpmc_counters_t& counters)
+    {
+    if (this->m_prof) this->m_prof->push(this->m_exec_conf, "HPMC neighbor cache");
+
+    // radius of each type such that particles i and j never overlap or interact beyond r_i + r_j,
+    // and the padding that covers the moves of one sweep
+    const unsigned int n_types = m_pdata->getNTypes();
+    std::vector<Scalar> r_type(n_types);
+    std::vector<Scalar> pad_type(n_types);
+    Scalar r_max = 0.0;
+    Scalar pad_max = 0.0;
+        {
+        ArrayHandle<Scalar> h_d(m_d, access_location::host, access_mode::read);
+        for (unsigned int typ = 0; typ < n_types; typ++)
+            {
+            Shape shape(quat<Scalar>(), m_params[typ]);
+            r_type[typ] = Scalar(0.5) * shape.getCircumsphereDiameter();
+            if (m_patch)
+                {
+                r_type[typ] = std::max(r_type[typ],
+                    Scalar(0.5) * (m_patch->getRCut() + m_patch->getAdditiveCutoff(typ)));
+                }
+            pad_type[typ] = Scalar(m_nselect) * h_d.data[typ];
+            r_max = std::max(r_max, r_type[typ]);
+            pad_max = std::max(pad_max, pad_type[typ]);
+            }
+        }
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_images = (unsigned int)m_image_list.size();
+    m_neighbor_cache_start.resize(N + 1);
+    m_neighbor_cache_j.clear();
+    m_neighbor_cache_image.clear();
+
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        m_neighbor_cache_start[i] = (unsigned int)m_neighbor_cache_j.size();
+
+        Scalar4 postype_i = h_postype.data[i];
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+
+        // the AABB of j in the tree lies within r_j of its center
+        hoomd::detail::AABB aabb_i_local(vec3<Scalar>(0,0,0),
+            r_type[typ_i] + pad_type[typ_i] + Scalar(2.0) * r_max + pad_max);
+
+        for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
+            {
+            vec3<Scalar> pos_i_image = vec3<Scalar>(postype_i) + m_image_list[cur_image];
+            hoomd::detail::AABB aabb = aabb_i_local;
+            aabb.translate(pos_i_image);
+
+            hits.clear();
+            m_aabb_tree.query(hits, aabb);
+            for (unsigned int j : hits)
+                {
+                if (j == i && cur_image == 0)
+                    continue;
+
+                Scalar4 postype_j = h_postype.data[j];
+                unsigned int typ_j = __scalar_as_int(postype_j.w);
+                vec3<Scalar> r_ij = vec3<Scalar>(postype_j) - pos_i_image;
+                Scalar r_cut = r_type[typ_i] + r_type[typ_j] + pad_type[typ_i] + pad_type[typ_j];
+                if (dot(r_ij, r_ij) <= r_cut * r_cut)
+                    {
+                    m_neighbor_cache_j.push_back(j);
+                    m_neighbor_cache_image.push_back(cur_image);
+                    }
+                }
+            }
+        }
+    m_neighbor_cache_start[N] = (unsigned int)m_neighbor_cache_j.size();
+
+    counters.neighbor_cache_rebuilds++;
+
+    if (this->m_prof) this->m_prof->pop(this->m_exec_conf);
+    }
+
 /*! Call to reduce the m_d values down to safe levels for the bvh tree + small box limitations. That code path
     will not work if particles can wander more than one image in a time step.
 
@@ -3039,11 +3666,34 @@ inline bool IntegratorHPMCMono<Shape>::checkDepletantOverlap(unsigned int i, vec
     return accept;
     }
 
+/*! Box moves scale all particle positions, so only pairs that are already close to contact can
+    overlap after small moves. attemptBoxResize() checks the pairs found by buildBoxPairCache() when
+    that is sufficient, and falls back to the full check in IntegratorHPMC::attemptBoxResize()
+    otherwise. Both give the same result.
+*/
 template<class Shape>
 bool IntegratorHPMCMono<Shape>::attemptBoxResize(uint64_t timestep, const BoxDim& new_box)
     {
-    // call parent class method
-    bool result = IntegratorHPMC::attemptBoxResize(timestep, new_box);
+    bool result = true;
+    bool decided = false;
+    bool use_cache = m_box_pair_cache_enabled;
+
+    #ifdef ENABLE_MPI
+    // particles may migrate between ranks, the pair cache only supports a single domain
+    if (m_pdata->getDomainDecomposition())
+        use_cache = false;
+    #endif
+
+    if (use_cache)
+        {
+        decided = attemptBoxResizeCached(new_box, result);
+        }
+
+    if (!decided)
+        {
+        // call parent class method
+        result = IntegratorHPMC::attemptBoxResize(timestep, new_box);
+        }
 
     if (result)
         {
@@ -3060,6 +3710,294 @@ bool IntegratorHPMCMono<Shape>::attemptBoxResize(uint64_t timestep, const BoxDim
     return result;
     }
 
+/*! Store all pairs (i, j, hkl) closer than m_box_pair_cache_range in the current configuration,
+    where hkl is the lattice image of particle j. The range is 25% larger than the maximum contact
+    distance so that the pairs remain valid while the particles move away from the affine image of
+    this configuration by less than the remaining margin.
+*/
+template<class Shape>
+void IntegratorHPMCMono<Shape>::buildBoxPairCache()
+    {
+    m_box_pair_cache_valid = false;
+    m_box_pair_cache_i.clear();
+    m_box_pair_cache_j.clear();
+    m_box_pair_cache_hkl.clear();
+
+    const BoxDim box = m_pdata->getGlobalBox();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const Scalar range = Scalar(1.25) * getMaxCoreDiameter();
+
+    // only the nearest images are searched
+    Scalar3 npd = box.getNearestPlaneDistance();
+    if (range >= npd.x || range >= npd.y || (ndim == 3 && range >= npd.z))
+        return;
+
+    if (m_prof) m_prof->push(m_exec_conf, "HPMC box pair cache");
+
+    buildAABBTree();
+
+    vec3<Scalar> a1(box.getLatticeVector(0));
+    vec3<Scalar> a2(box.getLatticeVector(1));
+    vec3<Scalar> a3(box.getLatticeVector(2));
+    int max_hkl_z = (ndim == 3) ? 1 : 0;
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+
+    for (unsigned int i = 0; i < m_pdata->getN(); i++)
+        {
+        vec3<Scalar> pos_i(h_postype.data[i]);
+
+        for (int h = -1; h <= 1; h++)
+            for (int k = -1; k <= 1; k++)
+                for (int l = -max_hkl_z; l <= max_hkl_z; l++)
+                    {
+                    // search around the position that image hkl of particle j must be close to
+                    vec3<Scalar> pos_query = pos_i - (Scalar(h) * a1 + Scalar(k) * a2 + Scalar(l) * a3);
+                    hoomd::detail::AABB aabb(pos_query, range);
+
+                    // stackless search
+                    for (unsigned int cur_node_idx = 0; cur_node_idx < m_aabb_tree.getNumNodes(); cur_node_idx++)
+                        {
+                        if (detail::overlap(m_aabb_tree.getNodeAABB(cur_node_idx), aabb))
+                            {
+                            if (m_aabb_tree.isNodeLeaf(cur_node_idx))
+                                {
+                                for (unsigned int cur_p = 0; cur_p < m_aabb_tree.getNodeNumParticles(cur_node_idx); cur_p++)
+                                    {
+                                    unsigned int j = m_aabb_tree.getNodeParticle(cur_node_idx, cur_p);
+
+                                    // store every pair once, keep the periodic images of i itself
+                                    if (j < i || (j == i && h == 0 && k == 0 && l == 0))
+                                        continue;
+
+                                    vec3<Scalar> r_ij = vec3<Scalar>(h_postype.data[j]) - pos_query;
+                                    if (dot(r_ij, r_ij) <= range * range)
+                                        {
+                                        m_box_pair_cache_i.push_back(i);
+                                        m_box_pair_cache_j.push_back(j);
+                                        m_box_pair_cache_hkl.push_back(make_int3(h, k, l));
+                                        }
+                                    }
+                                }
+                            }
+                        else
+                            {
+                            // skip ahead
+                            cur_node_idx += m_aabb_tree.getNodeSkip(cur_node_idx);
+                            }
+                        } // end loop over AABB nodes
+                    } // end loop over images
+        }
+
+    m_box_pair_cache_box = box;
+    m_box_pair_cache_range = range;
+    m_box_pair_cache_frac = m_box_resize_frac;
+    m_box_pair_cache_valid = true;
+
+    if (m_prof) m_prof->pop(m_exec_conf);
+    }
+
+/*! \param from Box of the original vectors
+    \param to Box of the mapped vectors
+    \returns An upper bound of |r_from| / |r_to| for vectors mapped with r_to = T r_from, where T
+        takes the lattice vectors of \a from to the lattice vectors of \a to.
+
+    The bound is sqrt(|S|_1 |S|_inf) >= |S|_2 with S = T^-1.
+*/
+template<class Shape>
+Scalar IntegratorHPMCMono<Shape>::getBoxStretchBound(const BoxDim& from, const BoxDim& to)
+    {
+    const unsigned int ndim = m_sysdef->getNDimensions();
+
+    // the lattice vectors are the columns of an upper triangular matrix
+    auto lattice_matrix = [ndim](const BoxDim& box, Scalar m[3][3])
+        {
+        for (unsigned int c = 0; c < 3; c++)
+            {
+            Scalar3 a = box.getLatticeVector(c);
+            if (ndim == 2 && c == 2)
+                a = make_scalar3(0, 0, 1);
+            m[0][c] = a.x;
+            m[1][c] = a.y;
+            m[2][c] = a.z;
+            }
+        };
+
+    Scalar b[3][3], u[3][3];
+    lattice_matrix(from, b);
+    lattice_matrix(to, u);
+
+    // invert the upper triangular matrix of the target box
+    Scalar u_inv[3][3] = {{0, 0, 0}, {0, 0, 0}, {0, 0, 0}};
+    u_inv[0][0] = Scalar(1.0) / u[0][0];
+    u_inv[1][1] = Scalar(1.0) / u[1][1];
+    u_inv[2][2] = Scalar(1.0) / u[2][2];
+    u_inv[0][1] = -u[0][1] * u_inv[0][0] * u_inv[1][1];
+    u_inv[1][2] = -u[1][2] * u_inv[1][1] * u_inv[2][2];
+    u_inv[0][2] = (u[0][1] * u[1][2] - u[0][2] * u[1][1]) * u_inv[0][0] * u_inv[1][1] * u_inv[2][2];
+
+    Scalar norm_1 = 0, norm_inf = 0;
+    Scalar col_sum[3] = {0, 0, 0};
+    for (unsigned int r = 0; r < 3; r++)
+        {
+        Scalar row_sum = 0;
+        for (unsigned int c = 0; c < 3; c++)
+            {
+            Scalar s_rc = 0;
+            for (unsigned int k = 0; k < 3; k++)
+                s_rc += b[r][k] * u_inv[k][c];
+            row_sum += fabs(s_rc);
+            col_sum[c] += fabs(s_rc);
+            }
+        norm_inf = std::max(norm_inf, row_sum);
+        }
+    for (unsigned int c = 0; c < 3; c++)
+        norm_1 = std::max(norm_1, col_sum[c]);
+
+    return sqrt(norm_1 * norm_inf);
+    }
+
+/*! \param new_box Box to scale the particles into
+    \param result Set to false if the scaled configuration has overlaps
+    \returns false (without changing the system) when the cached pairs cannot decide the move
+
+    Let s_i be the position of particle i mapped affinely into the cache box, and e its distance
+    from the position when the pairs were found. A pair that overlaps in \a new_box is closer than
+    d_max there, so it was closer than stretch * d_max + 2 e_max when the pairs were found. When
+    that is at most the cache range, the cache contains every pair that can overlap.
+*/
+template<class Shape>
+bool IntegratorHPMCMono<Shape>::attemptBoxResizeCached(const BoxDim& new_box, bool& result)
+    {
+    const unsigned int N = m_pdata->getN();
+    const unsigned int ndim = m_sysdef->getNDimensions();
+    const BoxDim cur_box = m_pdata->getGlobalBox();
+    const Scalar d_max = getMaxCoreDiameter();
+
+    // fractional coordinates of the current configuration
+    m_box_resize_frac.resize(N);
+    m_box_resize_shift.resize(N);
+        {
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            Scalar3 pos = make_scalar3(h_postype.data[i].x, h_postype.data[i].y, h_postype.data[i].z);
+            m_box_resize_frac[i] = vec3<Scalar>(cur_box.makeFraction(pos));
+            }
+        }
+
+    // largest distance of a particle from its position when the pairs were found
+    auto max_displacement = [&]() -> Scalar
+        {
+        vec3<Scalar> a1(m_box_pair_cache_box.getLatticeVector(0));
+        vec3<Scalar> a2(m_box_pair_cache_box.getLatticeVector(1));
+        vec3<Scalar> a3(m_box_pair_cache_box.getLatticeVector(2));
+
+        Scalar e_max_sq = 0;
+        for (unsigned int i = 0; i < N; i++)
+            {
+            vec3<Scalar> df = m_box_resize_frac[i] - m_box_pair_cache_frac[i];
+            if (ndim == 2)
+                df.z = 0;
+
+            // particles that crossed a boundary keep their pairs through a shifted image
+            int3 shift = make_int3(int(slow::rint(df.x)), int(slow::rint(df.y)), int(slow::rint(df.z)));
+            m_box_resize_shift[i] = shift;
+            df -= vec3<Scalar>(Scalar(shift.x), Scalar(shift.y), Scalar(shift.z));
+
+            vec3<Scalar> e = df.x * a1 + df.y * a2 + df.z * a3;
+            e_max_sq = std::max(e_max_sq, dot(e, e));
+            }
+        return sqrt(e_max_sq);
+        };
+
+    bool usable = false;
+    if (m_box_pair_cache_valid && m_box_pair_cache_frac.size() == N)
+        {
+        Scalar e_max = max_displacement();
+        usable = getBoxStretchBound(m_box_pair_cache_box, new_box) * d_max + Scalar(2.0) * e_max
+                 <= m_box_pair_cache_range;
+        }
+
+    if (!usable)
+        {
+        // find the pairs of the current configuration
+        buildBoxPairCache();
+        if (!m_box_pair_cache_valid)
+            return false;
+
+        std::fill(m_box_resize_shift.begin(), m_box_resize_shift.end(), make_int3(0, 0, 0));
+        usable = getBoxStretchBound(cur_box, new_box) * d_max <= m_box_pair_cache_range;
+        if (!usable)
+            return false;
+        }
+
+    if (m_prof) m_prof->push(m_exec_conf, "HPMC box resize overlaps");
+
+        {
+        // move the particles to be inside the new box
+        ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::readwrite);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            Scalar3 scaled_pos = new_box.makeCoordinates(vec_to_scalar3(m_box_resize_frac[i]));
+            h_postype.data[i].x = scaled_pos.x;
+            h_postype.data[i].y = scaled_pos.y;
+            h_postype.data[i].z = scaled_pos.z;
+            }
+        }
+
+    m_pdata->setGlobalBox(new_box);
+
+    // we have moved particles, communicate those changes
+    this->communicate(false);
+
+    vec3<Scalar> a1(new_box.getLatticeVector(0));
+    vec3<Scalar> a2(new_box.getLatticeVector(1));
+    vec3<Scalar> a3(new_box.getLatticeVector(2));
+
+    ArrayHandle<Scalar4> h_postype(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_orientation(m_pdata->getOrientationArray(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_overlaps(m_overlaps, access_location::host, access_mode::read);
+
+    unsigned int err_count = 0;
+    bool overlap = false;
+    for (size_t k = 0; k < m_box_pair_cache_i.size() && !overlap; k++)
+        {
+        unsigned int i = m_box_pair_cache_i[k];
+        unsigned int j = m_box_pair_cache_j[k];
+
+        // image of j relative to the current (shifted) position of i
+        const int3& hkl = m_box_pair_cache_hkl[k];
+        const int3& shift_i = m_box_resize_shift[i];
+        const int3& shift_j = m_box_resize_shift[j];
+        vec3<Scalar> image = Scalar(hkl.x + shift_i.x - shift_j.x) * a1
+                             + Scalar(hkl.y + shift_i.y - shift_j.y) * a2
+                             + Scalar(hkl.z + shift_i.z - shift_j.z) * a3;
+
+        Scalar4 postype_i = h_postype.data[i];
+        Scalar4 postype_j = h_postype.data[j];
+        vec3<Scalar> r_ij = vec3<Scalar>(postype_j) + image - vec3<Scalar>(postype_i);
+
+        unsigned int typ_i = __scalar_as_int(postype_i.w);
+        unsigned int typ_j = __scalar_as_int(postype_j.w);
+        Shape shape_i(quat<Scalar>(h_orientation.data[i]), m_params[typ_i]);
+        Shape shape_j(quat<Scalar>(h_orientation.data[j]), m_params[typ_j]);
+
+        if (h_overlaps.data[m_overlap_idx(typ_i,typ_j)]
+            && check_circumsphere_overlap(r_ij, shape_i, shape_j)
+            && test_overlap(r_ij, shape_i, shape_j, err_count)
+            && test_overlap(-r_ij, shape_j, shape_i, err_count))
+            {
+            overlap = true;
+            }
+        }
+
+    if (m_prof) m_prof->pop(m_exec_conf);
+
+    result = !overlap;
+    return true;
+    }
+
 namespace detail {
 
 //! Export the IntegratorHPMCMono class to python
@@ -3090,6 +4028,9 @@ template < class Shape > void export_IntegratorHPMCMono(pybind11::module& m, con
           .def("getShape", &IntegratorHPMCMono<Shape>::getShape)
           .def("setShape", &IntegratorHPMCMono<Shape>::setShape)
           .def("computePatchEnergy", &IntegratorHPMCMono<Shape>::computePatchEnergy)
+          .def_property("box_pair_cache",
+                        &IntegratorHPMCMono<Shape>::getBoxPairCacheEnabled,
+                        &IntegratorHPMCMono<Shape>::setBoxPairCacheEnabled)
           ;
     }
 
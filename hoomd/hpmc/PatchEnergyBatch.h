@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _PATCH_ENERGY_BATCH_H_
+#define _PATCH_ENERGY_BATCH_H_
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/VectorMath.h"
+
+/*! \file PatchEnergyBatch.h
+    \brief Declares the structure of arrays used to evaluate patch energies in batches
+
+    This header is also included by the code compiled at run time by PatchEnergyJIT, so it must
+    not include python or other host library headers.
+*/
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+//! Block of j particles whose patch energy with a single particle i is evaluated in one call
+/*! The pair data is stored as a structure of arrays so that the evaluator can process the pairs
+    with SIMD instructions. Callers push() pairs until full(), pass the batch to
+    PatchEnergy::energyBatch(), and read back the pair energies in the order they were pushed.
+
+    \ingroup hpmc_data_structs
+*/
+struct PatchEnergyBatch
+    {
+    //! Maximum number of pairs in a batch
+    static const unsigned int capacity = 64;
+
+    unsigned int n = 0; //!< Number of pairs in the batch
+
+    float r_x[capacity];           //!< x component of the vector pointing from i to j
+    float r_y[capacity];           //!< y component of the vector pointing from i to j
+    float r_z[capacity];           //!< z component of the vector pointing from i to j
+    unsigned int type_j[capacity]; //!< Type of particle j
+    float q_s[capacity];           //!< Real part of the orientation of particle j
+    float q_x[capacity];           //!< x component of the imaginary part of the orientation of j
+    float q_y[capacity];           //!< y component of the imaginary part of the orientation of j
+    float q_z[capacity];           //!< z component of the imaginary part of the orientation of j
+    float d_j[capacity];           //!< Diameter of particle j
+    float charge_j[capacity];      //!< Charge of particle j
+    unsigned int idx[capacity];    //!< Caller defined index of the pair (not used by evaluators)
+
+    float energy[capacity]; //!< Output: energy of each pair
+
+    //! Returns true when no more pairs can be added
+    bool full() const
+        {
+        return n == capacity;
+        }
+
+    //! Remove all pairs
+    void clear()
+        {
+        n = 0;
+        }
+
+    //! Add a pair to the batch
+    /*! \param r_ij Vector pointing from particle i to j
+        \param type Integer type index of particle j
+        \param q Orientation quaternion of particle j
+        \param d Diameter of particle j
+        \param charge Charge of particle j
+        \param pair_idx Caller defined index of the pair
+    */
+    void push(const vec3<float>& r_ij,
+              unsigned int type,
+              const quat<float>& q,
+              float d,
+              float charge,
+              unsigned int pair_idx = 0)
+        {
+        r_x[n] = r_ij.x;
+        r_y[n] = r_ij.y;
+        r_z[n] = r_ij.z;
+        type_j[n] = type;
+        q_s[n] = q.s;
+        q_x[n] = q.v.x;
+        q_y[n] = q.v.y;
+        q_z[n] = q.v.z;
+        d_j[n] = d;
+        charge_j[n] = charge;
+        idx[n] = pair_idx;
+        n++;
+        }
+    };
+
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // _PATCH_ENERGY_BATCH_H_
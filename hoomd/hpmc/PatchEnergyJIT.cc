@@ -5,6 +5,7 @@
 #include "EvalFactory.h"
 
 #include <sstream>
+#include <stdexcept>
 
 namespace hoomd
     {
@@ -35,8 +36,9 @@ PatchEnergyJIT::PatchEnergyJIT(std::shared_ptr<SystemDefinition> sysdef,
     // build the JIT.
     EvalFactory* factory = new EvalFactory(cpu_code, compiler_args, this->m_is_union);
 
-    // get the evaluator
+    // get the evaluators
     m_eval = factory->getEval();
+    m_eval_batch = factory->getEvalBatch();
 
     if (!m_eval)
         {
@@ -55,8 +57,31 @@ namespace detail
     {
 void export_PatchEnergyJIT(pybind11::module& m)
     {
+    pybind11::class_<PatchEnergyBatch, std::shared_ptr<PatchEnergyBatch>>(m, "PatchEnergyBatch")
+        .def(pybind11::init<>())
+        .def("push",
+             [](PatchEnergyBatch& batch,
+                const vec3<float>& r_ij,
+                unsigned int type,
+                const quat<float>& q,
+                float d,
+                float charge,
+                unsigned int pair_idx)
+             {
+                 if (batch.full())
+                     throw std::length_error("Patch energy batch is full");
+                 batch.push(r_ij, type, q, d, charge, pair_idx);
+             })
+        .def("getEnergy",
+             [](const PatchEnergyBatch& batch, unsigned int k)
+             {
+                 if (k >= batch.n)
+                     throw std::out_of_range("Pair index out of range");
+                 return batch.energy[k];
+             });
     pybind11::class_<hpmc::PatchEnergy, std::shared_ptr<hpmc::PatchEnergy>>(m, "PatchEnergy")
-        .def(pybind11::init<std::shared_ptr<SystemDefinition>>());
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>>())
+        .def("energyBatch", &hpmc::PatchEnergy::energyBatch);
     pybind11::class_<PatchEnergyJIT, hpmc::PatchEnergy, std::shared_ptr<PatchEnergyJIT>>(
         m,
         "PatchEnergyJIT")
@@ -99,6 +99,21 @@ class PYBIND11_EXPORT PatchEnergyJIT : public hpmc::PatchEnergy
         return m_eval(r_ij, type_i, q_i, d_i, charge_i, type_j, q_j, d_j, charge_j);
         }
 
+    //! evaluate the energies of the patch interactions between particle i and a batch of particles
+    /*! Calls the vectorized eval_batch entry point of the JIT module when it provides one.
+     */
+    virtual void energyBatch(unsigned int type_i,
+                             const quat<float>& q_i,
+                             float d_i,
+                             float charge_i,
+                             PatchEnergyBatch& batch)
+        {
+        if (m_eval_batch)
+            m_eval_batch(type_i, q_i, d_i, charge_i, batch);
+        else
+            PatchEnergy::energyBatch(type_i, q_i, d_i, charge_i, batch);
+        }
+
     static pybind11::object getParamArray(pybind11::object self)
         {
         auto self_cpp = self.cast<PatchEnergyJIT*>();
@@ -122,6 +137,8 @@ class PYBIND11_EXPORT PatchEnergyJIT : public hpmc::PatchEnergy
     Scalar m_r_cut_isotropic;               //!< Cutoff radius
     std::shared_ptr<EvalFactory> m_factory; //!< The factory for the evaluator function
     EvalFactory::EvalFnPtr m_eval;          //!< Pointer to evaluator function inside the JIT module
+    //! Pointer to the batched evaluator function inside the JIT module (may be null)
+    EvalFactory::EvalBatchFnPtr m_eval_batch;
     std::vector<float, hoomd::detail::managed_allocator<float>>
         m_param_array; //!< Array containing adjustable parameters
     const bool m_is_union;
@@ -305,6 +305,18 @@ class PatchEnergyJITUnion : public PatchEnergyJIT
                          float d_j,
                          float charge_j);
 
+    //! evaluate the energies of the patch interactions between particle i and a batch of particles
+    /*! The union energy walks the constituent trees, so evaluate the pairs one at a time.
+     */
+    virtual void energyBatch(unsigned int type_i,
+                             const quat<float>& q_i,
+                             float d_i,
+                             float charge_i,
+                             PatchEnergyBatch& batch)
+        {
+        PatchEnergy::energyBatch(type_i, q_i, d_i, charge_i, batch);
+        }
+
     static pybind11::object getParamArrayConstituent(pybind11::object self)
         {
         auto self_cpp = self.cast<PatchEnergyJITUnion*>();
@@ -0,0 +1,150 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef _HPMC_UNION_FIND_H_
+#define _HPMC_UNION_FIND_H_
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+/*! \file UnionFind.h
+    \brief Declares the UnionFind class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace hpmc
+    {
+namespace detail
+    {
+//! Disjoint set forest that finds the connected components of an undirected graph
+/*! Call resize() to start with one set per vertex, then unite() the two vertices of every edge.
+    unite() may be called concurrently from several threads without locks: roots are linked with a
+    single compare-and-swap and find() compresses paths by path halving, so the components of a
+    graph with N vertices and E edges are found in nearly O(N + E) time.
+
+    Every set is represented by its smallest vertex. unite() always links the root with the larger
+    index below the root with the smaller index, so the resulting sets do not depend on the order
+    in which the edges are added.
+*/
+class UnionFind
+    {
+    public:
+    //! Reset to one set per vertex
+    /*! \param n Number of vertices
+        \note Not thread safe.
+     */
+    void resize(unsigned int n)
+        {
+        if (m_parent.size() != n)
+            m_parent = std::vector<std::atomic<unsigned int>>(n);
+
+        for (unsigned int v = 0; v < n; ++v)
+            m_parent[v].store(v, std::memory_order_relaxed);
+        }
+
+    //! Get the number of vertices
+    unsigned int size() const
+        {
+        return (unsigned int)m_parent.size();
+        }
+
+    //! Find the representative (smallest vertex) of the set containing v
+    unsigned int find(unsigned int v)
+        {
+        while (true)
+            {
+            unsigned int parent = m_parent[v].load(std::memory_order_relaxed);
+            if (parent == v)
+                return v;
+
+            // path halving: point v at its grandparent, which is always an ancestor of v even
+            // when another thread has updated the tree in the meantime
+            unsigned int grandparent = m_parent[parent].load(std::memory_order_relaxed);
+            if (grandparent != parent)
+                m_parent[v].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+
+            v = grandparent;
+            }
+        }
+
+    //! Join the sets containing the vertices a and b
+    void unite(unsigned int a, unsigned int b)
+        {
+        while (true)
+            {
+            a = find(a);
+            b = find(b);
+            if (a == b)
+                return;
+
+            if (a < b)
+                std::swap(a, b);
+
+            // link the larger root below the smaller one, retry if a is no longer a root
+            unsigned int expected = a;
+            if (m_parent[a].compare_exchange_strong(expected, b, std::memory_order_relaxed))
+                return;
+            }
+        }
+
+    //! Collect the sets in compressed sparse row format
+    /*! \param members Vertices, grouped by set (output)
+        \param offsets The members of set k are members[offsets[k]] to members[offsets[k+1]-1]
+                       (output)
+
+        The sets are sorted by their smallest vertex and the vertices in each set are sorted in
+        increasing order.
+
+        \note Not thread safe, call after all unite() calls have completed.
+    */
+    void getSets(std::vector<unsigned int>& members, std::vector<unsigned int>& offsets)
+        {
+        const unsigned int n = size();
+
+        // label the sets in order of their representative, which is also their smallest vertex
+        m_label.resize(n);
+        offsets.clear();
+        offsets.push_back(0);
+        for (unsigned int v = 0; v < n; ++v)
+            {
+            unsigned int root = find(v);
+            if (root == v)
+                {
+                m_label[v] = (unsigned int)offsets.size() - 1;
+                offsets.push_back(0);
+                }
+            else
+                {
+                m_label[v] = m_label[root];
+                }
+            offsets[m_label[v] + 1]++;
+            }
+
+        // prefix sum of the set sizes
+        for (unsigned int k = 1; k < offsets.size(); ++k)
+            offsets[k] += offsets[k - 1];
+
+        // scatter the vertices in increasing order
+        members.resize(n);
+        m_fill.assign(offsets.begin(), offsets.end() - 1);
+        for (unsigned int v = 0; v < n; ++v)
+            members[m_fill[m_label[v]]++] = v;
+        }
+
+    private:
+    std::vector<std::atomic<unsigned int>> m_parent; //!< Parent of each vertex in the forest
+    std::vector<unsigned int> m_label;               //!< Set index of each vertex (temporary)
+    std::vector<unsigned int> m_fill;                //!< Next free slot of each set (temporary)
+    };
+
+    } // end namespace detail
+    } // end namespace hpmc
+    } // end namespace hoomd
+
+#endif // _HPMC_UNION_FIND_H_
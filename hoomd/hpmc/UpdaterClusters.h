@@ -12,25 +12,18 @@
 #include "hoomd/RandomNumbers.h"
 #include "hoomd/RNGIdentifiers.h"
 
-#include <set>
+#include <map>
 #include <list>
 
 #include "Moves.h"
 #include "HPMCCounters.h"
 #include "IntegratorHPMCMono.h"
+#include "UnionFind.h"
 
 #ifdef ENABLE_TBB
 #include <tbb/concurrent_unordered_map.h>
-#include <tbb/concurrent_unordered_set.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/parallel_for.h>
-#include <tbb/task.h>
-#include <atomic>
-
-#if TBB_VERSION_MAJOR < 2021
-#define ENABLE_TBB_TASK
-#endif
-
 #endif
 
 namespace hoomd {
@@ -41,232 +34,21 @@ namespace hpmc
 namespace detail
 {
 
-#ifdef ENABLE_TBB_TASK
-//! Wrapper around std::atomic_flag to allow use in a std::vector
-class my_atomic_flag
-    {
-    public:
-        //! Default constructor
-        my_atomic_flag()
-            {
-            f.clear();
-            }
-
-        //! Copy constructor
-        /*! \note this constructor doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag(const my_atomic_flag& other)
-            {
-            f.clear();
-            }
-
-        //! Assignment operator (non-atomic)
-        /*! \note this assignment operator doesn't really copy the value of its argument,
-            it just reset's the flag to zero
-         */
-        my_atomic_flag& operator =( const my_atomic_flag& other)
-            {
-            f.clear();
-            return *this;
-            }
-
-        //! Sets flag and returns old value
-        bool test_and_set()
-            {
-            return f.test_and_set();
-            }
-
-    private:
-        std::atomic_flag f;
-    };
-#endif
-
-// Graph class represents a undirected graph
-// using adjacency list representation
-class Graph
-    {
-    public:
-        Graph()
-            {
-            }
-
-        inline Graph(unsigned int V);   // Constructor
-
-        inline void resize(unsigned int V);
-
-        inline void addEdge(unsigned int v, unsigned int w);
-
-        #ifdef ENABLE_TBB_TASK
-        inline void connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc);
-        #else
-        inline void connectedComponents(std::vector<std::vector<unsigned int> >& cc);
-        #endif
-
-        #ifdef ENABLE_TBB_TASK
-        void setTaskArena(std::shared_ptr<tbb::task_arena> task_arena)
-            {
-            m_task_arena = task_arena;
-            }
-        #endif
-
-    private:
-        #ifndef ENABLE_TBB_TASK
-        std::multimap<unsigned int,unsigned int> adj;
-        #else
-        tbb::concurrent_unordered_multimap<unsigned int, unsigned int> adj;
-        #endif
-
-        #ifndef ENABLE_TBB_TASK
-        std::vector<unsigned int> visited;
-        #else
-        std::vector<my_atomic_flag> visited;
-        #endif
-
-        #ifdef ENABLE_TBB_TASK
-        /// The TBB task arena
-        std::shared_ptr<tbb::task_arena> m_task_arena;
-        #endif
-
-        #ifndef ENABLE_TBB_TASK
-        // A function used by DFS
-        inline void DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc);
-        #endif
-
-        #ifdef ENABLE_TBB_TASK
-        class DFSTask : public tbb::task
-            {
-            public:
-                DFSTask(unsigned int _root, std::vector<my_atomic_flag>& _visited,
-                    tbb::concurrent_vector<unsigned int>& _cc,
-                    const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& _adj)
-                    : root(_root), visited(_visited), cc(_cc), adj(_adj)
-                    { }
-
-                tbb::task* execute()
-                    {
-                    cc.push_back(root);
-
-                    unsigned int count = 0;
-                    tbb::task_list list;
-
-                    auto begin = adj.equal_range(root).first;
-                    auto end = adj.equal_range(root).second;
-
-                    for (auto it = begin; it != end; ++it)
-                        {
-                        unsigned int neighbor = it->second;
-                        if (!visited[neighbor].test_and_set())
-                            {
-                            if (count++ == 0)
-                                {
-                                root = neighbor; // for task recycling
-                                continue;
-                                }
-                            list.push_back(*new(allocate_child()) DFSTask(neighbor, visited, cc, adj));
-                            }
-                        }
-
-                    if (count)
-                        {
-                        set_ref_count(count);
-                        spawn(list);
-
-                        recycle_as_safe_continuation();
-                        }
-
-                    return NULL;
-                    }
-
-            private:
-                unsigned int root;
-                std::vector<my_atomic_flag> & visited;
-                tbb::concurrent_vector<unsigned int>& cc;
-                const tbb::concurrent_unordered_multimap<unsigned int, unsigned int>& adj;
-            };
-        #endif // ENABLE_TBB_TASK
-
-    };
-
-// Gather connected components in an undirected graph
-#ifdef ENABLE_TBB_TASK
-void Graph::connectedComponents(std::vector<tbb::concurrent_vector<unsigned int> >& cc)
-#else
-void Graph::connectedComponents(std::vector<std::vector<unsigned int> >& cc)
-#endif
+#ifdef ENABLE_TBB
+//! Hash function for particle index pairs in concurrent maps
+struct PairHash
     {
-    #ifdef ENABLE_TBB_TASK
-    this->m_task_arena->execute([&]{
-    for (unsigned int v = 0; v < visited.size(); ++v)
-        {
-        if (! visited[v].test_and_set())
-            {
-            tbb::concurrent_vector<unsigned int> component;
-            DFSTask& a = *new(tbb::task::allocate_root()) DFSTask(v, visited, component, adj);
-            tbb::task::spawn_root_and_wait(a);
-            cc.push_back(component);
-            }
-        }
-    }); // end task arena execute()
-    #else
-    std::fill(visited.begin(), visited.end(), 0);
-
-    // Depth first search
-    for (unsigned int v=0; v<visited.size(); v++)
+    size_t operator()(const std::pair<unsigned int, unsigned int>& p) const
         {
-        if (visited[v] == false)
-            {
-            std::vector<unsigned int> cur_cc;
-            DFSUtil(v, visited, cur_cc);
-            cc.push_back(cur_cc);
-            }
+        return std::hash<uint64_t>()((uint64_t(p.first) << 32) | uint64_t(p.second));
         }
-    #endif
-    }
+    };
 
-#ifndef ENABLE_TBB_TASK
-void Graph::DFSUtil(unsigned int v, std::vector<unsigned int>& visited, std::vector<unsigned int>& cur_cc)
-    {
-    visited[v] = 1;
-    cur_cc.push_back(v);
-
-    // Recur for all the vertices
-    // adjacent to this vertex
-    auto begin = adj.equal_range(v).first;
-    auto end = adj.equal_range(v).second;
-    for(auto i = begin; i != end; ++i)
-        {
-        if(!visited[i->second])
-            DFSUtil(i->second, visited, cur_cc);
-        }
-    }
+//! Concurrent map with particle index pairs as keys
+template<class T>
+using concurrent_pair_map = tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>, T, PairHash>;
 #endif
-Graph::Graph(unsigned int V)
-    {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
-    #else
-    visited.resize(V);
-    #endif
-    }
-
-void Graph::resize(unsigned int V)
-    {
-    #ifndef ENABLE_TBB_TASK
-    visited.resize(V, 0);
-    #else
-    visited.clear();
-    visited.resize(V);
-    #endif
-
-    adj.clear();
-    }
 
-// method to add a directed edge
-void Graph::addEdge(unsigned int v, unsigned int w)
-    {
-    adj.insert(std::make_pair(v,w));
-    }
 } // end namespace detail
 
 /*! A generic cluster move for attractive interactions.
@@ -364,13 +146,9 @@ class UpdaterClusters : public Updater
 
         unsigned int m_instance=0;                  //!< Unique ID for RNG seeding
 
-        #ifdef ENABLE_TBB_TASK
-        std::vector<tbb::concurrent_vector<unsigned int> > m_clusters; //!< Cluster components
-        #else
-        std::vector<std::vector<unsigned int> > m_clusters; //!< Cluster components
-        #endif
-
-        detail::Graph m_G; //!< The graph
+        detail::UnionFind m_union_find;               //!< Connected components of the interaction graph
+        std::vector<unsigned int> m_cluster_members;  //!< Particle indices, grouped by cluster
+        std::vector<unsigned int> m_cluster_offsets;  //!< First member of each cluster in m_cluster_members
 
         hoomd::detail::AABBTree m_aabb_tree_old;              //!< Locality lookup for old configuration
 
@@ -378,14 +156,14 @@ class UpdaterClusters : public Updater
         GlobalVector<Scalar4> m_orientation_backup;    //!< Old local orientations
         GlobalVector<int3> m_image_backup;             //!< Old local images
 
-        #ifndef ENABLE_TBB_TASK
-        std::set<std::pair<unsigned int, unsigned int> > m_overlap;   //!< A local vector of particle pairs due to overlap
+        #ifndef ENABLE_TBB
+        std::vector<std::pair<unsigned int, unsigned int> > m_overlap;   //!< Particle pairs connected due to overlap
         std::map<std::pair<unsigned int, unsigned int>,float > m_energy_old_old;    //!< Energy of interaction old-old
         std::map<std::pair<unsigned int, unsigned int>,float > m_energy_new_old;    //!< Energy of interaction old-old
         #else
-        tbb::concurrent_unordered_set<std::pair<unsigned int, unsigned int> > m_overlap;
-        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,float > m_energy_old_old;
-        tbb::concurrent_unordered_map<std::pair<unsigned int, unsigned int>,float > m_energy_new_old;
+        tbb::concurrent_vector<std::pair<unsigned int, unsigned int> > m_overlap;
+        detail::concurrent_pair_map<float> m_energy_old_old;
+        detail::concurrent_pair_map<float> m_energy_new_old;
         #endif
 
         hpmc_clusters_counters_t m_count_total;                 //!< Total count since initialization
@@ -424,10 +202,6 @@ UpdaterClusters<Shape>::UpdaterClusters(std::shared_ptr<SystemDefinition> sysdef
     {
     m_exec_conf->msg->notice(5) << "Constructing UpdaterClusters" << std::endl;
 
-    #ifdef ENABLE_TBB_TASK
-    m_G.setTaskArena(sysdef->getParticleData()->getExecConf()->getTaskArena());
-    #endif
-
     // initialize stats
     resetStats();
 
@@ -492,7 +266,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
         }
     img_i = box.getImage(pos_i_transf);
 
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for(tbb::blocked_range<unsigned int>(0, this->m_pdata->getNTypes()),
         [=, &shape_i](const tbb::blocked_range<unsigned int>& x) {
@@ -501,7 +275,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
     for (unsigned int type_a = 0; type_a < this->m_pdata->getNTypes(); ++type_a)
     #endif
         {
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         tbb::parallel_for(tbb::blocked_range<unsigned int>(type_a, this->m_pdata->getNTypes()),
             [=, &shape_i](const tbb::blocked_range<unsigned int>& w) {
         for (unsigned int type_b = w.begin(); type_b != w.end(); ++type_b)
@@ -651,7 +425,7 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
                 }
 
             // for every depletant
-            #ifdef ENABLE_TBB_TASK
+            #ifdef ENABLE_TBB
             tbb::parallel_for(tbb::blocked_range<unsigned int>(0, (unsigned int)n),
                 [=, &shape_i,
                     &pos_j, &orientation_j, &type_j, &V_all,
@@ -1038,24 +812,21 @@ inline void UpdaterClusters<Shape>::checkDepletantOverlap(unsigned int i, vec3<S
                         // additive depletants
                         if ((overlap_i_a && !overlap_transf_a && overlap_j_b) || (overlap_i_b && !overlap_transf_b & overlap_j_a))
                             {
-                            // add bond
-                            this->m_overlap.insert(std::make_pair(i,idx_j[m]));
-
-                            // since i<=j by construction, make matrix symmetric explicitly
-                            this->m_overlap.insert(std::make_pair(idx_j[m],i));
+                            // add bond (the cluster graph is undirected)
+                            this->m_overlap.push_back(std::make_pair(i,idx_j[m]));
                             }
                         }
                     } // end loop over intersections
                 } // end loop over depletants
-            #ifdef ENABLE_TBB_TASK
+            #ifdef ENABLE_TBB
                 });
             #endif
             } // end loop over type_b
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             });
         #endif
         } // end loop over type_a
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         });
     }); // end task arena execute()
     #endif
@@ -1113,7 +884,8 @@ void UpdaterClusters<Shape>::flip(uint64_t timestep)
     if (this->m_prof) this->m_prof->push("flip");
 
     // move every cluster independently
-    m_count_total.n_clusters += m_clusters.size();
+    const unsigned int n_clusters = (unsigned int)m_cluster_offsets.size() - 1;
+    m_count_total.n_clusters += n_clusters;
 
         {
         ArrayHandle<Scalar4> h_pos(this->m_pdata->getPositions(), access_location::host, access_mode::readwrite);
@@ -1126,23 +898,25 @@ void UpdaterClusters<Shape>::flip(uint64_t timestep)
 
         uint16_t seed = this->m_sysdef->getSeed();
 
-        for (unsigned int icluster = 0; icluster < m_clusters.size(); icluster++)
+        for (unsigned int icluster = 0; icluster < n_clusters; icluster++)
             {
-            m_count_total.n_particles_in_clusters += m_clusters[icluster].size();
+            const unsigned int first = m_cluster_offsets[icluster];
+            const unsigned int last = m_cluster_offsets[icluster+1];
+            m_count_total.n_particles_in_clusters += last - first;
 
             // seed by id of first particle in cluster to make independent of cluster labeling
             hoomd::RandomGenerator rng_i(hoomd::Seed(hoomd::RNGIdentifier::UpdaterClusters2, timestep, seed),
-                                         hoomd::Counter(m_clusters[icluster][0]));
+                                         hoomd::Counter(m_cluster_members[first]));
 
             bool flip = hoomd::detail::generate_canonical<float>(rng_i) <= m_flip_probability;
 
             if (!flip)
                 {
                 // revert cluster
-                for (auto it = m_clusters[icluster].begin(); it != m_clusters[icluster].end(); ++it)
+                for (unsigned int k = first; k < last; ++k)
                     {
                     // particle index
-                    unsigned int i = *it;
+                    unsigned int i = m_cluster_members[k];
 
                     h_pos.data[i] = h_pos_backup.data[i];
                     h_orientation.data[i] = h_orientation_backup.data[i];
@@ -1202,7 +976,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
     if (patch)
         {
         // test old configuration against itself
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         this->m_exec_conf->getTaskArena()->execute([&]{
         tbb::parallel_for((unsigned int)0,this->m_pdata->getN(), [&](unsigned int i)
         #else
@@ -1222,6 +996,32 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
             Scalar R_query = std::max(0.0,r_cut_patch+extent_i-min_core_diameter/(OverlapReal)2.0);
             hoomd::detail::AABB aabb_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0), R_query);
 
+            // pairs within the cutoff, evaluated in batches and accumulated per pair
+            PatchEnergyBatch patch_batch;
+            auto flush_patch_batch = [&]()
+                {
+                patch->energyBatch(typ_i, quat<float>(orientation_i), (float) d_i, (float) charge_i, patch_batch);
+                for (unsigned int k = 0; k < patch_batch.n; k++)
+                    {
+                    // the particle pair
+                    auto p = std::make_pair(i, patch_batch.idx[k]);
+
+                    // if particle interacts in different image already, add to that energy
+                    float U = 0.0;
+                        {
+                        auto it_energy = m_energy_old_old.find(p);
+                        if (it_energy != m_energy_old_old.end())
+                            U = it_energy->second;
+                        }
+
+                    U += patch_batch.energy[k];
+
+                    // update map
+                    m_energy_old_old[p] = U;
+                    }
+                patch_batch.clear();
+                };
+
             const unsigned int n_images = (unsigned int) image_list.size();
 
             for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
@@ -1257,28 +1057,10 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
 
                                 if (rsq_ij <= rcut_ij*rcut_ij)
                                     {
-                                    // the particle pair
-                                    auto p = std::make_pair(i,j);
-
-                                    // if particle interacts in different image already, add to that energy
-                                    float U = 0.0;
-                                        {
-                                        auto it_energy = m_energy_old_old.find(p);
-                                        if (it_energy != m_energy_old_old.end())
-                                            U = it_energy->second;
-                                        }
-
-                                    U += patch->energy(r_ij, typ_i,
-                                                        quat<float>(orientation_i),
-                                                        (float) d_i,
-                                                        (float) charge_i,
-                                                        typ_j,
-                                                        quat<float>(h_orientation_backup.data[j]),
-                                                        (float) h_diameter.data[j],
-                                                        (float) h_charge.data[j]);
-
-                                    // update map
-                                    m_energy_old_old[p] = U;
+                                    patch_batch.push(r_ij, typ_j, quat<float>(h_orientation_backup.data[j]),
+                                                     (float) h_diameter.data[j], (float) h_charge.data[j], j);
+                                    if (patch_batch.full())
+                                        flush_patch_batch();
                                     } // end if overlap
 
                                 } // end loop over AABB tree leaf
@@ -1294,15 +1076,16 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
 
                 } // end loop over images
 
+            flush_patch_batch();
             } // end loop over old configuration
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             );
         }); // end task arena execute()
         #endif
         }
 
     // loop over new configuration
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for((unsigned int)0,nptl, [&](unsigned int i)
     #else
@@ -1365,7 +1148,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
                                     && test_overlap(r_ij, shape_i, shape_j, err))
                                     {
                                     // add connection
-                                    m_overlap.insert(std::make_pair(i,j));
+                                    m_overlap.push_back(std::make_pair(i,j));
                                     } // end if overlap
                                 }
 
@@ -1388,6 +1171,35 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
             Scalar R_query = std::max(0.0,r_cut_patch+extent_i-min_core_diameter/(OverlapReal)2.0);
             hoomd::detail::AABB aabb_local = hoomd::detail::AABB(vec3<Scalar>(0,0,0), R_query);
 
+            // pairs within the cutoff, evaluated in batches and accumulated per pair
+            PatchEnergyBatch patch_batch;
+            auto flush_patch_batch = [&]()
+                {
+                patch->energyBatch(typ_i,
+                                   quat<float>(shape_i.orientation),
+                                   (float) h_diameter.data[i],
+                                   (float) h_charge.data[i],
+                                   patch_batch);
+                for (unsigned int k = 0; k < patch_batch.n; k++)
+                    {
+                    auto p = std::make_pair(i, patch_batch.idx[k]);
+
+                    // if particle interacts in different image already, add to that energy
+                    float U = 0.0;
+                        {
+                        auto it_energy = m_energy_new_old.find(p);
+                        if (it_energy != m_energy_new_old.end())
+                            U = it_energy->second;
+                        }
+
+                    U += patch_batch.energy[k];
+
+                    // update map
+                    m_energy_new_old[p] = U;
+                    }
+                patch_batch.clear();
+                };
+
             // compute V(r'-r)
             for (unsigned int cur_image = 0; cur_image < n_images; cur_image++)
                 {
@@ -1423,28 +1235,10 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
 
                                 if (rsq_ij <= rcut_ij*rcut_ij)
                                     {
-                                    auto p = std::make_pair(i, j);
-
-                                    // if particle interacts in different image already, add to that energy
-                                    float U = 0.0;
-                                        {
-                                        auto it_energy = m_energy_new_old.find(p);
-                                        if (it_energy != m_energy_new_old.end())
-                                            U = it_energy->second;
-                                        }
-
-                                    U += patch->energy(r_ij,
-                                                        typ_i,
-                                                        quat<float>(shape_i.orientation),
-                                                        (float) h_diameter.data[i],
-                                                        (float) h_charge.data[i],
-                                                        typ_j,
-                                                        quat<float>(h_orientation_backup.data[j]),
-                                                        (float) h_diameter.data[j],
-                                                        (float) h_charge.data[j]);
-
-                                    // update map
-                                    m_energy_new_old[p] = U;
+                                    patch_batch.push(r_ij, typ_j, quat<float>(h_orientation_backup.data[j]),
+                                                     (float) h_diameter.data[j], (float) h_charge.data[j], j);
+                                    if (patch_batch.full())
+                                        flush_patch_batch();
                                     }
                                 } // end loop over AABB tree leaf
                             } // end is leaf
@@ -1458,9 +1252,11 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
                     } // end loop over nodes
 
                 } // end loop over images
+
+            flush_patch_batch();
             } // end if patch
         } // end loop over local particles
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         );
     }); // end task arena execute()
     #endif
@@ -1487,7 +1283,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
         return;
 
     // test old configuration against itself
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for((unsigned int)0,this->m_pdata->getN(), [&](unsigned int i) {
     #else
@@ -1505,7 +1301,7 @@ void UpdaterClusters<Shape>::findInteractions(uint64_t timestep, const quat<Scal
             h_overlaps.data, h_fugacity.data,
             timestep, q, pivot, line);
         }
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         });
     }); // end task arena execute()
     #endif
@@ -1549,8 +1345,7 @@ void UpdaterClusters<Shape>::connectedComponents()
     if (this->m_prof) this->m_prof->push("connected components");
 
     // compute connected components
-    m_clusters.clear();
-    m_G.connectedComponents(m_clusters);
+    m_union_find.getSets(m_cluster_members, m_cluster_offsets);
     if (this->m_prof) this->m_prof->pop();
     }
 
@@ -1653,8 +1448,8 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
     if (m_prof)
         m_prof->push("realloc");
 
-    // resize the number of graph nodes in place
-    m_G.resize(this->m_pdata->getN());
+    // start with one cluster per particle
+    m_union_find.resize(this->m_pdata->getN());
 
     if (m_prof)
         m_prof->pop();
@@ -1662,7 +1457,7 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
     if (m_prof)
         m_prof->push("overlap");
 
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
     this->m_exec_conf->getTaskArena()->execute([&]{
     tbb::parallel_for(m_overlap.range(), [&] (decltype(m_overlap.range()) r)
     #else
@@ -1674,12 +1469,12 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
             unsigned int i = it->first;
             unsigned int j = it->second;
 
-            // we're adding a directed edge, but the actual graph will be undirected
-            // if the symmetry operation is self-inverse
-            m_G.addEdge(i,j);
+            // join the clusters of the two particles, the graph is undirected
+            // because the symmetry operation is self-inverse
+            m_union_find.unite(i,j);
             }
         }
-    #ifdef ENABLE_TBB_TASK
+    #ifdef ENABLE_TBB
         );
     }); // end task arena execute()
     #endif
@@ -1691,8 +1486,8 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
     if (m_mc->getPatchEnergy())
         {
         // sum up interaction energies
-        #ifdef ENABLE_TBB_TASK
-        tbb::concurrent_unordered_map< std::pair<unsigned int, unsigned int>, float> delta_U;
+        #ifdef ENABLE_TBB
+        detail::concurrent_pair_map<float> delta_U;
         #else
         std::map< std::pair<unsigned int, unsigned int>, float> delta_U;
         #endif
@@ -1731,7 +1526,7 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
             delta_U[p] = delU;
             }
 
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
         this->m_exec_conf->getTaskArena()->execute([&]{
         tbb::parallel_for(delta_U.range(), [&] (decltype(delta_U.range()) r)
         #else
@@ -1752,11 +1547,11 @@ void UpdaterClusters<Shape>::update(uint64_t timestep)
                 if (hoomd::detail::generate_canonical<float>(rng_ij) <= pij) // GCA
                     {
                     // add bond
-                    m_G.addEdge(i,j);
+                    m_union_find.unite(i,j);
                     }
                 }
             }
-        #ifdef ENABLE_TBB_TASK
+        #ifdef ENABLE_TBB
             );
         }); // end task arena execute()
         #endif
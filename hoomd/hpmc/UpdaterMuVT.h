@@ -168,6 +168,7 @@ template<class Shape> class UpdaterMuVT : public Updater
     hpmc_muvt_counters_t m_count_step_start; //!< Count saved at the start of the last step
 
     std::vector<std::vector<unsigned int>> m_type_map; //!< Local list of particle tags per type
+    bool m_type_map_incremental; //!< True while m_type_map is updated in place on a particle sort
     std::vector<unsigned int>
         m_transfer_types; //!< List of types being insert/removed/transferred between boxes
 
@@ -318,6 +319,16 @@ template<class Shape> class UpdaterMuVT : public Updater
         unsigned int MaxN = m_pdata->getMaxN();
         m_pos_backup.resize(MaxN);
         }
+
+    //! Handle ParticleSort signal
+    /*! Rebuild the list of tags per type, unless the sort was caused by an insertion or removal
+        that updates the list in place.
+     */
+    void slotSorted()
+        {
+        if (!m_type_map_incremental)
+            mapTypes();
+        }
     };
 
 /*! Constructor
@@ -336,9 +347,10 @@ UpdaterMuVT<Shape>::UpdaterMuVT(std::shared_ptr<SystemDefinition> sysdef,
     {
     m_fugacity.resize(m_pdata->getNTypes(), std::shared_ptr<Variant>(new VariantConstant(0.0)));
     m_type_map.resize(m_pdata->getNTypes());
+    m_type_map_incremental = false;
 
     m_pdata->getParticleSortSignal()
-        .template connect<UpdaterMuVT<Shape>, &UpdaterMuVT<Shape>::mapTypes>(this);
+        .template connect<UpdaterMuVT<Shape>, &UpdaterMuVT<Shape>::slotSorted>(this);
 
     if (npartition > 1)
         {
@@ -385,7 +397,7 @@ UpdaterMuVT<Shape>::UpdaterMuVT(std::shared_ptr<SystemDefinition> sysdef,
 template<class Shape> UpdaterMuVT<Shape>::~UpdaterMuVT()
     {
     m_pdata->getParticleSortSignal()
-        .template disconnect<UpdaterMuVT<Shape>, &UpdaterMuVT<Shape>::mapTypes>(this);
+        .template disconnect<UpdaterMuVT<Shape>, &UpdaterMuVT<Shape>::slotSorted>(this);
     m_pdata->getMaxParticleNumberChangeSignal()
         .template disconnect<UpdaterMuVT<Shape>, &UpdaterMuVT<Shape>::slotMaxNChange>(this);
     }
@@ -1182,21 +1194,17 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
                     {
                     // insertion was successful
 
-                    // create a new particle with given type
-                    unsigned int tag;
+                    // create a new particle with given type, the integrator inserts it into the
+                    // AABB tree and the list of tags per type is updated in place
+                    bool incremental = !m_sysdef->isDomainDecomposed();
+                    m_type_map_incremental = incremental;
+                    unsigned int tag
+                        = m_mc->insertParticle(type, pos_test, shape_test.orientation);
+                    m_type_map_incremental = false;
 
-                    tag = m_pdata->addParticle(type);
-
-                    // set the position of the particle
-
-                    // setPosition() takes into account the grid shift, so subtract that one
-                    Scalar3 p = vec_to_scalar3(pos_test) - m_pdata->getOrigin();
-                    int3 tmp = make_int3(0, 0, 0);
-                    m_pdata->getGlobalBox().wrap(p, tmp);
-                    m_pdata->setPosition(tag, p);
-                    if (shape_test.hasOrientation())
+                    if (incremental)
                         {
-                        m_pdata->setOrientation(tag, quat_to_scalar4(shape_test.orientation));
+                        m_type_map[type].push_back(tag);
                         }
                     m_count_total.insert_accept_count++;
                     }
@@ -1224,11 +1232,12 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
 
             // choose a random particle of that type
             unsigned int nptl_type = getNumParticlesType(type);
+            unsigned int type_offset = 0;
 
             if (nptl_type)
                 {
                 // get random tag of given type
-                unsigned int type_offset = hoomd::UniformIntDistribution(nptl_type - 1)(rng_local);
+                type_offset = hoomd::UniformIntDistribution(nptl_type - 1)(rng_local);
                 tag = getNthTypeTag(type, type_offset);
                 }
 
@@ -1358,8 +1367,19 @@ template<class Shape> void UpdaterMuVT<Shape>::update(uint64_t timestep)
 
             if (accept)
                 {
-                // remove particle
-                m_pdata->removeParticle(tag);
+                // remove particle, the integrator removes it from the AABB tree and the list of
+                // tags per type is updated in place
+                bool incremental = !m_sysdef->isDomainDecomposed();
+                m_type_map_incremental = incremental;
+                m_mc->removeParticle(tag);
+                m_type_map_incremental = false;
+
+                if (incremental)
+                    {
+                    assert(m_type_map[type][type_offset] == tag);
+                    m_type_map[type][type_offset] = m_type_map[type].back();
+                    m_type_map[type].pop_back();
+                    }
                 m_count_total.remove_accept_count++;
                 }
             else
@@ -54,6 +54,15 @@ class HPMCIntegrator(BaseIntegrator):
     If there are overlaps, it rejects the move. It accepts the move when there
     are no overlaps.
 
+    On the CPU with ``num_cpu_threads > 1``, the integrator splits the box
+    into a checkerboard of cells at least one interaction range wide and moves
+    the particles in cells of the same color concurrently. Trial moves that
+    would take a particle out of its cell are rejected and the checkerboard is
+    shifted randomly every timestep, which preserves detailed balance. The
+    integrator uses the serial algorithm when the box is too small for the
+    checkerboard, with implicit depletants, with external fields, and in MPI
+    domain decomposed simulations.
+
     Setting elements of `interaction_matrix` to False disables overlap checks
     between specific particle types. `interaction_matrix` is a particle types
     by particle types matrix allowing for non-additive systems.
@@ -114,6 +123,13 @@ class HPMCIntegrator(BaseIntegrator):
         nselect (int): Number of trial moves to perform per particle per
             timestep.
 
+        neighbor_cache (bool): When `True`, find the candidate neighbors of
+            each particle once per timestep, with a search radius padded by
+            ``nselect * d``, and check each trial move against the candidates
+            instead of searching the AABB tree. This is faster in dense systems
+            where most trial moves are rejected (**default:** `False`). The
+            neighbor cache applies only to the serial CPU algorithm.
+
     .. rubric:: Attributes
     """
     _remove_for_pickling = BaseIntegrator._remove_for_pickling + ('_cpp_cell',)
@@ -127,7 +143,8 @@ class HPMCIntegrator(BaseIntegrator):
         # Set base parameter dict for hpmc integrators
         param_dict = ParameterDict(
             translation_move_probability=float(translation_move_probability),
-            nselect=int(nselect))
+            nselect=int(nselect),
+            neighbor_cache=False)
         self._param_dict.update(param_dict)
         self._pair_potential = None
         self._external_potential = None
@@ -334,6 +351,10 @@ class HPMCIntegrator(BaseIntegrator):
         * ``overlap_checks``: `int` - Number of overlap checks performed.
         * ``overlap_errors``: `int` - Number of overlap checks that were too
           close to resolve.
+        * ``neighbor_cache_hits``: `int` - Number of trial moves checked against
+          the candidate neighbor cache.
+        * ``neighbor_cache_rebuilds``: `int` - Number of times the candidate
+          neighbor cache was built.
 
         Note:
             The counts are reset to 0 at the start of each
@@ -72,6 +72,13 @@ class CPPPotentialBase(_HOOMDBaseObject):
     Note:
         Your code *must* return a value.
 
+    Tip:
+        On the CPU, HPMC evaluates the function for one particle *i* and a
+        block of *j* particles at a time, and the compiler vectorizes that
+        loop when it can. Code that computes the result with conditional
+        expressions (``? :``) instead of early ``return`` statements is more
+        likely to vectorize.
+
     """
 
     @log(requires_run=True)
@@ -100,6 +107,7 @@ class CPPPotentialBase(_HOOMDBaseObject):
                         #include <stdio.h>
                         #include "hoomd/HOOMDMath.h"
                         #include "hoomd/VectorMath.h"
+                        #include "hoomd/hpmc/PatchEnergyBatch.h"
 
                         // param_array (singlet class) or param_array_isotropic
                         // and param_array_constituent (union class) are
@@ -125,6 +133,37 @@ class CPPPotentialBase(_HOOMDBaseObject):
         cpp_function += code
         cpp_function += """
                             }
+
+                        // evaluate particle i with a block of j particles,
+                        // the loop is vectorized when eval is inlined
+                        void eval_batch(unsigned int type_i,
+                            const quat<float>& q_i,
+                            float d_i,
+                            float charge_i,
+                            hpmc::PatchEnergyBatch& batch)
+                            {
+                            const unsigned int n = batch.n;
+                            #pragma clang loop vectorize(enable) interleave(enable)
+                            for (unsigned int k = 0; k < n; k++)
+                                {
+                                vec3<float> r_ij(batch.r_x[k],
+                                                 batch.r_y[k],
+                                                 batch.r_z[k]);
+                                quat<float> q_j(batch.q_s[k],
+                                                vec3<float>(batch.q_x[k],
+                                                            batch.q_y[k],
+                                                            batch.q_z[k]));
+                                batch.energy[k] = eval(r_ij,
+                                                       type_i,
+                                                       q_i,
+                                                       d_i,
+                                                       charge_i,
+                                                       batch.type_j[k],
+                                                       q_j,
+                                                       batch.d_j[k],
+                                                       batch.charge_j[k]);
+                                }
+                            }
                         }
                         """
         return cpp_function
@@ -244,6 +244,68 @@ def test_disk_compression(betaP, box_move, simulation_factory,
     assert sim.state.box != initial_box
 
 
+@pytest.mark.parametrize("box_move", box_moves_attrs)
+def test_dense_compression(box_move, simulation_factory,
+                           lattice_snapshot_factory):
+    """Test that box moves of a nearly jammed system never create overlaps."""
+    n = 6
+    snap = lattice_snapshot_factory(dimensions=3, n=n, a=1.02)
+
+    boxmc = hoomd.hpmc.update.BoxMC(betaP=hoomd.variant.Constant(100))
+
+    sim = simulation_factory(snap)
+    sim.operations.updaters.append(boxmc)
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.01)
+    mc.shape['A'] = dict(diameter=1)
+    sim.operations.integrator = mc
+
+    # use large moves so that many of them are rejected
+    params = dict(box_move['params'])
+    if isinstance(params['delta'], tuple):
+        params['delta'] = tuple(20 * d for d in params['delta'])
+    else:
+        params['delta'] = 20 * params['delta']
+    setattr(boxmc, box_move['move'], params)
+    sim.run(200)
+
+    assert mc.overlaps == 0
+
+
+@pytest.mark.parametrize("box_move", box_moves_attrs)
+def test_dense_compression_full_check(box_move, simulation_factory,
+                                      lattice_snapshot_factory, counter_attrs):
+    """Test that the near-contact pair cache matches the full overlap check."""
+    params = dict(box_move['params'])
+    if isinstance(params['delta'], tuple):
+        params['delta'] = tuple(20 * d for d in params['delta'])
+    else:
+        params['delta'] = 20 * params['delta']
+
+    def run(box_pair_cache):
+        snap = lattice_snapshot_factory(dimensions=3, n=6, a=1.02)
+        sim = simulation_factory(snap)
+        boxmc = hoomd.hpmc.update.BoxMC(betaP=hoomd.variant.Constant(100))
+        setattr(boxmc, box_move['move'], params)
+        sim.operations.updaters.append(boxmc)
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.01)
+        mc.shape['A'] = dict(diameter=1)
+        sim.operations.integrator = mc
+        sim.run(0)
+        mc._cpp_obj.box_pair_cache = box_pair_cache
+
+        sim.run(200)
+        counters = getattr(boxmc, counter_attrs[box_move['move']])
+        return counters, mc.translate_moves, sim.state.box
+
+    counters, translate_moves, box = run(True)
+    counters_full, translate_moves_full, box_full = run(False)
+
+    assert counters[0] > 0
+    assert counters == counters_full
+    assert translate_moves == translate_moves_full
+    assert box == box_full
+
+
 @pytest.mark.parametrize("box_move", box_moves_attrs)
 def test_counters(box_move, simulation_factory, lattice_snapshot_factory,
                   counter_attrs):
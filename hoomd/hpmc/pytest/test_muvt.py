@@ -4,6 +4,7 @@
 """Test hoomd.hpmc.update.MuVT."""
 
 import hoomd
+import numpy
 import pytest
 import hoomd.hpmc.pytest.conftest
 
@@ -159,3 +160,37 @@ def test_insertion_removal(device, simulation_factory,
 
     # make a wild guess: there be B particles
     assert (muvt.N['B'] > 0)
+
+
+def test_insertion_removal_consistency(device, simulation_factory,
+                                       lattice_snapshot_factory):
+    """Test that frequent insertions and removals keep the system valid."""
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=['A', 'B'],
+                                 dimensions=3,
+                                 a=4,
+                                 n=5,
+                                 r=0.1))
+
+    mc = hoomd.hpmc.integrate.Sphere(default_d=0.1, default_a=0.1)
+    mc.shape['A'] = dict(diameter=1.1)
+    mc.shape['B'] = dict(diameter=1.3)
+    sim.operations.integrator = mc
+
+    muvt = hoomd.hpmc.update.MuVT(trigger=hoomd.trigger.Periodic(1),
+                                  transfer_types=['B'])
+    muvt.fugacity['B'] = 5
+    sim.operations.updaters.append(muvt)
+
+    sim.run(300)
+    assert sum(muvt.insert_moves) > 0
+    assert sum(muvt.remove_moves) > 0
+
+    # inserted particles never overlap
+    assert mc.overlaps == 0
+
+    # the number of particles per type matches the particle data
+    N = muvt.N
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        assert N['B'] == numpy.sum(snapshot.particles.typeid == 1)
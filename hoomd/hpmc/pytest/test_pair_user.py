@@ -350,3 +350,81 @@ def test_cpp_potential_sticky_spheres(device, simulation_factory,
             dist = np.linalg.norm(snap.particles.position[0]
                                   - snap.particles.position[1])
             assert dist > max_r_interact
+
+
+@pytest.mark.validate
+@pytest.mark.skipif(llvm_disabled, reason='LLVM not enabled')
+def test_cpp_potential_batch(device, simulation_factory,
+                             two_particle_snapshot_factory):
+    """Test that the vectorized eval_batch matches eval pair by pair.
+
+    The code branches on the distance, type, diameter, and charge so that the
+    vectorized loop has to mask lanes.
+
+    """
+    code = """
+           float rsq = dot(r_ij, r_ij);
+           float r_cut = param_array[0];
+           if (rsq >= r_cut*r_cut)
+               return 0.0f;
+
+           float r = fast::sqrt(rsq);
+           vec3<float> t = r_ij / r;
+           vec3<float> pi = rotate(q_i, vec3<float>(1,0,0));
+           vec3<float> pj = rotate(q_j, vec3<float>(1,0,0));
+           float u = (dot(pi,pj) - 3 * dot(pi,t) * dot(pj,t)) / (rsq*r);
+           if (type_j == 1)
+               u = -u;
+           if (r < 0.5f * (d_i + d_j))
+               u += charge_i * charge_j / r;
+           return u;
+           """
+
+    sim = simulation_factory(two_particle_snapshot_factory(L=100))
+
+    patch = hoomd.hpmc.pair.user.CPPPotential(r_cut=2.5,
+                                              code=code,
+                                              param_array=[2.5])
+    mc = hoomd.hpmc.integrate.Sphere()
+    mc.shape['A'] = dict(diameter=0)
+    mc.pair_potential = patch
+    sim.operations.integrator = mc
+    sim.run(0)
+
+    def quat_float(q):
+        q = q / np.linalg.norm(q)
+        return hoomd._hoomd.quat_float(
+            float(q[0]), hoomd._hoomd.vec3_float(*[float(x) for x in q[1:]]))
+
+    rng = np.random.default_rng(seed=13)
+    n_pairs = 50
+    r = rng.uniform(-2, 2, size=(n_pairs, 3))
+    type_j = rng.integers(0, 2, size=n_pairs)
+    q_j = rng.normal(size=(n_pairs, 4))
+    d_j = rng.uniform(0.5, 2, size=n_pairs)
+    charge_j = rng.uniform(-1, 1, size=n_pairs)
+
+    type_i = 0
+    q_i = quat_float(np.array([1, 0.2, -0.3, 0.1]))
+    d_i = 1.5
+    charge_i = 0.7
+
+    batch = hoomd.hpmc._jit.PatchEnergyBatch()
+    for k in range(n_pairs):
+        batch.push(hoomd._hoomd.vec3_float(*[float(x) for x in r[k]]),
+                   int(type_j[k]), quat_float(q_j[k]), float(d_j[k]),
+                   float(charge_j[k]), k)
+    patch._cpp_obj.energyBatch(type_i, q_i, d_i, charge_i, batch)
+
+    n_nonzero = 0
+    for k in range(n_pairs):
+        energy = patch._cpp_obj.energy(
+            hoomd._hoomd.vec3_float(*[float(x) for x in r[k]]), type_i, q_i,
+            d_i, charge_i, int(type_j[k]), quat_float(q_j[k]), float(d_j[k]),
+            float(charge_j[k]))
+        assert batch.getEnergy(k) == energy
+        if energy != 0:
+            n_nonzero += 1
+
+    # both branches of the cutoff are exercised
+    assert 0 < n_nonzero < n_pairs
@@ -130,6 +130,141 @@ def test_moves(device, simulation_factory, lattice_snapshot_factory,
         assert accepted_rejected_rot > 0
 
 
+@pytest.mark.serial
+def test_threaded_moves(device, simulation_factory, lattice_snapshot_factory,
+                        test_moves_args):
+    """Trial moves on multiple CPU threads never introduce overlaps.
+
+    The moves draw from per-particle random number streams, so the trajectory
+    does not depend on the number of threads.
+    """
+    if not hoomd.version.tbb_enabled:
+        pytest.skip("HOOMD was compiled without TBB.")
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("CPU threads only apply to CPU devices.")
+
+    integrator = test_moves_args[0]
+    args = test_moves_args[1]
+    n_dimensions = test_moves_args[2]
+
+    snapshots = []
+    counters = []
+    for num_cpu_threads in (2, 4):
+        mc = integrator(default_d=0.2, default_a=0.2)
+        mc.shape['A'] = args
+
+        sim = simulation_factory(
+            lattice_snapshot_factory(dimensions=n_dimensions, n=8, a=3))
+        sim.operations.add(mc)
+        sim.operations._schedule()
+        overlaps = mc.overlaps
+
+        old_num_cpu_threads = device.num_cpu_threads
+        try:
+            device.num_cpu_threads = num_cpu_threads
+            sim.run(10)
+        finally:
+            device.num_cpu_threads = old_num_cpu_threads
+
+        assert sum(mc.translate_moves) > 0
+        if 'sphere' not in str(integrator).lower():
+            assert sum(mc.rotate_moves) > 0
+        assert mc.overlaps <= overlaps
+
+        snapshots.append(sim.state.get_snapshot())
+        counters.append(mc.counters)
+
+    assert counters[0].translate == counters[1].translate
+    assert counters[0].rotate == counters[1].rotate
+    np.testing.assert_array_equal(snapshots[0].particles.position,
+                                  snapshots[1].particles.position)
+    np.testing.assert_array_equal(snapshots[0].particles.orientation,
+                                  snapshots[1].particles.orientation)
+
+
+@pytest.mark.serial
+def test_threaded_structure(device, simulation_factory,
+                            lattice_snapshot_factory):
+    """Threaded and serial trial moves sample the same fluid structure."""
+    if not hoomd.version.tbb_enabled:
+        pytest.skip("HOOMD was compiled without TBB.")
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("CPU threads only apply to CPU devices.")
+
+    # the threaded moves reject moves that leave a cell, so the acceptance
+    # ratios differ from the serial loop; the equilibrium structure does not
+    def mean_contacts(snapshot):
+        """Mean number of neighbors closer than 1.2 diameters."""
+        box = hoomd.Box.from_box(snapshot.configuration.box)
+        position = snapshot.particles.position
+        delta = position[:, np.newaxis, :] - position[np.newaxis, :, :]
+        delta -= box.L * np.round(delta / box.L)
+        r_sq = np.sum(delta * delta, axis=-1)
+        n_pairs = np.count_nonzero(r_sq < 1.2**2) - len(position)
+        return n_pairs / len(position)
+
+    contacts = []
+    for num_cpu_threads in (1, 4):
+        mc = hoomd.hpmc.integrate.Sphere(default_d=0.2)
+        mc.shape['A'] = dict(diameter=1)
+
+        sim = simulation_factory(lattice_snapshot_factory(n=8, a=1.2))
+        sim.operations.add(mc)
+
+        samples = []
+        old_num_cpu_threads = device.num_cpu_threads
+        try:
+            device.num_cpu_threads = num_cpu_threads
+            sim.run(200)
+            for _ in range(100):
+                sim.run(10)
+                samples.append(mean_contacts(sim.state.get_snapshot()))
+        finally:
+            device.num_cpu_threads = old_num_cpu_threads
+
+        assert mc.overlaps == 0
+        contacts.append(np.mean(samples))
+
+    np.testing.assert_allclose(contacts[1], contacts[0], rtol=0.03)
+
+
+def test_neighbor_cache(device, simulation_factory, lattice_snapshot_factory,
+                        test_moves_args):
+    """The neighbor cache reproduces the trajectory of the tree search."""
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("The neighbor cache only applies to CPU devices.")
+
+    integrator = test_moves_args[0]
+    args = test_moves_args[1]
+    n_dimensions = test_moves_args[2]
+
+    snapshots = []
+    counters = []
+    for neighbor_cache in (False, True):
+        mc = integrator(default_d=0.2, default_a=0.2, nselect=4)
+        mc.shape['A'] = args
+        mc.neighbor_cache = neighbor_cache
+
+        sim = simulation_factory(
+            lattice_snapshot_factory(dimensions=n_dimensions, n=6, a=2))
+        sim.operations.add(mc)
+        sim.run(10)
+
+        snapshots.append(sim.state.get_snapshot())
+        counters.append(mc.counters)
+
+    assert counters[0].translate == counters[1].translate
+    assert counters[0].rotate == counters[1].rotate
+    assert counters[0].neighbor_cache_rebuilds == 0
+    assert counters[1].neighbor_cache_rebuilds > 0
+    assert counters[1].neighbor_cache_hits > 0
+    if snapshots[0].communicator.rank == 0:
+        np.testing.assert_array_equal(snapshots[0].particles.position,
+                                      snapshots[1].particles.position)
+        np.testing.assert_array_equal(snapshots[0].particles.orientation,
+                                      snapshots[1].particles.orientation)
+
+
 # An ellipsoid with a = b = c should be a sphere
 # A spheropolyhedron with a single vertex should be a sphere
 # A sphinx where the indenting sphere is negligible should also be a sphere
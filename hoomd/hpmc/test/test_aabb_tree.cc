@@ -105,3 +105,156 @@ UP_TEST(bigger)
         UP_ASSERT(in(i, hits));
         }
     }
+
+UP_TEST(refit)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(0, 1, 2), hoomd::Counter(7, 8, 9));
+
+    std::vector<vec3<Scalar>> points(N);
+    std::vector<AABB> aabbs(N);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        points[i] = vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng),
+                                 hoomd::detail::generate_canonical<float>(rng))
+                    * Scalar(100);
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        aabbs[i].tag = i;
+        }
+
+    // build the tree, buildTree reorders the aabbs so pass a copy
+    std::vector<AABB> build_aabbs(aabbs);
+    AABBTree tree;
+    tree.buildTree(build_aabbs.data(), N);
+    Scalar build_cost = tree.getCost();
+    UP_ASSERT_EQUAL(tree.getNumParticles(), N);
+
+    // refitting to the same AABBs reproduces the tree
+    MY_CHECK_CLOSE(tree.refit(aabbs.data(), N), build_cost, tol);
+
+    // move all the points, including some far away, and refit
+    std::vector<AABB> original_aabbs(aabbs);
+    for (unsigned int i = 0; i < N; i++)
+        {
+        Scalar scale = (i % 10 == 0) ? Scalar(50) : Scalar(2);
+        points[i] += vec3<Scalar>(hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5),
+                                  hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5),
+                                  hoomd::detail::generate_canonical<float>(rng) - Scalar(0.5))
+                     * scale;
+        aabbs[i] = AABB(points[i], Scalar(1.0));
+        aabbs[i].tag = i;
+        }
+    Scalar refit_cost = tree.refit(aabbs.data(), N);
+    MY_CHECK_CLOSE(refit_cost, tree.getCost(), tol);
+    UP_ASSERT(refit_cost > build_cost);
+
+    // queries on the refit tree must find all of the overlapping AABBs
+    std::vector<unsigned int> hits;
+    for (unsigned int i = 0; i < N; i++)
+        {
+        hits.clear();
+        AABB query(points[i], Scalar(1.5));
+        tree.query(hits, query);
+        for (unsigned int j = 0; j < N; j++)
+            {
+            if (overlap(query, aabbs[j]))
+                UP_ASSERT(in(j, hits));
+            }
+        }
+
+    // particle tags follow the refit AABBs
+    for (unsigned int node = 0; node < tree.getNumNodes(); node++)
+        {
+        if (!tree.isNodeLeaf(node))
+            continue;
+        for (unsigned int j = 0; j < tree.getNodeNumParticles(node); j++)
+            {
+            UP_ASSERT_EQUAL(tree.getNodeParticleTag(node, j), tree.getNodeParticle(node, j));
+            }
+        }
+
+    // refit also shrinks the nodes: moving the points back restores the original cost
+    MY_CHECK_CLOSE(tree.refit(original_aabbs.data(), N), build_cost, tol);
+    }
+
+UP_TEST(insert_remove)
+    {
+    const unsigned int N = 1000;
+    hoomd::RandomGenerator rng(hoomd::Seed(3, 4, 5), hoomd::Counter(1, 2, 3));
+
+    auto random_aabb = [&rng]()
+    {
+        vec3<Scalar> p(hoomd::detail::generate_canonical<float>(rng),
+                       hoomd::detail::generate_canonical<float>(rng),
+                       hoomd::detail::generate_canonical<float>(rng));
+        return AABB(p * Scalar(100), Scalar(1.0));
+    };
+
+    std::vector<AABB> aabbs(N);
+    for (unsigned int i = 0; i < N; i++)
+        aabbs[i] = random_aabb();
+
+    std::vector<AABB> build_aabbs(aabbs);
+    AABBTree tree;
+    tree.buildTree(build_aabbs.data(), N);
+
+    // insert particles until a leaf is full
+    unsigned int n_inserted = 0;
+    while (true)
+        {
+        AABB aabb = random_aabb();
+        if (!tree.insert((unsigned int)aabbs.size(), aabb))
+            break;
+        aabbs.push_back(aabb);
+        n_inserted++;
+        }
+    UP_ASSERT(n_inserted > 0);
+    UP_ASSERT_EQUAL(tree.getNumParticles(), aabbs.size());
+
+    // remove particles the same way ParticleData does: the last particle takes the removed index
+    for (unsigned int k = 0; k < 200; k++)
+        {
+        unsigned int idx = hoomd::UniformIntDistribution((unsigned int)aabbs.size() - 1)(rng);
+        if (!tree.remove(idx))
+            continue;
+        aabbs[idx] = aabbs.back();
+        aabbs.pop_back();
+        }
+    UP_ASSERT_EQUAL(tree.getNumParticles(), aabbs.size());
+
+    // every particle is in the tree exactly once
+    std::vector<unsigned int> count(aabbs.size(), 0);
+    for (unsigned int node = 0; node < tree.getNumNodes(); node++)
+        {
+        if (!tree.isNodeLeaf(node))
+            continue;
+        for (unsigned int j = 0; j < tree.getNodeNumParticles(node); j++)
+            {
+            unsigned int i = tree.getNodeParticle(node, j);
+            UP_ASSERT(i < aabbs.size());
+            count[i]++;
+            }
+        }
+    for (unsigned int i = 0; i < aabbs.size(); i++)
+        UP_ASSERT_EQUAL(count[i], 1);
+
+    // queries find all of the overlapping AABBs, before and after a refit
+    for (unsigned int pass = 0; pass < 2; pass++)
+        {
+        std::vector<unsigned int> hits;
+        for (unsigned int i = 0; i < aabbs.size(); i++)
+            {
+            hits.clear();
+            AABB query(aabbs[i].getPosition(), Scalar(1.5));
+            tree.query(hits, query);
+            for (unsigned int j = 0; j < aabbs.size(); j++)
+                {
+                if (overlap(query, aabbs[j]))
+                    UP_ASSERT(in(j, hits));
+                }
+            }
+
+        tree.refit(aabbs.data(), (unsigned int)aabbs.size());
+        }
+    }
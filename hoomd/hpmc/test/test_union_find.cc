@@ -0,0 +1,94 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/test/upp11_config.h"
+
+HOOMD_UP_MAIN();
+
+#include "hoomd/hpmc/UnionFind.h"
+
+#include <thread>
+#include <vector>
+
+using namespace hoomd::hpmc::detail;
+
+UP_TEST(singletons)
+    {
+    UnionFind uf;
+    uf.resize(4);
+
+    std::vector<unsigned int> members, offsets;
+    uf.getSets(members, offsets);
+
+    UP_ASSERT_EQUAL(offsets.size(), 5);
+    for (unsigned int v = 0; v < 4; ++v)
+        {
+        UP_ASSERT_EQUAL(uf.find(v), v);
+        UP_ASSERT_EQUAL(offsets[v], v);
+        UP_ASSERT_EQUAL(members[v], v);
+        }
+    }
+
+UP_TEST(components)
+    {
+    UnionFind uf;
+    uf.resize(8);
+
+    // components {0, 3, 5}, {1}, {2, 6, 7}, {4}
+    uf.unite(5, 3);
+    uf.unite(7, 6);
+    uf.unite(3, 0);
+    uf.unite(2, 7);
+    uf.unite(0, 5);
+
+    UP_ASSERT_EQUAL(uf.find(5), 0);
+    UP_ASSERT_EQUAL(uf.find(7), 2);
+    UP_ASSERT_EQUAL(uf.find(4), 4);
+
+    std::vector<unsigned int> members, offsets;
+    uf.getSets(members, offsets);
+
+    std::vector<unsigned int> expected_members = {0, 3, 5, 1, 2, 6, 7, 4};
+    std::vector<unsigned int> expected_offsets = {0, 3, 4, 7, 8};
+    UP_ASSERT(members == expected_members);
+    UP_ASSERT(offsets == expected_offsets);
+
+    // resize resets the sets
+    uf.resize(8);
+    uf.getSets(members, offsets);
+    UP_ASSERT_EQUAL(offsets.size(), 9);
+    }
+
+UP_TEST(concurrent_unite)
+    {
+    // join the even and the odd vertices of a ring from several threads
+    const unsigned int n = 10000;
+    const unsigned int n_threads = 4;
+
+    UnionFind uf;
+    uf.resize(n);
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < n_threads; ++t)
+        {
+        threads.push_back(std::thread(
+            [&uf, t, n, n_threads]()
+            {
+                for (unsigned int v = t; v < n; v += n_threads)
+                    uf.unite(v, (v + 2) % n);
+            }));
+        }
+    for (auto& thread : threads)
+        thread.join();
+
+    std::vector<unsigned int> members, offsets;
+    uf.getSets(members, offsets);
+
+    UP_ASSERT_EQUAL(offsets.size(), 3);
+    UP_ASSERT_EQUAL(offsets[1], n / 2);
+    for (unsigned int k = 0; k < n / 2; ++k)
+        {
+        UP_ASSERT_EQUAL(members[k], 2 * k);
+        UP_ASSERT_EQUAL(members[n / 2 + k], 2 * k + 1);
+        }
+    }
@@ -115,7 +115,10 @@ void BondTablePotential::computeForces(uint64_t timestep)
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<BondData::members_t> h_bond_idx(m_bond_data->getIndexTable(),
+                                                access_location::host,
+                                                access_mode::read);
 
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
@@ -144,8 +147,8 @@ void BondTablePotential::computeForces(uint64_t timestep)
 
         // transform a and b into indices into the particle data arrays
         // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
+        unsigned int idx_a = h_bond_idx.data[i].idx[0];
+        unsigned int idx_b = h_bond_idx.data[i].idx[1];
         assert(idx_a <= m_pdata->getMaximumTag());
         assert(idx_b <= m_pdata->getMaximumTag());
 
@@ -106,7 +106,10 @@ void CosineSqAngleForceCompute::computeForces(uint64_t timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<AngleData::members_t> h_angle_idx(m_angle_data->getIndexTable(),
+                                                  access_location::host,
+                                                  access_mode::read);
 
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
@@ -116,7 +119,6 @@ void CosineSqAngleForceCompute::computeForces(uint64_t timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     // Zero data for force calculation.
     memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
@@ -137,9 +139,9 @@ void CosineSqAngleForceCompute::computeForces(uint64_t timestep)
 
         // transform a, b, and c into indices into the particle data arrays
         // MEM TRANSFER: 6 ints
-        unsigned int idx_a = h_rtag.data[angle.tag[0]];
-        unsigned int idx_b = h_rtag.data[angle.tag[1]];
-        unsigned int idx_c = h_rtag.data[angle.tag[2]];
+        unsigned int idx_a = h_angle_idx.data[i].idx[0];
+        unsigned int idx_b = h_angle_idx.data[i].idx[1];
+        unsigned int idx_c = h_angle_idx.data[i].idx[2];
 
         // throw an error if this angle is incomplete
         if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL || idx_c == NOT_LOCAL)
@@ -42,6 +42,12 @@ class PYBIND11_EXPORT CustomForceCompute : public ForceCompute
         return m_aniso;
         }
 
+    //! Python forces may call collective methods, such as taking a snapshot
+    virtual bool communicatesInCompute()
+        {
+        return true;
+        }
+
     protected:
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
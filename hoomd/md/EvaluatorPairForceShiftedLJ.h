@@ -5,6 +5,7 @@
 #define __PAIR_EVALUATOR_FORCE_SHIFTED_LJ_H__
 
 #ifndef __HIPCC__
+#include "hoomd/md/PairEvaluatorBatch.h"
 #include <string>
 #endif
 
@@ -136,6 +137,50 @@ class EvaluatorPairForceShiftedLJ
         }
 
 #ifndef __HIPCC__
+    //! Evaluate the force and energy of a batch of pairs
+    /*! \param batch Pairs to evaluate, force_divr and pair_eng are set on output
+        \param energy_shift If true, the potential must be shifted so that
+        V(r) is continuous at the cutoff
+
+        Computes the same values as evalForceAndEnergy() for every pair in the batch and sets
+        force_divr and pair_eng to 0 for pairs that evalForceAndEnergy() would not evaluate. The
+        loop body has no data dependent branches so that the compiler can vectorize it.
+    */
+    static void evalForceAndEnergyBatch(PairEvaluatorBatch<param_type>& batch, bool energy_shift)
+        {
+        for (unsigned int l = 0; l < batch.n; l++)
+            {
+            const Scalar rsq = batch.rsq[l];
+            const Scalar rcutsq = batch.rcutsq[l];
+            const Scalar lj1 = batch.params[l].epsilon_x_4 * batch.params[l].sigma_6
+                               * batch.params[l].sigma_6;
+            const Scalar lj2 = batch.params[l].epsilon_x_4 * batch.params[l].sigma_6;
+
+            Scalar r2inv = Scalar(1.0) / rsq;
+            Scalar r6inv = r2inv * r2inv * r2inv;
+            Scalar force_divr = r2inv * r6inv * (Scalar(12.0) * lj1 * r6inv - Scalar(6.0) * lj2);
+
+            Scalar pair_eng = r6inv * (lj1 * r6inv - lj2);
+
+            Scalar rcut2inv = Scalar(1.0) / rcutsq;
+            Scalar rcut6inv = rcut2inv * rcut2inv * rcut2inv;
+
+            if (energy_shift)
+                pair_eng -= rcut6inv * (lj1 * rcut6inv - lj2);
+
+            // shift force and add linear term to potential
+            Scalar rcut_r_inv = fast::rsqrt(rsq * rcutsq);
+            Scalar force_rcut_at_rcut
+                = rcut6inv * (Scalar(12.0) * lj1 * rcut6inv - Scalar(6.0) * lj2);
+            force_divr -= rcut_r_inv * force_rcut_at_rcut;
+            pair_eng += (rsq * rcut_r_inv - Scalar(1.0)) * force_rcut_at_rcut;
+
+            const bool evaluated = rsq < rcutsq && lj1 != 0;
+            batch.force_divr[l] = evaluated ? force_divr : Scalar(0.0);
+            batch.pair_eng[l] = evaluated ? pair_eng : Scalar(0.0);
+            }
+        }
+
     //! Get the name of this potential
     /*! \returns The potential name.
      */
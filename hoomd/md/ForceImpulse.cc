@@ -0,0 +1,73 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "ForceImpulse.h"
+
+using namespace std;
+
+/*! \file ForceImpulse.cc
+    \brief Contains code for the ForceImpulse class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param force Force to apply as an impulse
+*/
+ForceImpulse::ForceImpulse(std::shared_ptr<SystemDefinition> sysdef,
+                           std::shared_ptr<ForceCompute> force)
+    : ForceCompute(sysdef), m_base_force(force), m_scale(1.0)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing ForceImpulse" << endl;
+    }
+
+ForceImpulse::~ForceImpulse()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying ForceImpulse" << endl;
+    }
+
+/*! Copies the forces and torques of the local and ghost particles multiplied by m_scale. The
+    potential energies and virials are copied unchanged.
+*/
+void ForceImpulse::computeForces(uint64_t timestep)
+    {
+    const unsigned int nparticles = m_pdata->getN() + m_pdata->getNGhosts();
+
+    const GlobalArray<Scalar4>& force_array = m_base_force->getForceArray();
+    const GlobalArray<Scalar>& virial_array = m_base_force->getVirialArray();
+    const GlobalArray<Scalar4>& torque_array = m_base_force->getTorqueArray();
+
+    assert(nparticles <= force_array.getNumElements());
+    assert(nparticles <= m_force.getNumElements());
+
+    ArrayHandle<Scalar4> h_force_in(force_array, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_virial_in(virial_array, access_location::host, access_mode::read);
+    ArrayHandle<Scalar4> h_torque_in(torque_array, access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar4> h_torque(m_torque, access_location::host, access_mode::overwrite);
+
+    const size_t virial_in_pitch = virial_array.getPitch();
+    for (unsigned int i = 0; i < nparticles; i++)
+        {
+        const Scalar4 f = h_force_in.data[i];
+        h_force.data[i] = make_scalar4(m_scale * f.x, m_scale * f.y, m_scale * f.z, f.w);
+
+        const Scalar4 t = h_torque_in.data[i];
+        h_torque.data[i] = make_scalar4(m_scale * t.x, m_scale * t.y, m_scale * t.z, t.w);
+
+        for (unsigned int k = 0; k < 6; k++)
+            h_virial.data[k * m_virial_pitch + i] = h_virial_in.data[k * virial_in_pitch + i];
+        }
+
+    for (unsigned int k = 0; k < 6; k++)
+        m_external_virial[k] = m_base_force->getExternalVirial(k);
+
+    m_external_energy = m_base_force->getExternalEnergy();
+    }
+
+    } // end namespace md
+    } // end namespace hoomd
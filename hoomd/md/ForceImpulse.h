@@ -0,0 +1,111 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "hoomd/ForceCompute.h"
+
+#include <memory>
+
+/*! \file ForceImpulse.h
+    \brief Declares the ForceImpulse class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __FORCEIMPULSE_H__
+#define __FORCEIMPULSE_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Applies the forces of another ForceCompute as an impulse
+/*! IntegratorTwoStep evaluates its slow forces only every slow_interval steps (r-RESPA). On these
+    steps, it sums a ForceImpulse of each slow force into the net force. ForceImpulse computes the
+    wrapped force and stores its forces and torques multiplied by the scale factor, so that the
+    integration methods apply the impulse of the slow force over the whole interval in their usual
+    half step velocity updates.
+
+    The potential energies and virials are copied without scaling, so the thermodynamic quantities
+    computed from the net force and virial are correct on the steps that include the slow forces.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT ForceImpulse : public ForceCompute
+    {
+    public:
+    //! Constructs the compute
+    ForceImpulse(std::shared_ptr<SystemDefinition> sysdef, std::shared_ptr<ForceCompute> force);
+
+    //! Destructor
+    virtual ~ForceImpulse();
+
+    //! Get the wrapped force
+    std::shared_ptr<ForceCompute> getForce() const
+        {
+        return m_base_force;
+        }
+
+    //! Set the factor applied to the forces and torques
+    void setScale(Scalar scale)
+        {
+        m_scale = scale;
+        }
+
+    //! Compute the wrapped force and scale its forces
+    /*! The scale factor may change between calls with the same timestep, so the copy is always
+        made. The wrapped force decides on its own whether it needs to recompute.
+    */
+    virtual void compute(uint64_t timestep)
+        {
+        m_base_force->compute(timestep);
+        computeForces(timestep);
+        }
+
+#ifdef ENABLE_MPI
+    //! Get requested ghost communication flags
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep)
+        {
+        return m_base_force->getRequestedCommFlags(timestep);
+        }
+#endif
+
+    //! Returns true if the wrapped force requires anisotropic integration
+    virtual bool isAnisotropic()
+        {
+        return m_base_force->isAnisotropic();
+        }
+
+    //! Returns true if the wrapped force may be computed in a parallel task
+    virtual bool canComputeConcurrently()
+        {
+        return m_base_force->canComputeConcurrently();
+        }
+
+    //! Returns true if the wrapped force communicates while it computes
+    virtual bool communicatesInCompute()
+        {
+        return m_base_force->communicatesInCompute();
+        }
+
+    //! Get the lazily updated state shared with the wrapped force
+    virtual const void* getSharedState()
+        {
+        return m_base_force->getSharedState();
+        }
+
+    protected:
+    std::shared_ptr<ForceCompute> m_base_force; //!< The wrapped force
+    Scalar m_scale;                             //!< Factor applied to the forces and torques
+
+    //! Copy the scaled forces of the wrapped force
+    virtual void computeForces(uint64_t timestep);
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
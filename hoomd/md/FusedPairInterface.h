@@ -0,0 +1,81 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __FUSED_PAIR_INTERFACE_H__
+#define __FUSED_PAIR_INTERFACE_H__
+
+#include "NeighborList.h"
+#include "hoomd/HOOMDMath.h"
+
+#include <memory>
+
+/*! \file FusedPairInterface.h
+    \brief Declares the interface pair potentials implement to be evaluated by PotentialPairFused
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Geometry of a single pair, computed once by PotentialPairFused and shared by all members
+struct FusedPairArgs
+    {
+    unsigned int i;     //!< Local index of the first particle
+    unsigned int j;     //!< Local index of the second particle (may be a ghost)
+    unsigned int typei; //!< Type of particle i
+    unsigned int typej; //!< Type of particle j
+    Scalar3 dx;         //!< Minimum image vector r_i - r_j
+    Scalar rsq;         //!< Squared distance |dx|^2
+    Scalar di;          //!< Diameter of particle i (0 when no member needs diameters)
+    Scalar dj;          //!< Diameter of particle j (0 when no member needs diameters)
+    Scalar qi;          //!< Charge of particle i (0 when no member needs charges)
+    Scalar qj;          //!< Charge of particle j (0 when no member needs charges)
+    };
+
+//! Interface for pair potentials that can be evaluated inside a shared neighbor list traversal
+/*! PotentialPairFused walks the neighbor list once and asks every member to evaluate each pair.
+    Members acquire whatever per-sweep data they need (parameter arrays, velocities, ...) in
+    beginFusedSweep() and release it in endFusedSweep(). evalFusedPair() is called concurrently
+    from several threads when threading is enabled and must not modify the member.
+*/
+class PYBIND11_EXPORT FusedPairInterface
+    {
+    public:
+    virtual ~FusedPairInterface() { }
+
+    //! Get the neighbor list the potential was constructed with
+    virtual std::shared_ptr<NeighborList> getFusedNList() const = 0;
+
+    //! Returns true when the potential needs particle diameters
+    virtual bool fusedNeedsDiameter() const = 0;
+
+    //! Returns true when the potential needs particle charges
+    virtual bool fusedNeedsCharge() const = 0;
+
+    //! Acquire the data needed to evaluate pairs on this timestep
+    virtual void beginFusedSweep(uint64_t timestep) = 0;
+
+    //! Evaluate one pair
+    /*! \param args Pair geometry
+        \param force_divr Output: |F|/r of the pair force
+        \param virial_divr Output: |F|/r of the force that contributes to the virial
+        \param pair_eng Output: pair energy
+        \returns true when the pair is within range and the outputs are valid
+    */
+    virtual bool evalFusedPair(const FusedPairArgs& args,
+                               Scalar& force_divr,
+                               Scalar& virial_divr,
+                               Scalar& pair_eng) const = 0;
+
+    //! Release the data acquired in beginFusedSweep()
+    virtual void endFusedSweep() = 0;
+    };
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __FUSED_PAIR_INTERFACE_H__
@@ -89,6 +89,18 @@ class PYBIND11_EXPORT HarmonicAngleForceCompute : public ForceCompute
         }
 #endif
 
+    //! Harmonic angles may be computed concurrently with other forces
+    virtual bool canComputeConcurrently()
+        {
+        return true;
+        }
+
+    //! Angle forces share the angle data, which rebuilds its index table on demand
+    virtual const void* getSharedState()
+        {
+        return m_angle_data.get();
+        }
+
     protected:
     Scalar* m_K;   //!< K parameter for multiple angle tyes
     Scalar* m_t_0; //!< r_0 parameter for multiple angle types
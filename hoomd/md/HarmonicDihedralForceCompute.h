@@ -90,6 +90,18 @@ class PYBIND11_EXPORT HarmonicDihedralForceCompute : public ForceCompute
         }
 #endif
 
+    //! Harmonic dihedrals may be computed concurrently with other forces
+    virtual bool canComputeConcurrently()
+        {
+        return true;
+        }
+
+    //! Dihedral forces share the dihedral data, which rebuilds its index table on demand
+    virtual const void* getSharedState()
+        {
+        return m_dihedral_data.get();
+        }
+
     protected:
     Scalar* m_K;     //!< K parameter for multiple dihedral tyes
     Scalar* m_sign;  //!< sign parameter for multiple dihedral types
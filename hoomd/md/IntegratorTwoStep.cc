@@ -63,6 +63,12 @@ void IntegratorTwoStep::update(uint64_t timestep)
     {
     Integrator::update(timestep);
 
+    // the slow forces are evaluated once per outer step
+    for (auto& force : m_slow_forces)
+        {
+        force->setDeltaT(m_deltaT * m_slow_interval);
+        }
+
     // issue a warning if no integration methods are set
     if (!m_gave_warning && m_methods.size() == 0)
         {
@@ -161,6 +167,90 @@ void IntegratorTwoStep::setDeltaT(Scalar deltaT)
         }
     }
 
+/*! \param slow_interval Number of inner steps in an outer step
+ */
+void IntegratorTwoStep::setSlowInterval(unsigned int slow_interval)
+    {
+    if (slow_interval == 0)
+        {
+        throw std::invalid_argument("slow_interval must be positive");
+        }
+    m_slow_interval = slow_interval;
+    }
+
+/*! \param timestep Time step that the net force is computed at
+    \returns Number of impulses appended to m_forces
+
+    The slow forces are applied on the steps that are multiples of m_slow_interval. Callers remove
+    the impulses from m_forces after summing the net force.
+*/
+size_t IntegratorTwoStep::pushSlowImpulses(uint64_t timestep)
+    {
+    // rebuild the impulses when the list of slow forces has changed
+    bool changed = m_slow_impulses.size() != m_slow_forces.size();
+    for (size_t i = 0; !changed && i < m_slow_forces.size(); i++)
+        {
+        changed = m_slow_impulses[i]->getForce() != m_slow_forces[i];
+        }
+
+    if (changed)
+        {
+        m_slow_impulses.clear();
+        for (auto& force : m_slow_forces)
+            {
+            m_slow_impulses.push_back(std::make_shared<ForceImpulse>(m_sysdef, force));
+            }
+        }
+
+    if (m_slow_impulses.size() == 0 || timestep % m_slow_interval != 0)
+        return 0;
+
+    for (auto& impulse : m_slow_impulses)
+        {
+        impulse->setScale(Scalar(m_slow_interval));
+        m_forces.push_back(impulse);
+        }
+
+    return m_slow_impulses.size();
+    }
+
+/*! \param timestep Time step that the run starts at
+    \param n_steps Number of inner steps until the next outer step
+
+    Outer steps fall on the multiples of m_slow_interval. A run that starts between two of them has
+    not applied the first half of the impulse of the current outer step. The next outer step
+    applies m_slow_interval / 2 inner steps of the slow forces, so the accelerations of the first
+    step include 2 * n_steps - m_slow_interval times the slow forces. The impulse over the shorter
+    first outer step is then n_steps inner steps of the slow forces. The torques of the slow forces
+    are not included.
+*/
+void IntegratorTwoStep::addSlowAccelerations(uint64_t timestep, unsigned int n_steps)
+    {
+    for (auto& force : m_slow_forces)
+        {
+        force->compute(timestep);
+        }
+
+    ArrayHandle<Scalar3> h_accel(m_pdata->getAccelerations(),
+                                 access_location::host,
+                                 access_mode::readwrite);
+    ArrayHandle<Scalar4> h_vel(m_pdata->getVelocities(), access_location::host, access_mode::read);
+
+    for (auto& force : m_slow_forces)
+        {
+        ArrayHandle<Scalar4> h_force(force->getForceArray(),
+                                     access_location::host,
+                                     access_mode::read);
+        for (unsigned int j = 0; j < m_pdata->getN(); j++)
+            {
+            Scalar scale = (Scalar(2 * n_steps) - Scalar(m_slow_interval)) / h_vel.data[j].w;
+            h_accel.data[j].x += h_force.data[j].x * scale;
+            h_accel.data[j].y += h_force.data[j].y * scale;
+            h_accel.data[j].z += h_force.data[j].z * scale;
+            }
+        }
+    }
+
 /*! \returns true If all added integration methods have valid restart information
  */
 bool IntegratorTwoStep::isValidRestart()
@@ -276,6 +366,11 @@ void IntegratorTwoStep::prepRun(uint64_t timestep)
     for (auto& method : m_methods)
         method->setAnisotropic(m_integrate_rotational_dof);
 
+    for (auto& force : m_slow_forces)
+        {
+        force->setDeltaT(m_deltaT * m_slow_interval);
+        }
+
 #ifdef ENABLE_MPI
     if (m_sysdef->isDomainDecomposed())
         {
@@ -305,6 +400,13 @@ void IntegratorTwoStep::prepRun(uint64_t timestep)
     if (!m_pdata->isAccelSet())
         {
         computeAccelerations(timestep);
+
+        // a run that starts between two outer steps begins with a shorter outer step
+        const unsigned int n_remaining
+            = m_slow_interval - static_cast<unsigned int>(timestep % m_slow_interval);
+        if (m_slow_forces.size() > 0 && n_remaining != m_slow_interval)
+            addSlowAccelerations(timestep, n_remaining);
+
         m_pdata->notifyAccelSet();
         }
 
@@ -359,7 +461,9 @@ void IntegratorTwoStep::computeNetForce(uint64_t timestep)
         m_rigid_bodies->validateRigidBodies();
         m_constraint_forces.push_back(m_rigid_bodies);
         }
+    size_t n_impulses = pushSlowImpulses(timestep);
     Integrator::computeNetForce(timestep);
+    m_forces.resize(m_forces.size() - n_impulses);
     if (m_rigid_bodies)
         {
         m_constraint_forces.pop_back();
@@ -375,7 +479,9 @@ void IntegratorTwoStep::computeNetForceGPU(uint64_t timestep)
         m_rigid_bodies->validateRigidBodies();
         m_constraint_forces.push_back(m_rigid_bodies);
         }
+    size_t n_impulses = pushSlowImpulses(timestep);
     Integrator::computeNetForceGPU(timestep);
+    m_forces.resize(m_forces.size() - n_impulses);
     if (m_rigid_bodies)
         {
         m_constraint_forces.pop_back();
@@ -392,6 +498,10 @@ CommFlags IntegratorTwoStep::determineFlags(uint64_t timestep)
         {
         flags |= m_rigid_bodies->getRequestedCommFlags(timestep);
         }
+    for (const auto& force : m_slow_forces)
+        {
+        flags |= force->getRequestedCommFlags(timestep);
+        }
     return flags;
     }
 #endif
@@ -404,9 +514,36 @@ bool IntegratorTwoStep::areForcesAnisotropic()
         {
         is_anisotropic |= m_rigid_bodies->isAnisotropic();
         }
+    for (const auto& force : m_slow_forces)
+        {
+        is_anisotropic |= force->isAnisotropic();
+        }
     return is_anisotropic;
     }
 
+/// The slow forces contribute their cost averaged over the slow interval
+double IntegratorTwoStep::getLocalCost()
+    {
+    double cost = Integrator::getLocalCost();
+    for (const auto& force : m_slow_forces)
+        {
+        cost += force->getLocalCost() / double(m_slow_interval);
+        }
+    return cost;
+    }
+
+/// The slow forces are timed when they are computed on the outer steps
+double IntegratorTwoStep::getTotalLocalForceTime()
+    {
+    double time = Integrator::getTotalLocalForceTime();
+    for (const auto& force : m_slow_forces)
+        {
+        if (!force->communicatesInCompute())
+            time += force->getTotalComputeTime();
+        }
+    return time;
+    }
+
 namespace detail
     {
 void export_IntegratorTwoStep(pybind11::module& m)
@@ -421,6 +558,10 @@ void export_IntegratorTwoStep(pybind11::module& m)
         .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
         .def_property_readonly("methods", &IntegratorTwoStep::getIntegrationMethods)
         .def_property("rigid", &IntegratorTwoStep::getRigid, &IntegratorTwoStep::setRigid)
+        .def_property_readonly("slow_forces", &IntegratorTwoStep::getSlowForces)
+        .def_property("slow_interval",
+                      &IntegratorTwoStep::getSlowInterval,
+                      &IntegratorTwoStep::setSlowInterval)
         .def_property("integrate_rotational_dof",
                       &IntegratorTwoStep::getIntegrateRotationalDOF,
                       &IntegratorTwoStep::setIntegrateRotationalDOF);
@@ -5,6 +5,7 @@
 #include "hoomd/Integrator.h"
 
 #include "ForceComposite.h"
+#include "ForceImpulse.h"
 
 #pragma once
 
@@ -33,6 +34,13 @@ namespace md
    steps one and two, and which can use the updated particle positions and velocities to update any
    slaved degrees of freedom (rigid bodies).
 
+    Forces in m_slow_forces are integrated with the r-RESPA multiple time step scheme. They are
+   evaluated only on the steps that are multiples of m_slow_interval and enter the net force on
+   these steps multiplied by m_slow_interval (see ForceImpulse). The integration methods apply half
+   of this impulse at the end of an outer step and the other half at the beginning of the next one,
+   while the forces in m_forces are integrated with the inner step size deltaT. A run that starts
+   between two outer steps begins with a shorter outer step (see addSlowAccelerations()).
+
     \ingroup updaters
 */
 class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
@@ -59,6 +67,21 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
         return m_methods;
         }
 
+    /// Get the list of forces evaluated every slow_interval steps
+    std::vector<std::shared_ptr<ForceCompute>>& getSlowForces()
+        {
+        return m_slow_forces;
+        }
+
+    /// Set the number of steps between evaluations of the slow forces
+    void setSlowInterval(unsigned int slow_interval);
+
+    /// Get the number of steps between evaluations of the slow forces
+    unsigned int getSlowInterval()
+        {
+        return m_slow_interval;
+        }
+
     /// Get the number of degrees of freedom granted to a given group
     virtual Scalar getTranslationalDOF(std::shared_ptr<ParticleGroup> group);
 
@@ -93,6 +116,12 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
     /// Check if any forces introduce anisotropic degrees of freedom
     virtual bool areForcesAnisotropic();
 
+    /// Estimate the cost of a time step on the local particles
+    virtual double getLocalCost();
+
+    /// Get the total wall clock time of the forces that compute without communication in seconds
+    virtual double getTotalLocalForceTime();
+
     /// Updates the rigid body constituent particles
     virtual void updateRigidBodies(uint64_t timestep);
 
@@ -127,6 +156,21 @@ class PYBIND11_EXPORT IntegratorTwoStep : public Integrator
 
     /// True when orientation degrees of freedom should be integrated
     bool m_integrate_rotational_dof = false;
+
+    /// Forces evaluated every m_slow_interval steps
+    std::vector<std::shared_ptr<ForceCompute>> m_slow_forces;
+
+    /// Number of steps between evaluations of the slow forces
+    unsigned int m_slow_interval = 1;
+
+    /// Impulses of the forces in m_slow_forces
+    std::vector<std::shared_ptr<ForceImpulse>> m_slow_impulses;
+
+    /// Append the impulses of the slow forces to m_forces on outer steps
+    size_t pushSlowImpulses(uint64_t timestep);
+
+    /// Add the slow forces to the accelerations of a run that starts between outer steps
+    void addSlowAccelerations(uint64_t timestep, unsigned int n_steps);
     };
 
 namespace detail
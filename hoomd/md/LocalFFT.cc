@@ -0,0 +1,256 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "LocalFFT.h"
+
+#ifdef ENABLE_FFTW
+#include <fftw3.h>
+#include <type_traits>
+#endif
+
+#include <algorithm>
+
+/*! \file LocalFFT.cc
+    \brief Defines the real to complex 3D FFTs used by PPPMForceCompute on a single rank
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+LocalFFTKiss::LocalFFTKiss(uint3 dim) : LocalFFT(dim)
+    {
+    m_fft_x = kiss_fft_alloc(dim.x, 0, NULL, NULL);
+    m_ifft_x = kiss_fft_alloc(dim.x, 1, NULL, NULL);
+    m_fft_y = kiss_fft_alloc(dim.y, 0, NULL, NULL);
+    m_ifft_y = kiss_fft_alloc(dim.y, 1, NULL, NULL);
+    m_fft_z = kiss_fft_alloc(dim.z, 0, NULL, NULL);
+    m_ifft_z = kiss_fft_alloc(dim.z, 1, NULL, NULL);
+
+    m_row_in.resize(dim.x);
+    m_row_out.resize(std::max(dim.x, std::max(dim.y, dim.z)));
+    }
+
+LocalFFTKiss::~LocalFFTKiss()
+    {
+    kiss_fft_free(m_fft_x);
+    kiss_fft_free(m_ifft_x);
+    kiss_fft_free(m_fft_y);
+    kiss_fft_free(m_ifft_y);
+    kiss_fft_free(m_fft_z);
+    kiss_fft_free(m_ifft_z);
+    kiss_fft_cleanup();
+    }
+
+void LocalFFTKiss::forward(const kiss_fft_scalar* in, kiss_fft_cpx* out)
+    {
+    const unsigned int nx = m_dim.x;
+    const unsigned int nxh = getHalfDimX();
+    const unsigned int n_rows = m_dim.y * m_dim.z;
+
+    // transform two real rows a and b at a time as z = a + i b
+    for (unsigned int row = 0; row < n_rows; row += 2)
+        {
+        const bool pair = row + 1 < n_rows;
+        const kiss_fft_scalar* a = in + row * nx;
+        const kiss_fft_scalar* b = a + nx;
+
+        for (unsigned int x = 0; x < nx; ++x)
+            {
+            m_row_in[x].r = a[x];
+            m_row_in[x].i = pair ? b[x] : kiss_fft_scalar(0.0);
+            }
+
+        kiss_fft(m_fft_x, m_row_in.data(), m_row_out.data());
+
+        // separate the spectra: A_k = (Z_k + Z*_{N-k}) / 2 and B_k = (Z_k - Z*_{N-k}) / 2i
+        kiss_fft_cpx* A = out + row * nxh;
+        kiss_fft_cpx* B = A + nxh;
+        for (unsigned int k = 0; k < nxh; ++k)
+            {
+            kiss_fft_cpx z = m_row_out[k];
+            kiss_fft_cpx z_conj = m_row_out[(nx - k) % nx];
+
+            A[k].r = kiss_fft_scalar(0.5) * (z.r + z_conj.r);
+            A[k].i = kiss_fft_scalar(0.5) * (z.i - z_conj.i);
+
+            if (pair)
+                {
+                B[k].r = kiss_fft_scalar(0.5) * (z.i + z_conj.i);
+                B[k].i = kiss_fft_scalar(0.5) * (z_conj.r - z.r);
+                }
+            }
+        }
+
+    transformYZ(out, false);
+    }
+
+void LocalFFTKiss::inverse(kiss_fft_cpx* in, kiss_fft_scalar* out)
+    {
+    transformYZ(in, true);
+
+    const unsigned int nx = m_dim.x;
+    const unsigned int nxh = getHalfDimX();
+    const unsigned int n_rows = m_dim.y * m_dim.z;
+
+    // transform the spectra of two real rows a and b at a time as z = a + i b
+    for (unsigned int row = 0; row < n_rows; row += 2)
+        {
+        const bool pair = row + 1 < n_rows;
+        const kiss_fft_cpx* A = in + row * nxh;
+        const kiss_fft_cpx* B = A + nxh;
+
+        for (unsigned int k = 0; k < nx; ++k)
+            {
+            // complete the spectra using the Hermitian symmetry
+            kiss_fft_cpx a, b;
+            b.r = b.i = kiss_fft_scalar(0.0);
+            if (k < nxh)
+                {
+                a = A[k];
+                if (pair)
+                    b = B[k];
+                }
+            else
+                {
+                a = A[nx - k];
+                a.i = -a.i;
+                if (pair)
+                    {
+                    b = B[nx - k];
+                    b.i = -b.i;
+                    }
+                }
+
+            // self-conjugate coefficients of a real row are real
+            if (k == 0 || 2 * k == nx)
+                {
+                a.i = kiss_fft_scalar(0.0);
+                b.i = kiss_fft_scalar(0.0);
+                }
+
+            m_row_in[k].r = a.r - b.i;
+            m_row_in[k].i = a.i + b.r;
+            }
+
+        kiss_fft(m_ifft_x, m_row_in.data(), m_row_out.data());
+
+        kiss_fft_scalar* a = out + row * nx;
+        kiss_fft_scalar* b = a + nx;
+        for (unsigned int x = 0; x < nx; ++x)
+            {
+            a[x] = m_row_out[x].r;
+            if (pair)
+                b[x] = m_row_out[x].i;
+            }
+        }
+    }
+
+void LocalFFTKiss::transformYZ(kiss_fft_cpx* data, bool inverse)
+    {
+    const unsigned int nxh = getHalfDimX();
+    const unsigned int ny = m_dim.y;
+    const unsigned int nz = m_dim.z;
+
+    if (ny > 1)
+        {
+        kiss_fft_cfg cfg = inverse ? m_ifft_y : m_fft_y;
+        for (unsigned int z = 0; z < nz; ++z)
+            for (unsigned int kx = 0; kx < nxh; ++kx)
+                {
+                kiss_fft_cpx* column = data + kx + nxh * ny * z;
+                kiss_fft_stride(cfg, column, m_row_out.data(), nxh);
+                for (unsigned int y = 0; y < ny; ++y)
+                    column[y * nxh] = m_row_out[y];
+                }
+        }
+
+    if (nz > 1)
+        {
+        kiss_fft_cfg cfg = inverse ? m_ifft_z : m_fft_z;
+        for (unsigned int i = 0; i < nxh * ny; ++i)
+            {
+            kiss_fft_cpx* column = data + i;
+            kiss_fft_stride(cfg, column, m_row_out.data(), nxh * ny);
+            for (unsigned int z = 0; z < nz; ++z)
+                column[z * nxh * ny] = m_row_out[z];
+            }
+        }
+    }
+
+#ifdef ENABLE_FFTW
+static_assert(std::is_same<kiss_fft_scalar, float>::value,
+              "The FFTW backend requires single precision KISS FFT types");
+
+//! Real to complex FFT using the single precision FFTW library
+class LocalFFTW : public LocalFFT
+    {
+    public:
+    //! Constructor
+    LocalFFTW(uint3 dim) : LocalFFT(dim)
+        {
+        // plan on scratch arrays, the mesh arrays are passed to the new-array execute functions
+        float* real = fftwf_alloc_real(dim.x * dim.y * dim.z);
+        fftwf_complex* half = fftwf_alloc_complex(getNHalf());
+
+        m_forward = fftwf_plan_dft_r2c_3d(dim.z,
+                                          dim.y,
+                                          dim.x,
+                                          real,
+                                          half,
+                                          FFTW_MEASURE | FFTW_UNALIGNED);
+        m_inverse = fftwf_plan_dft_c2r_3d(dim.z,
+                                          dim.y,
+                                          dim.x,
+                                          half,
+                                          real,
+                                          FFTW_MEASURE | FFTW_UNALIGNED);
+
+        fftwf_free(real);
+        fftwf_free(half);
+        }
+
+    //! Destructor
+    virtual ~LocalFFTW()
+        {
+        fftwf_destroy_plan(m_forward);
+        fftwf_destroy_plan(m_inverse);
+        }
+
+    virtual void forward(const kiss_fft_scalar* in, kiss_fft_cpx* out)
+        {
+        fftwf_execute_dft_r2c(m_forward,
+                              const_cast<float*>(in),
+                              reinterpret_cast<fftwf_complex*>(out));
+        }
+
+    virtual void inverse(kiss_fft_cpx* in, kiss_fft_scalar* out)
+        {
+        fftwf_execute_dft_c2r(m_inverse, reinterpret_cast<fftwf_complex*>(in), out);
+        }
+
+    virtual std::string getName() const
+        {
+        return std::string(fftwf_version);
+        }
+
+    private:
+    fftwf_plan m_forward; //!< Real to complex plan
+    fftwf_plan m_inverse; //!< Complex to real plan
+    };
+#endif
+
+std::unique_ptr<LocalFFT> makeLocalFFT(uint3 dim)
+    {
+#ifdef ENABLE_FFTW
+    return std::unique_ptr<LocalFFT>(new LocalFFTW(dim));
+#else
+    return std::unique_ptr<LocalFFT>(new LocalFFTKiss(dim));
+#endif
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
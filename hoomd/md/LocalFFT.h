@@ -0,0 +1,131 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __LOCAL_FFT_H__
+#define __LOCAL_FFT_H__
+
+#include "hoomd/HOOMDMath.h"
+#include "hoomd/extern/kiss_fft.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/*! \file LocalFFT.h
+    \brief Declares the real to complex 3D FFTs used by PPPMForceCompute on a single rank
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+namespace detail
+    {
+//! Real to complex 3D FFT of a mesh stored on a single rank
+/*! The real mesh has dim.x * dim.y * dim.z points in row major order with x running fastest
+    (index x + dim.x * (y + dim.y * z)). Because the transform of a real mesh is Hermitian, only the
+    wave vectors with kx = 0 ... dim.x / 2 are stored: the half spectrum has getNHalf() values with
+    index kx + getHalfDimX() * (ky + dim.y * kz).
+
+    Both transforms are unnormalized, inverse(forward(rho)) = N * rho where N is the number of mesh
+    points. Use makeLocalFFT() to construct the backend selected at configure time.
+*/
+class LocalFFT
+    {
+    public:
+    //! Constructor
+    /*! \param dim Mesh dimensions
+     */
+    LocalFFT(uint3 dim) : m_dim(dim) { }
+
+    //! Destructor
+    virtual ~LocalFFT() { }
+
+    //! Get the number of stored x wave vectors
+    unsigned int getHalfDimX() const
+        {
+        return m_dim.x / 2 + 1;
+        }
+
+    //! Get the number of values in the half spectrum
+    unsigned int getNHalf() const
+        {
+        return getHalfDimX() * m_dim.y * m_dim.z;
+        }
+
+    //! Transform a real mesh to its half spectrum
+    /*! \param in Real mesh with dim.x * dim.y * dim.z values
+        \param out Half spectrum with getNHalf() values (output)
+    */
+    virtual void forward(const kiss_fft_scalar* in, kiss_fft_cpx* out) = 0;
+
+    //! Transform a half spectrum back to a real mesh
+    /*! \param in Half spectrum with getNHalf() values, overwritten by the transform
+        \param out Real mesh with dim.x * dim.y * dim.z values (output)
+
+        The imaginary parts of the self-conjugate wave vectors are ignored, i.e. \a out is the real
+        part of the complex to complex transform of the full spectrum.
+    */
+    virtual void inverse(kiss_fft_cpx* in, kiss_fft_scalar* out) = 0;
+
+    //! Get the name of the FFT library
+    virtual std::string getName() const = 0;
+
+    protected:
+    uint3 m_dim; //!< Mesh dimensions
+    };
+
+//! Real to complex FFT built from one dimensional KISS FFTs
+/*! The x transform packs two real rows into the real and imaginary parts of one complex transform
+    and separates their spectra using the Hermitian symmetry. The y and z transforms are complex to
+    complex transforms of the half spectrum.
+*/
+class LocalFFTKiss : public LocalFFT
+    {
+    public:
+    //! Constructor
+    LocalFFTKiss(uint3 dim);
+
+    //! Destructor
+    virtual ~LocalFFTKiss();
+
+    virtual void forward(const kiss_fft_scalar* in, kiss_fft_cpx* out);
+
+    virtual void inverse(kiss_fft_cpx* in, kiss_fft_scalar* out);
+
+    virtual std::string getName() const
+        {
+        return "KISS FFT";
+        }
+
+    private:
+    kiss_fft_cfg m_fft_x;  //!< Forward transform along x
+    kiss_fft_cfg m_ifft_x; //!< Inverse transform along x
+    kiss_fft_cfg m_fft_y;  //!< Forward transform along y
+    kiss_fft_cfg m_ifft_y; //!< Inverse transform along y
+    kiss_fft_cfg m_fft_z;  //!< Forward transform along z
+    kiss_fft_cfg m_ifft_z; //!< Inverse transform along z
+
+    std::vector<kiss_fft_cpx> m_row_in;  //!< Packed rows (temporary)
+    std::vector<kiss_fft_cpx> m_row_out; //!< Transformed rows (temporary)
+
+    //! Complex transforms along y and z of the half spectrum, in place
+    void transformYZ(kiss_fft_cpx* data, bool inverse);
+    };
+
+//! Construct the local FFT of the library selected at configure time
+/*! \param dim Mesh dimensions
+
+    Returns a FFTW backend in builds with ENABLE_FFTW and a LocalFFTKiss otherwise.
+*/
+std::unique_ptr<LocalFFT> makeLocalFFT(uint3 dim);
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __LOCAL_FFT_H__
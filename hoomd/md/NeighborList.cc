@@ -33,7 +33,7 @@ NeighborList::NeighborList(std::shared_ptr<SystemDefinition> sysdef, Scalar r_bu
     : Compute(sysdef), m_typpair_idx(m_pdata->getNTypes()), m_rcut_max_max(0.0), m_rcut_min(0.0),
       m_r_buff(r_buff), m_d_max(1.0), m_filter_body(false), m_diameter_shift(false),
       m_storage_mode(half), m_rcut_changed(true), m_updates(0), m_forced_updates(0),
-      m_dangerous_updates(0), m_force_update(true), m_dist_check(true),
+      m_dangerous_updates(0), m_skipped_checks(0), m_force_update(true), m_dist_check(true),
       m_has_been_updated_once(false)
     {
     m_exec_conf->msg->notice(5) << "Constructing Neighborlist" << endl;
@@ -386,6 +386,10 @@ void NeighborList::compute(uint64_t timestep)
     // check if the list needs to be updated and update it
     if (needsUpdating(timestep))
         {
+        // the adaptive mode may have changed the buffer
+        if (m_rcut_changed)
+            updateRList();
+
         // check simulation box size is OK
         checkBoxSize();
 
@@ -466,6 +470,57 @@ void NeighborList::setRBuff(Scalar r_buff)
         }
     notifyRCutMatrixChange();
     forceUpdate();
+
+    // restart the tuning from the new buffer
+    m_tuner = RBuffTuner();
+    }
+
+/*! \param adaptive Set to true to enable the adaptive mode
+ */
+void NeighborList::setAdaptive(bool adaptive)
+    {
+    m_adaptive = adaptive;
+    m_displacement_rate = 0;
+    m_next_check_tstep = 0;
+    m_tuner = RBuffTuner();
+    }
+
+/*! \returns The largest buffer for which the neighbor list still fits in the local box of every
+    rank, with a 10% margin
+
+    \note With domain decomposition, all ranks must call this method.
+*/
+Scalar NeighborList::getMaxRBuff()
+    {
+    const BoxDim& box = m_pdata->getBox();
+    const uchar3 periodic = box.getPeriodic();
+    const Scalar3 nearest_plane_distance = box.getNearestPlaneDistance();
+
+    Scalar min_distance = std::numeric_limits<Scalar>::max();
+    if (periodic.x)
+        min_distance = std::min(min_distance, nearest_plane_distance.x);
+    if (periodic.y)
+        min_distance = std::min(min_distance, nearest_plane_distance.y);
+    if (m_sysdef->getNDimensions() == 3 && periodic.z)
+        min_distance = std::min(min_distance, nearest_plane_distance.z);
+
+    Scalar rmax = getMaxRList() - m_r_buff;
+    Scalar max_r_buff = Scalar(0.9) * (min_distance / Scalar(2.0) - rmax);
+
+#ifdef ENABLE_MPI
+    // the local boxes differ between ranks, which must all choose the same buffer
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &max_r_buff,
+                      1,
+                      MPI_HOOMD_SCALAR,
+                      MPI_MIN,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    return max_r_buff;
     }
 
 void NeighborList::updateRList()
@@ -1262,6 +1317,9 @@ bool NeighborList::distanceCheck(uint64_t timestep)
     ArrayHandle<Scalar4> h_last_pos(m_last_pos, access_location::host, access_mode::read);
     ArrayHandle<Scalar> h_rcut_max(m_rcut_max, access_location::host, access_mode::read);
 
+    // largest squared displacement relative to the allowed one
+    Scalar max_fraction_sq = 0;
+
     for (unsigned int i = 0; i < m_pdata->getN(); i++)
         {
         const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
@@ -1282,10 +1340,20 @@ bool NeighborList::distanceCheck(uint64_t timestep)
 
         dx = box.minImage(dx);
 
-        if (dot(dx, dx) >= maxsq)
+        Scalar dsq = dot(dx, dx);
+        if (dsq >= maxsq)
             {
             result = true;
-            break;
+
+            // the adaptive mode needs the largest displacement of all particles
+            if (!m_adaptive)
+                break;
+            }
+
+        if (m_adaptive)
+            {
+            Scalar fraction_sq = (maxsq > 0) ? dsq / maxsq : Scalar(1.0);
+            max_fraction_sq = std::max(max_fraction_sq, fraction_sq);
             }
         }
 
@@ -1304,11 +1372,25 @@ bool NeighborList::distanceCheck(uint64_t timestep)
                       MPI_MAX,
                       m_exec_conf->getMPICommunicator());
         result = (global_result > 0);
+
+        if (m_adaptive)
+            {
+            MPI_Allreduce(MPI_IN_PLACE,
+                          &max_fraction_sq,
+                          1,
+                          MPI_HOOMD_SCALAR,
+                          MPI_MAX,
+                          m_exec_conf->getMPICommunicator());
+            }
+
         if (m_prof)
             m_prof->pop();
         }
 #endif
 
+    if (m_adaptive)
+        m_displacement_fraction = sqrt(max_fraction_sq);
+
     // don't worry about computing flops here, this is fast
     if (m_prof)
         m_prof->pop();
@@ -1347,6 +1429,15 @@ void NeighborList::setLastUpdatedPos()
 
 bool NeighborList::shouldCheckDistance(uint64_t timestep)
     {
+    // in adaptive mode, no particle can have moved far enough before the predicted step
+    if (m_adaptive && m_dist_check && timestep < m_next_check_tstep)
+        {
+        // count the checks that rebuild_check_delay alone would have performed
+        if (!m_force_update && timestep >= m_last_updated_tstep + m_rebuild_check_delay)
+            m_skipped_checks++;
+        return false;
+        }
+
     return !m_force_update && !(timestep < (m_last_updated_tstep + m_rebuild_check_delay));
     }
 
@@ -1372,6 +1463,9 @@ bool NeighborList::needsUpdating(uint64_t timestep)
 
     m_last_checked_tstep = timestep;
 
+    if (m_adaptive)
+        tuneRBuff(timestep);
+
     if (!m_force_update && !shouldCheckDistance(timestep))
         {
         m_last_check_result = false;
@@ -1401,6 +1495,12 @@ bool NeighborList::needsUpdating(uint64_t timestep)
         // when an update is forced, there is no way to tell if the build
         // is dangerous or not: filter out the false positive errors
         dangerous = false;
+
+        if (m_adaptive)
+            {
+            m_displacement_fraction = Scalar(-1.0);
+            predictNextCheck(timestep, true);
+            }
         }
     else
         {
@@ -1418,7 +1518,17 @@ bool NeighborList::needsUpdating(uint64_t timestep)
             }
         else
             {
+            // in adaptive mode, a build is dangerous when checks were skipped before it
+            if (m_adaptive
+                && timestep > std::max(m_last_updated_tstep, m_last_distance_check_tstep) + 1)
+                dangerous = true;
+
+            m_displacement_fraction = Scalar(-1.0);
             result = distanceCheck(timestep);
+            m_last_distance_check_tstep = timestep;
+
+            if (m_adaptive)
+                predictNextCheck(timestep, result);
             }
 
         if (result)
@@ -1448,13 +1558,164 @@ bool NeighborList::needsUpdating(uint64_t timestep)
         m_dangerous_updates += 1;
         }
 
+    // the tuned buffer takes effect with the next build, which is also when the communicator
+    // exchanges ghost particles for the new ghost layer width
+    if (result && m_adaptive && m_tuner.pending_r_buff > 0)
+        {
+        // the allowed displacement scales with the buffer
+        m_displacement_rate *= m_r_buff / m_tuner.pending_r_buff;
+        m_r_buff = m_tuner.pending_r_buff;
+        m_tuner.pending_r_buff = 0;
+        notifyRCutMatrixChange();
+        predictNextCheck(timestep, true);
+
+        // start timing the new buffer
+        m_tuner.window_time = 0;
+        m_tuner.window_steps = 0;
+        m_tuner.window_updates = m_updates;
+        }
+
     m_last_check_result = result;
     return result;
     }
 
+/*! \param timestep Current time step
+    \param rebuilt True when the neighbor list is rebuilt in this step
+
+    Updates the estimate of the growth rate of m_displacement_fraction and sets m_next_check_tstep
+    to the step at which half of the remaining allowed displacement may have been used up.
+*/
+void NeighborList::predictNextCheck(uint64_t timestep, bool rebuilt)
+    {
+    // the average rate since the last build underestimates the rate of accelerating particles,
+    // so the largest recent estimate is kept
+    if (m_displacement_fraction >= 0 && timestep > m_last_updated_tstep)
+        {
+        Scalar rate = m_displacement_fraction / Scalar(timestep - m_last_updated_tstep);
+        m_displacement_rate = std::max(rate, m_displacement_rate * Scalar(0.9));
+        }
+    else if (m_displacement_fraction < 0 && !rebuilt)
+        {
+        // the distance check did not measure the displacement, check every step
+        m_next_check_tstep = 0;
+        return;
+        }
+
+    if (m_displacement_rate <= 0)
+        {
+        m_next_check_tstep = 0;
+        return;
+        }
+
+    Scalar fraction = rebuilt ? Scalar(0.0) : m_displacement_fraction;
+    Scalar steps = Scalar(0.5) * (Scalar(1.0) - fraction) / m_displacement_rate;
+    steps = std::min(steps, Scalar(1000.0));
+    m_next_check_tstep = timestep + std::max(uint64_t(1), uint64_t(steps));
+    }
+
+/*! \param timestep Current time step
+
+    Accumulates the time between consecutive steps in windows that span several builds. At the end
+    of each window, compares the time per step with the best one so far and picks the next buffer
+    to try. The search continues in the same direction while the time per step improves and
+    reverses with half the step size when it does not.
+*/
+void NeighborList::tuneRBuff(uint64_t timestep)
+    {
+    if (m_tuner.done)
+        return;
+
+    int64_t now = m_tuner.clock.getTime();
+    bool consecutive = m_tuner.timing && timestep == m_tuner.last_tstep + 1;
+    int64_t elapsed = now - m_tuner.last_time;
+    m_tuner.timing = true;
+    m_tuner.last_tstep = timestep;
+    m_tuner.last_time = now;
+
+    if (m_tuner.best_r_buff == 0)
+        {
+        // nothing to tune without a buffer
+        if (m_r_buff <= 0)
+            {
+            m_tuner.done = true;
+            return;
+            }
+
+        m_tuner.min_r_buff = Scalar(0.25) * m_r_buff;
+        m_tuner.max_r_buff = Scalar(2.0) * m_r_buff;
+        m_tuner.best_r_buff = m_r_buff;
+        }
+
+    // start a new window after a gap, for example between two runs
+    if (!consecutive)
+        {
+        m_tuner.window_time = 0;
+        m_tuner.window_steps = 0;
+        m_tuner.window_updates = m_updates;
+        return;
+        }
+
+    // wait until the next buffer takes effect
+    if (m_tuner.pending_r_buff > 0)
+        return;
+
+    m_tuner.window_time += elapsed;
+    m_tuner.window_steps++;
+
+    // average over several builds so that the window includes the amortized build cost
+    uint64_t builds = m_updates - m_tuner.window_updates;
+    if (m_tuner.window_steps < 2000 && (m_tuner.window_steps < 100 || builds < 4))
+        return;
+
+    double cost = double(m_tuner.window_time) / double(m_tuner.window_steps);
+    m_tuner.window_time = 0;
+    m_tuner.window_steps = 0;
+    m_tuner.window_updates = m_updates;
+
+#ifdef ENABLE_MPI
+    // all ranks must choose the same buffer
+    if (m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      &cost,
+                      1,
+                      MPI_DOUBLE,
+                      MPI_MAX,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    if (m_tuner.best_cost < 0 || cost < m_tuner.best_cost)
+        {
+        m_tuner.best_cost = cost;
+        m_tuner.best_r_buff = m_r_buff;
+        }
+    else
+        {
+        m_tuner.direction = -m_tuner.direction;
+        m_tuner.step *= Scalar(0.5);
+        }
+
+    Scalar next = m_tuner.best_r_buff;
+    if (m_tuner.step < Scalar(0.02))
+        {
+        m_tuner.done = true;
+        m_exec_conf->msg->notice(4) << "nlist: tuned buffer " << next << std::endl;
+        }
+    else
+        {
+        next *= Scalar(1.0) + Scalar(m_tuner.direction) * m_tuner.step;
+        next = std::max(next, m_tuner.min_r_buff);
+        next = std::min(next, std::min(m_tuner.max_r_buff, getMaxRBuff()));
+        }
+
+    if (next != m_r_buff)
+        m_tuner.pending_r_buff = next;
+    }
+
 void NeighborList::resetStats()
     {
-    m_updates = m_forced_updates = m_dangerous_updates = 0;
+    m_updates = m_forced_updates = m_dangerous_updates = m_skipped_checks = 0;
 
     for (unsigned int i = 0; i < m_update_periods.size(); i++)
         m_update_periods[i] = 0;
@@ -1798,6 +2059,7 @@ void export_NeighborList(pybind11::module& m)
                       &NeighborList::getRebuildCheckDelay,
                       &NeighborList::setRebuildCheckDelay)
         .def_property("check_dist", &NeighborList::getDistCheck, &NeighborList::setDistCheck)
+        .def_property("adaptive", &NeighborList::getAdaptive, &NeighborList::setAdaptive)
         .def("setStorageMode", &NeighborList::setStorageMode)
         .def_property("exclusions", &NeighborList::getExclusions, &NeighborList::setExclusions)
         .def_property("diameter_shift",
@@ -1814,6 +2076,8 @@ void export_NeighborList(pybind11::module& m)
         .def("estimateNNeigh", &NeighborList::estimateNNeigh)
         .def("getSmallestRebuild", &NeighborList::getSmallestRebuild)
         .def("getNumUpdates", &NeighborList::getNumUpdates)
+        .def("getNumDangerousUpdates", &NeighborList::getNumDangerousUpdates)
+        .def("getNumSkippedChecks", &NeighborList::getNumSkippedChecks)
         .def("getNumExclusions", &NeighborList::getNumExclusions);
 
     pybind11::enum_<NeighborList::storageMode>(nlist, "storageMode")
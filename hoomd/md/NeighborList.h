@@ -1,6 +1,7 @@
 // Copyright (c) 2009-2022 The Regents of the University of Michigan.
 // Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+#include "hoomd/ClockSource.h"
 #include "hoomd/Compute.h"
 #include "hoomd/GPUFlags.h"
 #include "hoomd/GPUVector.h"
@@ -97,6 +98,13 @@ namespace md
    dist_check=True, the above described behavior is followed. When dist_check is false, the nlist is
    built exactly m_rebuild_check_delay steps. This is intended for use in profiling only.
 
+    In adaptive mode (setAdaptive()), distanceCheck() measures the largest displacement of any
+    particle relative to the allowed one. needsUpdating() tracks the rate at which this fraction
+    grows and skips the O(N) check until the earliest step at which it could exceed 1. The buffer
+    distance is also tuned online: tuneRBuff() times the steps between the rebuild checks and moves
+    the buffer towards the value with the lowest time per step. A new buffer takes effect with the
+    next build, before the ghost particles are exchanged for it.
+
     \b Exclusions:
 
     Exclusions are stored in \a ex_list, a data structure similar in structure to \a nlist, except
@@ -214,6 +222,14 @@ class PYBIND11_EXPORT NeighborList : public Compute
         return m_dist_check;
         }
 
+    //! Enable or disable the adaptive rebuild check and buffer tuning
+    void setAdaptive(bool adaptive);
+
+    bool getAdaptive()
+        {
+        return m_adaptive;
+        }
+
     //! Set the storage mode
     /*! \param mode Storage mode to set
         - half only stores neighbors where i < j
@@ -288,6 +304,18 @@ class PYBIND11_EXPORT NeighborList : public Compute
     //! Gets the shortest rebuild period this nlist has experienced since a call to resetStats
     unsigned int getSmallestRebuild();
 
+    //! Get the number of dangerous builds since the last call to resetStats
+    uint64_t getNumDangerousUpdates()
+        {
+        return m_dangerous_updates;
+        }
+
+    //! Get the number of distance checks skipped in adaptive mode since the last call to resetStats
+    uint64_t getNumSkippedChecks()
+        {
+        return m_skipped_checks;
+        }
+
     // @}
     //! \name Get data
     // @{
@@ -538,6 +566,10 @@ class PYBIND11_EXPORT NeighborList : public Compute
     std::shared_ptr<Communicator> m_comm;
 #endif
 
+    /// Largest displacement since the last build relative to the allowed displacement, measured
+    /// by distanceCheck() in adaptive mode (negative when not measured)
+    Scalar m_displacement_fraction = Scalar(-1.0);
+
     //! Return true if we are supposed to do a distance check in this time step
     bool shouldCheckDistance(uint64_t timestep);
 
@@ -605,6 +637,7 @@ class PYBIND11_EXPORT NeighborList : public Compute
     uint64_t m_updates;           //!< Number of times the neighbor list has been updated
     uint64_t m_forced_updates;    //!< Number of times the neighbor list has been forcibly updated
     uint64_t m_dangerous_updates; //!< Number of dangerous builds counted
+    uint64_t m_skipped_checks;    //!< Number of distance checks skipped in adaptive mode
     bool m_force_update;          //!< Flag to handle the forcing of neighborlist updates
     bool m_dist_check;            //!< Set to false to disable distance checks (nlist always built
                                   //!< m_rebuild_check_delay steps)
@@ -618,9 +651,45 @@ class PYBIND11_EXPORT NeighborList : public Compute
     std::vector<uint64_t> m_update_periods; //!< Steps between updates
     std::set<std::string> m_exclusions;     //!< Exclusions that have been set
 
+    bool m_adaptive = false;                  //!< True when the adaptive mode is enabled
+    Scalar m_displacement_rate = 0;           //!< Growth of m_displacement_fraction per step
+    uint64_t m_next_check_tstep = 0;          //!< Earliest step of the next distance check
+    uint64_t m_last_distance_check_tstep = 0; //!< Step of the last distance check
+
+    //! State of the online buffer tuning in adaptive mode
+    struct RBuffTuner
+        {
+        ClockSource clock;           //!< Times the steps
+        bool timing = false;         //!< True when last_tstep and last_time are set
+        uint64_t last_tstep = 0;     //!< Time step of the previous check
+        int64_t last_time = 0;       //!< Clock time of the previous check (ns)
+        int64_t window_time = 0;     //!< Time spent in the current window (ns)
+        uint64_t window_steps = 0;   //!< Steps in the current window
+        uint64_t window_updates = 0; //!< Value of m_updates at the start of the window
+        Scalar min_r_buff = 0;       //!< Smallest buffer to try
+        Scalar max_r_buff = 0;       //!< Largest buffer to try
+        Scalar best_r_buff = 0;      //!< Buffer with the lowest time per step so far
+        double best_cost = -1.0;     //!< Time per step with best_r_buff (ns), negative if unset
+        Scalar pending_r_buff = 0;   //!< Buffer to set at the next build, 0 if none
+        Scalar step = Scalar(0.2);   //!< Relative change of the buffer between windows
+        int direction = 1;           //!< Direction of the next change
+        bool done = false;           //!< True when the tuning has converged
+        };
+
+    RBuffTuner m_tuner; //!< Buffer tuning state
+
     //! Test if the list needs updating
     bool needsUpdating(uint64_t timestep);
 
+    //! Schedule the next distance check in adaptive mode
+    void predictNextCheck(uint64_t timestep, bool rebuilt);
+
+    //! Time the last step and choose the next buffer to try in adaptive mode
+    void tuneRBuff(uint64_t timestep);
+
+    //! Get the largest buffer that fits in the box
+    Scalar getMaxRBuff();
+
     //! Reallocate internal neighbor list data structures
     void reallocate();
 
@@ -11,6 +11,11 @@
 #include "hoomd/Communicator.h"
 #endif
 
+#ifdef ENABLE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
 using namespace std;
 
 namespace hoomd
@@ -24,7 +29,7 @@ NeighborListBinned::NeighborListBinned(std::shared_ptr<SystemDefinition> sysdef,
 
     m_cl->setRadius(1);
     m_cl->setComputeXYZF(true);
-    m_cl->setComputeTDB(false);
+    m_cl->setComputeTDB(true);
     m_cl->setFlagIndex();
     }
 
@@ -76,6 +81,7 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
                                      access_location::host,
                                      access_mode::read);
+    ArrayHandle<Scalar4> h_cell_tdb(m_cl->getTDBArray(), access_location::host, access_mode::read);
     ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
                                          access_location::host,
                                          access_mode::read);
@@ -100,100 +106,135 @@ void NeighborListBinned::buildNlist(uint64_t timestep)
     // for each local particle
     unsigned int nparticles = m_pdata->getN();
 
-    for (int i = 0; i < (int)nparticles; i++)
-        {
-        unsigned int cur_n_neigh = 0;
-
-        const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
-        const unsigned int body_i = h_body.data[i];
-        const Scalar diam_i = h_diameter.data[i];
-
-        const unsigned int Nmax_i = h_Nmax.data[type_i];
-        const size_t head_idx_i = h_head_list.data[i];
-
-        // find the bin each particle belongs in
-        Scalar3 f = box.makeFraction(my_pos, ghost_width);
-        int ib = (unsigned int)(f.x * dim.x);
-        int jb = (unsigned int)(f.y * dim.y);
-        int kb = (unsigned int)(f.z * dim.z);
-
-        // need to handle the case where the particle is exactly at the box hi
-        if (ib == (int)dim.x && periodic.x)
-            ib = 0;
-        if (jb == (int)dim.y && periodic.y)
-            jb = 0;
-        if (kb == (int)dim.z && periodic.z)
-            kb = 0;
-
-        // identify the bin
-        unsigned int my_cell = ci(ib, jb, kb);
-
-        // loop through all neighboring bins
-        for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+    // find the neighbors of particles [first, last), recording overflows in conditions
+    auto build_range = [&](unsigned int first, unsigned int last, unsigned int* conditions)
+    {
+        for (unsigned int i = first; i < last; i++)
             {
-            unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
-
-            // check against all the particles in that neighboring bin to see if it is a neighbor
-            unsigned int size = h_cell_size.data[neigh_cell];
-            for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
+            unsigned int cur_n_neigh = 0;
+
+            const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int body_i = h_body.data[i];
+            const Scalar diam_i = h_diameter.data[i];
+
+            const unsigned int Nmax_i = h_Nmax.data[type_i];
+            const size_t head_idx_i = h_head_list.data[i];
+
+            // find the bin each particle belongs in
+            Scalar3 f = box.makeFraction(my_pos, ghost_width);
+            int ib = (unsigned int)(f.x * dim.x);
+            int jb = (unsigned int)(f.y * dim.y);
+            int kb = (unsigned int)(f.z * dim.z);
+
+            // need to handle the case where the particle is exactly at the box hi
+            if (ib == (int)dim.x && periodic.x)
+                ib = 0;
+            if (jb == (int)dim.y && periodic.y)
+                jb = 0;
+            if (kb == (int)dim.z && periodic.z)
+                kb = 0;
+
+            // identify the bin
+            unsigned int my_cell = ci(ib, jb, kb);
+
+            // loop through all neighboring bins
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
                 {
-                Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
-                unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
-
-                // get the current neighbor type from the position data (will use tdb on the GPU)
-                unsigned int cur_neigh_type = __scalar_as_int(h_pos.data[cur_neigh].w);
-                Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
-
-                // automatically exclude particles without a distance check when:
-                // (1) they are the same particle, or
-                // (2) the r_cut(i,j) indicates to skip, or
-                // (3) they are in the same body
-                bool excluded = ((i == (int)cur_neigh) || (r_cut <= Scalar(0.0)));
-                if (m_filter_body && body_i != NO_BODY)
-                    excluded = excluded | (body_i == h_body.data[cur_neigh]);
-                if (excluded)
-                    continue;
-
-                Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
-                Scalar3 dx = my_pos - neigh_pos;
-                dx = box.minImage(dx);
-
-                Scalar r_list = r_cut + m_r_buff;
-                Scalar sqshift = Scalar(0.0);
-                if (m_diameter_shift)
+                unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+
+                // check against all the particles in that neighboring bin to see if it is a
+                // neighbor
+                unsigned int size = h_cell_size.data[neigh_cell];
+                for (unsigned int cur_offset = 0; cur_offset < size; cur_offset++)
                     {
-                    const Scalar delta
-                        = (diam_i + h_diameter.data[cur_neigh]) * Scalar(0.5) - Scalar(1.0);
-                    // r^2 < (r_list + delta)^2
-                    // r^2 < r_listsq + delta^2 + 2*r_list*delta
-                    sqshift = (delta + Scalar(2.0) * r_list) * delta;
-                    }
+                    Scalar4& cur_xyzf = h_cell_xyzf.data[cli(cur_offset, neigh_cell)];
+                    unsigned int cur_neigh = __scalar_as_int(cur_xyzf.w);
+
+                    // read the neighbor type, diameter, and body from the cell list, which stores
+                    // them contiguously per cell
+                    const Scalar4& cur_tdb = h_cell_tdb.data[cli(cur_offset, neigh_cell)];
+                    unsigned int cur_neigh_type = __scalar_as_int(cur_tdb.x);
+                    Scalar r_cut = h_r_cut.data[m_typpair_idx(type_i, cur_neigh_type)];
+
+                    // automatically exclude particles without a distance check when:
+                    // (1) they are the same particle, or
+                    // (2) the r_cut(i,j) indicates to skip, or
+                    // (3) they are in the same body
+                    bool excluded = ((i == cur_neigh) || (r_cut <= Scalar(0.0)));
+                    if (m_filter_body && body_i != NO_BODY)
+                        excluded = excluded | (body_i == (unsigned int)__scalar_as_int(cur_tdb.z));
+                    if (excluded)
+                        continue;
+
+                    Scalar3 neigh_pos = make_scalar3(cur_xyzf.x, cur_xyzf.y, cur_xyzf.z);
+                    Scalar3 dx = my_pos - neigh_pos;
+                    dx = box.minImage(dx);
+
+                    Scalar r_list = r_cut + m_r_buff;
+                    Scalar sqshift = Scalar(0.0);
+                    if (m_diameter_shift)
+                        {
+                        const Scalar delta = (diam_i + cur_tdb.y) * Scalar(0.5) - Scalar(1.0);
+                        // r^2 < (r_list + delta)^2
+                        // r^2 < r_listsq + delta^2 + 2*r_list*delta
+                        sqshift = (delta + Scalar(2.0) * r_list) * delta;
+                        }
 
-                Scalar dr_sq = dot(dx, dx);
+                    Scalar dr_sq = dot(dx, dx);
 
-                // move the squared rlist by the diameter shift if necessary
-                Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
-                if (dr_sq <= (r_listsq + sqshift) && !excluded)
-                    {
-                    if (m_storage_mode == full || i < (int)cur_neigh)
+                    // move the squared rlist by the diameter shift if necessary
+                    Scalar r_listsq = h_r_listsq.data[m_typpair_idx(type_i, cur_neigh_type)];
+                    if (dr_sq <= (r_listsq + sqshift) && !excluded)
                         {
-                        // local neighbor
-                        if (cur_n_neigh < Nmax_i)
+                        if (m_storage_mode == full || i < cur_neigh)
                             {
-                            h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                            // local neighbor
+                            if (cur_n_neigh < Nmax_i)
+                                {
+                                h_nlist.data[head_idx_i + cur_n_neigh] = cur_neigh;
+                                }
+                            else
+                                conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+                            cur_n_neigh++;
                             }
-                        else
-                            h_conditions.data[type_i]
-                                = max(h_conditions.data[type_i], cur_n_neigh + 1);
-
-                        cur_n_neigh++;
                         }
                     }
                 }
+
+            h_n_neigh.data[i] = cur_n_neigh;
             }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each particle owns its own segment of the neighbor list, only the overflow conditions
+        // are shared between threads
+        const unsigned int n_types = m_pdata->getNTypes();
+        tbb::enumerable_thread_specific<std::vector<unsigned int>> thread_conditions(
+            std::vector<unsigned int>(n_types, 0));
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, nparticles),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    { build_range(r.begin(), r.end(), thread_conditions.local().data()); });
+            });
 
-        h_n_neigh.data[i] = cur_n_neigh;
+        for (const auto& conditions : thread_conditions)
+            {
+            for (unsigned int type = 0; type < n_types; ++type)
+                h_conditions.data[type] = max(h_conditions.data[type], conditions[type]);
+            }
+        }
+    else
+#endif
+        {
+        build_range(0, nparticles, h_conditions.data);
         }
 
     if (m_prof)
@@ -0,0 +1,475 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+/*! \file NeighborListCluster.cc
+    \brief Defines NeighborListCluster
+*/
+
+#include "NeighborListCluster.h"
+
+#ifdef ENABLE_MPI
+#include "hoomd/Communicator.h"
+#endif
+
+#ifdef ENABLE_TBB
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
+
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+namespace hoomd
+    {
+namespace md
+    {
+NeighborListCluster::NeighborListCluster(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff)
+    : NeighborList(sysdef, r_buff), m_cl(std::make_shared<CellList>(sysdef))
+    {
+    m_exec_conf->msg->notice(5) << "Constructing NeighborListCluster" << endl;
+
+    m_cl->setRadius(1);
+    m_cl->setComputeXYZF(true);
+    m_cl->setComputeTDB(false);
+    m_cl->setFlagIndex();
+    }
+
+NeighborListCluster::~NeighborListCluster()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying NeighborListCluster" << endl;
+    }
+
+/*! The positions are copied again when the particle positions or the clusters have changed since
+    the last call. Call before acquiring the particle positions.
+*/
+const NeighborListCluster::ClusterPositions& NeighborListCluster::getClusterPositions()
+    {
+    const GlobalArray<Scalar4>& pos = m_pdata->getPositions();
+    if (m_cluster_pos_valid && m_cluster_pos_count == pos.getModificationCount())
+        return m_cluster_pos;
+
+    ArrayHandle<Scalar4> h_pos(pos, access_location::host, access_mode::read);
+
+    const size_t n_slots = m_cluster_particles.size();
+    m_cluster_pos.x.resize(n_slots);
+    m_cluster_pos.y.resize(n_slots);
+    m_cluster_pos.z.resize(n_slots);
+    m_cluster_pos.type.resize(n_slots);
+
+    for (size_t slot = 0; slot < n_slots; slot++)
+        {
+        const unsigned int idx = m_cluster_particles[slot];
+
+        // padding entries are never set in the masks
+        Scalar4 postype = make_scalar4(0, 0, 0, __int_as_scalar(0));
+        if (idx != no_particle)
+            postype = h_pos.data[idx];
+
+        m_cluster_pos.x[slot] = postype.x;
+        m_cluster_pos.y[slot] = postype.y;
+        m_cluster_pos.z[slot] = postype.z;
+        m_cluster_pos.type[slot] = __scalar_as_int(postype.w);
+        }
+
+    m_cluster_pos_count = pos.getModificationCount();
+    m_cluster_pos_valid = true;
+    return m_cluster_pos;
+    }
+
+/*! \param particles Indices of the particles in one cell, reordered in place
+    \param pos Particle positions
+
+    Sorts the particles along x and splits them into n_columns slabs, sorts each slab along y and
+    splits it into n_columns columns, and sorts each column along z. Every slab and column holds a
+    whole number of clusters, so only the last cluster of the cell may be partially filled. With
+    n_columns the cube root of the number of clusters, the clusters are roughly cubic.
+*/
+void NeighborListCluster::sortIntoClusters(std::vector<unsigned int>& particles, const Scalar4* pos)
+    {
+    const unsigned int n = (unsigned int)particles.size();
+    const unsigned int n_clusters = (n + cluster_size - 1) / cluster_size;
+    const unsigned int n_columns
+        = std::max(1u, (unsigned int)std::lround(std::cbrt(double(n_clusters))));
+
+    // sort the particles of the clusters [c_first, c_last) along direction dim
+    auto sort_clusters = [&](unsigned int c_first, unsigned int c_last, unsigned int dim)
+    {
+        auto coord = [&](unsigned int idx)
+        { return dim == 0 ? pos[idx].x : (dim == 1 ? pos[idx].y : pos[idx].z); };
+
+        std::sort(particles.begin() + std::min(n, c_first * cluster_size),
+                  particles.begin() + std::min(n, c_last * cluster_size),
+                  [&](unsigned int a, unsigned int b)
+                  { return coord(a) < coord(b) || (coord(a) == coord(b) && a < b); });
+    };
+
+    sort_clusters(0, n_clusters, 0);
+    for (unsigned int slab = 0; slab < n_columns; slab++)
+        {
+        const unsigned int slab_first = n_clusters * slab / n_columns;
+        const unsigned int slab_size = n_clusters * (slab + 1) / n_columns - slab_first;
+        sort_clusters(slab_first, slab_first + slab_size, 1);
+
+        for (unsigned int column = 0; column < n_columns; column++)
+            {
+            sort_clusters(slab_first + slab_size * column / n_columns,
+                          slab_first + slab_size * (column + 1) / n_columns,
+                          2);
+            }
+        }
+    }
+
+/*! Numbers the clusters of local particles first, cell by cell, followed by the clusters of ghost
+    particles, and computes the bounding box of every cluster.
+*/
+void NeighborListCluster::buildClusters()
+    {
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_cell_size(m_cl->getCellSizeArray(),
+                                          access_location::host,
+                                          access_mode::read);
+    ArrayHandle<Scalar4> h_cell_xyzf(m_cl->getXYZFArray(),
+                                     access_location::host,
+                                     access_mode::read);
+
+    const Index2D& cli = m_cl->getCellListIndexer();
+    const unsigned int n_cells = m_cl->getCellIndexer().getNumElements();
+    const unsigned int N = m_pdata->getN();
+
+    // count the clusters in each cell
+    m_cell_local_clusters.assign(n_cells + 1, 0);
+    m_cell_ghost_clusters.assign(n_cells + 1, 0);
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        unsigned int n_local = 0;
+        const unsigned int size = h_cell_size.data[cell];
+        for (unsigned int offset = 0; offset < size; offset++)
+            {
+            if ((unsigned int)__scalar_as_int(h_cell_xyzf.data[cli(offset, cell)].w) < N)
+                n_local++;
+            }
+
+        m_cell_local_clusters[cell + 1] = (n_local + cluster_size - 1) / cluster_size;
+        m_cell_ghost_clusters[cell + 1] = (size - n_local + cluster_size - 1) / cluster_size;
+        }
+
+    // prefix sums, the ghost clusters follow the local ones
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_cell_local_clusters[cell + 1] += m_cell_local_clusters[cell];
+    m_n_local_clusters = m_cell_local_clusters[n_cells];
+
+    m_cell_ghost_clusters[0] = m_n_local_clusters;
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        m_cell_ghost_clusters[cell + 1] += m_cell_ghost_clusters[cell];
+    const unsigned int n_clusters = m_cell_ghost_clusters[n_cells];
+
+    m_cluster_particles.assign(size_t(n_clusters) * cluster_size, no_particle);
+    m_cluster_cell.resize(m_n_local_clusters);
+    m_cluster_center.resize(n_clusters);
+    m_cluster_half_width.resize(n_clusters);
+    m_cluster_pairs.resize(m_n_local_clusters);
+
+    std::vector<unsigned int> local, ghost;
+    for (unsigned int cell = 0; cell < n_cells; cell++)
+        {
+        local.clear();
+        ghost.clear();
+        const unsigned int size = h_cell_size.data[cell];
+        for (unsigned int offset = 0; offset < size; offset++)
+            {
+            unsigned int idx = __scalar_as_int(h_cell_xyzf.data[cli(offset, cell)].w);
+            if (idx < N)
+                local.push_back(idx);
+            else
+                ghost.push_back(idx);
+            }
+
+        sortIntoClusters(local, h_pos.data);
+        sortIntoClusters(ghost, h_pos.data);
+
+        const size_t first_local = size_t(m_cell_local_clusters[cell]) * cluster_size;
+        std::copy(local.begin(), local.end(), m_cluster_particles.begin() + first_local);
+        const size_t first_ghost = size_t(m_cell_ghost_clusters[cell]) * cluster_size;
+        std::copy(ghost.begin(), ghost.end(), m_cluster_particles.begin() + first_ghost);
+
+        for (unsigned int c = m_cell_local_clusters[cell]; c < m_cell_local_clusters[cell + 1]; c++)
+            m_cluster_cell[c] = cell;
+        }
+
+    // bounding boxes
+    for (unsigned int c = 0; c < n_clusters; c++)
+        {
+        Scalar3 lo = make_scalar3(0, 0, 0);
+        Scalar3 hi = make_scalar3(0, 0, 0);
+        for (unsigned int a = 0; a < cluster_size; a++)
+            {
+            unsigned int idx = m_cluster_particles[c * cluster_size + a];
+            if (idx == no_particle)
+                break;
+
+            Scalar3 p = make_scalar3(h_pos.data[idx].x, h_pos.data[idx].y, h_pos.data[idx].z);
+            if (a == 0)
+                {
+                lo = p;
+                hi = p;
+                }
+            lo = make_scalar3(std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z));
+            hi = make_scalar3(std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z));
+            }
+        m_cluster_center[c] = (lo + hi) * Scalar(0.5);
+        m_cluster_half_width[c] = (hi - lo) * Scalar(0.5);
+        }
+    }
+
+void NeighborListCluster::buildNlist(uint64_t timestep)
+    {
+    // update the cell list size if needed
+    Scalar rmax = getMaxRCut() + m_r_buff;
+    if (m_diameter_shift)
+        rmax += m_d_max - Scalar(1.0);
+
+    if (m_update_cell_size)
+        {
+        m_cl->setNominalWidth(rmax);
+        m_update_cell_size = false;
+        }
+
+    m_cl->compute(timestep);
+
+    if (m_prof)
+        m_prof->push(m_exec_conf, "compute");
+
+    buildClusters();
+    m_cluster_pos_valid = false;
+
+    // acquire the particle data and box dimension
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                     access_location::host,
+                                     access_mode::read);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                   access_location::host,
+                                   access_mode::read);
+
+    const BoxDim& box = m_pdata->getBox();
+
+    // access the rlist data
+    ArrayHandle<Scalar> h_r_cut(m_r_cut, access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_r_listsq(m_r_listsq, access_location::host, access_mode::read);
+
+    // access the exclusions
+    ArrayHandle<unsigned int> h_n_ex_idx(m_n_ex_idx, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_ex_list_idx(m_ex_list_idx,
+                                            access_location::host,
+                                            access_mode::read);
+
+    // access the cell adjacency
+    ArrayHandle<unsigned int> h_cell_adj(m_cl->getCellAdjArray(),
+                                         access_location::host,
+                                         access_mode::read);
+    Index2D cadji = m_cl->getCellAdjIndexer();
+
+    // access the neighbor list data
+    ArrayHandle<size_t> h_head_list(m_head_list, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_Nmax(m_Nmax, access_location::host, access_mode::read);
+    ArrayHandle<unsigned int> h_conditions(m_conditions,
+                                           access_location::host,
+                                           access_mode::readwrite);
+    ArrayHandle<unsigned int> h_nlist(m_nlist, access_location::host, access_mode::overwrite);
+    ArrayHandle<unsigned int> h_n_neigh(m_n_neigh, access_location::host, access_mode::overwrite);
+
+    // cluster pairs farther apart than the largest r_list can be skipped
+    const Scalar rmaxsq = rmax * rmax;
+
+    // returns the mask of the pairs of particles in clusters ci and cj that are neighbors
+    auto pair_mask = [&](unsigned int ci, unsigned int cj)
+    {
+        unsigned int mask = 0;
+        for (unsigned int a = 0; a < cluster_size; a++)
+            {
+            const unsigned int i = m_cluster_particles[ci * cluster_size + a];
+            if (i == no_particle)
+                break;
+
+            const Scalar3 my_pos = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+            const unsigned int body_i = h_body.data[i];
+            const Scalar diam_i = h_diameter.data[i];
+            const unsigned int n_ex = m_exclusions_set ? h_n_ex_idx.data[i] : 0;
+
+            for (unsigned int b = 0; b < cluster_size; b++)
+                {
+                const unsigned int j = m_cluster_particles[cj * cluster_size + b];
+                if (j == no_particle)
+                    break;
+
+                // the half list only keeps pairs with i < j
+                if (i == j || (m_storage_mode == half && j < i))
+                    continue;
+
+                const unsigned int type_j = __scalar_as_int(h_pos.data[j].w);
+                const unsigned int typpair_idx = m_typpair_idx(type_i, type_j);
+                Scalar r_cut = h_r_cut.data[typpair_idx];
+                if (r_cut <= Scalar(0.0))
+                    continue;
+                if (m_filter_body && body_i != NO_BODY && body_i == h_body.data[j])
+                    continue;
+
+                Scalar3 neigh_pos = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dx = box.minImage(my_pos - neigh_pos);
+
+                Scalar sqshift = Scalar(0.0);
+                if (m_diameter_shift)
+                    {
+                    const Scalar r_list = r_cut + m_r_buff;
+                    const Scalar delta
+                        = (diam_i + h_diameter.data[j]) * Scalar(0.5) - Scalar(1.0);
+                    sqshift = (delta + Scalar(2.0) * r_list) * delta;
+                    }
+
+                if (dot(dx, dx) > h_r_listsq.data[typpair_idx] + sqshift)
+                    continue;
+
+                bool excluded = false;
+                for (unsigned int k = 0; k < n_ex && !excluded; k++)
+                    excluded = h_ex_list_idx.data[m_ex_list_indexer(i, k)] == j;
+                if (excluded)
+                    continue;
+
+                mask |= 1u << (a * cluster_size + b);
+                }
+            }
+        return mask;
+    };
+
+    // find the cluster pairs of i-clusters [first, last) and write the neighbor lists of their
+    // particles, recording overflows in conditions
+    auto build_range = [&](unsigned int first, unsigned int last, unsigned int* conditions)
+    {
+        for (unsigned int ci = first; ci < last; ci++)
+            {
+            std::vector<ClusterPair>& pairs = m_cluster_pairs[ci];
+            pairs.clear();
+
+            const unsigned int my_cell = m_cluster_cell[ci];
+            const Scalar3 center_i = m_cluster_center[ci];
+            const Scalar3 half_width_i = m_cluster_half_width[ci];
+
+            auto add_cluster = [&](unsigned int cj)
+            {
+                // distance between the bounding boxes
+                Scalar3 d = box.minImage(center_i - m_cluster_center[cj]);
+                const Scalar3 half_width = half_width_i + m_cluster_half_width[cj];
+                d.x = std::max(std::abs(d.x) - half_width.x, Scalar(0.0));
+                d.y = std::max(std::abs(d.y) - half_width.y, Scalar(0.0));
+                d.z = std::max(std::abs(d.z) - half_width.z, Scalar(0.0));
+                if (dot(d, d) > rmaxsq)
+                    return;
+
+                unsigned int mask = pair_mask(ci, cj);
+                if (mask)
+                    pairs.push_back(ClusterPair {cj, mask});
+            };
+
+            // loop through all neighboring bins
+            for (unsigned int cur_adj = 0; cur_adj < cadji.getW(); cur_adj++)
+                {
+                unsigned int neigh_cell = h_cell_adj.data[cadji(cur_adj, my_cell)];
+                for (unsigned int cj = m_cell_local_clusters[neigh_cell];
+                     cj < m_cell_local_clusters[neigh_cell + 1];
+                     cj++)
+                    add_cluster(cj);
+                for (unsigned int cj = m_cell_ghost_clusters[neigh_cell];
+                     cj < m_cell_ghost_clusters[neigh_cell + 1];
+                     cj++)
+                    add_cluster(cj);
+                }
+
+            // write the per particle neighbor lists from the masks
+            for (unsigned int a = 0; a < cluster_size; a++)
+                {
+                const unsigned int i = m_cluster_particles[ci * cluster_size + a];
+                if (i == no_particle)
+                    break;
+
+                const unsigned int type_i = __scalar_as_int(h_pos.data[i].w);
+                const unsigned int Nmax_i = h_Nmax.data[type_i];
+                const size_t head_idx_i = h_head_list.data[i];
+                unsigned int cur_n_neigh = 0;
+
+                for (const ClusterPair& pair : pairs)
+                    {
+                    const unsigned int row_mask = (1u << cluster_size) - 1;
+                    unsigned int row = (pair.mask >> (a * cluster_size)) & row_mask;
+                    for (unsigned int b = 0; row; b++, row >>= 1)
+                        {
+                        if (!(row & 1))
+                            continue;
+
+                        if (cur_n_neigh < Nmax_i)
+                            h_nlist.data[head_idx_i + cur_n_neigh]
+                                = m_cluster_particles[pair.j * cluster_size + b];
+                        else
+                            conditions[type_i] = max(conditions[type_i], cur_n_neigh + 1);
+
+                        cur_n_neigh++;
+                        }
+                    }
+
+                h_n_neigh.data[i] = cur_n_neigh;
+                }
+            }
+    };
+
+#ifdef ENABLE_TBB
+    if (m_exec_conf->getNumThreads() > 1)
+        {
+        // each i-cluster owns its pair list and the neighbor lists of its particles, only the
+        // overflow conditions are shared between threads
+        const unsigned int n_types = m_pdata->getNTypes();
+        tbb::enumerable_thread_specific<std::vector<unsigned int>> thread_conditions(
+            std::vector<unsigned int>(n_types, 0));
+
+        m_exec_conf->getTaskArena()->execute(
+            [&]
+            {
+                tbb::parallel_for(
+                    tbb::blocked_range<unsigned int>(0, m_n_local_clusters),
+                    [&](const tbb::blocked_range<unsigned int>& r)
+                    { build_range(r.begin(), r.end(), thread_conditions.local().data()); });
+            });
+
+        for (const auto& conditions : thread_conditions)
+            {
+            for (unsigned int type = 0; type < n_types; ++type)
+                h_conditions.data[type] = max(h_conditions.data[type], conditions[type]);
+            }
+        }
+    else
+#endif
+        {
+        build_range(0, m_n_local_clusters, h_conditions.data);
+        }
+
+    if (m_prof)
+        m_prof->pop(m_exec_conf);
+    }
+
+namespace detail
+    {
+void export_NeighborListCluster(pybind11::module& m)
+    {
+    pybind11::class_<NeighborListCluster, NeighborList, std::shared_ptr<NeighborListCluster>>(
+        m,
+        "NeighborListCluster")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, Scalar>())
+        .def_property("deterministic",
+                      &NeighborListCluster::getDeterministic,
+                      &NeighborListCluster::setDeterministic);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
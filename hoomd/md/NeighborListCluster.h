@@ -0,0 +1,163 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "NeighborList.h"
+#include "hoomd/CellList.h"
+
+#include <vector>
+
+/*! \file NeighborListCluster.h
+    \brief Declares the NeighborListCluster class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+#include <pybind11/pybind11.h>
+
+#ifndef __NEIGHBORLISTCLUSTER_H__
+#define __NEIGHBORLISTCLUSTER_H__
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Cluster pair neighbor list build on the CPU
+/*! Groups the particles into clusters of cluster_size spatially close particles and stores, for
+    every cluster of local particles (i-cluster), the list of clusters (j-clusters) that contain at
+    least one of its neighbors. Each cluster pair carries a mask with one bit per particle pair,
+    which is set when the pair is in the neighbor list. Pair potentials evaluate a cluster pair as a
+    block of cluster_size x cluster_size pairs whose positions are contiguous in memory (see
+    getClusterPositions()), which vectorizes well on CPUs.
+
+    The clusters are formed in the cells of a cell list. As in GROMACS, the local and the ghost
+    particles of each cell are split along x and y into columns that hold whole clusters, and each
+    column is sorted by z and split into consecutive clusters. The clusters are then compact in all
+    three directions. The i-clusters are numbered before the clusters of ghost particles. Cluster
+    pairs are found among the clusters of adjacent cells and pruned by the distance between their
+    bounding boxes.
+
+    The masks apply the same criteria as NeighborListBinned: the r_cut matrix, the storage mode,
+    body filtering, diameter shifting and the exclusions. buildNlist() also writes the usual per
+    particle neighbor list from the masks, so all consumers of NeighborList work unchanged.
+
+    \ingroup computes
+*/
+class PYBIND11_EXPORT NeighborListCluster : public NeighborList
+    {
+    public:
+    //! Number of particles in a cluster
+    static const unsigned int cluster_size = 4;
+
+    //! Value of padding entries in getClusterParticles()
+    static const unsigned int no_particle = 0xffffffff;
+
+    //! A j-cluster in the list of an i-cluster
+    struct ClusterPair
+        {
+        unsigned int j;    //!< Index of the j-cluster
+        unsigned int mask; //!< Bit a * cluster_size + b is set when (i_a, j_b) are neighbors
+        };
+
+    //! Positions of the particles in cluster order
+    struct ClusterPositions
+        {
+        std::vector<Scalar> x;          //!< x coordinates
+        std::vector<Scalar> y;          //!< y coordinates
+        std::vector<Scalar> z;          //!< z coordinates
+        std::vector<unsigned int> type; //!< Type ids
+        };
+
+    //! Constructs the compute
+    NeighborListCluster(std::shared_ptr<SystemDefinition> sysdef, Scalar r_buff);
+
+    //! Destructor
+    virtual ~NeighborListCluster();
+
+    /// Notify NeighborList that a r_cut matrix value has changed
+    virtual void notifyRCutMatrixChange()
+        {
+        m_update_cell_size = true;
+        NeighborList::notifyRCutMatrixChange();
+        }
+
+    /// Make the neighborlist deterministic
+    void setDeterministic(bool deterministic)
+        {
+        m_cl->setSortCellList(deterministic);
+        }
+
+    /// Get the deterministic flag
+    bool getDeterministic()
+        {
+        return m_cl->getSortCellList();
+        }
+
+    //! Get the number of i-clusters
+    unsigned int getNClusters() const
+        {
+        return m_n_local_clusters;
+        }
+
+    //! Get the particle indices of all clusters
+    /*! Particle b of cluster c is getClusterParticles()[c * cluster_size + b], or no_particle when
+        the cluster has less than cluster_size particles.
+    */
+    const std::vector<unsigned int>& getClusterParticles() const
+        {
+        return m_cluster_particles;
+        }
+
+    //! Get the cluster pairs of i-cluster \a ci
+    const std::vector<ClusterPair>& getClusterPairs(unsigned int ci) const
+        {
+        return m_cluster_pairs[ci];
+        }
+
+    //! Get the particle positions in cluster order
+    const ClusterPositions& getClusterPositions();
+
+    protected:
+    std::shared_ptr<CellList> m_cl; //!< The cell list
+
+    /// Track when the cell size needs to be updated
+    bool m_update_cell_size = true;
+
+    unsigned int m_n_local_clusters = 0;                   //!< Number of i-clusters
+    std::vector<unsigned int> m_cluster_particles;         //!< Particle indices in cluster order
+    std::vector<std::vector<ClusterPair>> m_cluster_pairs; //!< Cluster pairs of each i-cluster
+    std::vector<unsigned int> m_cell_local_clusters;       //!< First i-cluster of each cell
+    std::vector<unsigned int> m_cell_ghost_clusters;       //!< First ghost cluster of each cell
+    std::vector<unsigned int> m_cluster_cell;              //!< Cell of each i-cluster
+    std::vector<Scalar3> m_cluster_center;     //!< Center of the bounding box of each cluster
+    std::vector<Scalar3> m_cluster_half_width; //!< Half width of the bounding box of each cluster
+
+    ClusterPositions m_cluster_pos;   //!< Positions in cluster order
+    bool m_cluster_pos_valid = false; //!< True when m_cluster_pos matches the positions
+    uint64_t m_cluster_pos_count = 0; //!< Modification count of the positions in m_cluster_pos
+
+    //! Builds the neighbor list
+    virtual void buildNlist(uint64_t timestep);
+
+    //! Exclusions are already removed by buildNlist()
+    virtual void filterNlist() { }
+
+    private:
+    //! Sort the particles of each cell into clusters
+    void buildClusters();
+
+    //! Order the particles of one cell so that consecutive groups of cluster_size are compact
+    static void sortIntoClusters(std::vector<unsigned int>& particles, const Scalar4* pos);
+    };
+
+namespace detail
+    {
+//! Exports NeighborListCluster to python
+void export_NeighborListCluster(pybind11::module& m);
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif
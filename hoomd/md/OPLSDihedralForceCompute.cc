@@ -108,7 +108,10 @@ void OPLSDihedralForceCompute::computeForces(uint64_t timestep)
     assert(m_pdata);
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<DihedralData::members_t> h_dihedral_idx(m_dihedral_data->getIndexTable(),
+                                                        access_location::host,
+                                                        access_mode::read);
 
     // access the force and virial tensor arrays
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
@@ -125,7 +128,6 @@ void OPLSDihedralForceCompute::computeForces(uint64_t timestep)
     assert(h_force.data);
     assert(h_virial.data);
     assert(h_pos.data);
-    assert(h_rtag.data);
 
     size_t virial_pitch = m_virial.getPitch();
 
@@ -159,10 +161,10 @@ void OPLSDihedralForceCompute::computeForces(uint64_t timestep)
         assert(dihedral.tag[3] < m_pdata->getNGlobal());
 
         // i1 to i4 are the tags
-        i1 = h_rtag.data[dihedral.tag[0]];
-        i2 = h_rtag.data[dihedral.tag[1]];
-        i3 = h_rtag.data[dihedral.tag[2]];
-        i4 = h_rtag.data[dihedral.tag[3]];
+        i1 = h_dihedral_idx.data[n].idx[0];
+        i2 = h_dihedral_idx.data[n].idx[1];
+        i3 = h_dihedral_idx.data[n].idx[2];
+        i4 = h_dihedral_idx.data[n].idx[3];
 
         // throw an error if this angle is incomplete
         if (i1 == NOT_LOCAL || i2 == NOT_LOCAL || i3 == NOT_LOCAL || i4 == NOT_LOCAL)
@@ -39,7 +39,7 @@ PPPMForceCompute::PPPMForceCompute(std::shared_ptr<SystemDefinition> sysdef,
       m_grid_dim(make_uint3(0, 0, 0)), m_ghost_width(make_scalar3(0, 0, 0)), m_ghost_offset(0),
       m_n_cells(0), m_radius(1), m_n_inner_cells(0), m_need_initialize(true), m_params_set(false),
       m_box_changed(false), m_q(0.0), m_q2(0.0), m_body_energy(0.0), m_ptls_added_removed(false),
-      m_kiss_fft_initialized(false), m_dfft_initialized(false)
+      m_analytic_diff(false), m_n_fourier_cells(0), m_dfft_initialized(false)
     {
     m_pdata->getBoxChangeSignal().connect<PPPMForceCompute, &PPPMForceCompute::setBoxChange>(this);
     // reset virial
@@ -133,17 +133,23 @@ void PPPMForceCompute::setParams(unsigned int nx,
     m_params_set = true;
     }
 
+void PPPMForceCompute::setDifferentiation(const std::string& differentiation)
+    {
+    if (differentiation == "ik")
+        m_analytic_diff = false;
+    else if (differentiation == "ad")
+        m_analytic_diff = true;
+    else
+        throw std::invalid_argument("Invalid PPPM differentiation scheme: " + differentiation);
+
+    m_need_initialize = true;
+    }
+
 PPPMForceCompute::~PPPMForceCompute()
     {
     m_pdata->getGlobalParticleNumberChangeSignal()
         .disconnect<PPPMForceCompute, &PPPMForceCompute::slotGlobalParticleNumberChange>(this);
 
-    if (m_kiss_fft_initialized)
-        {
-        kiss_fft_free(m_kiss_fft);
-        kiss_fft_free(m_kiss_ifft);
-        kiss_fft_cleanup();
-        }
 #ifdef ENABLE_MPI
     if (m_dfft_initialized)
         {
@@ -527,54 +533,102 @@ void PPPMForceCompute::initializeFFT()
 
     if (local_fft)
         {
-        int dims[3];
-        dims[0] = m_mesh_points.z;
-        dims[1] = m_mesh_points.y;
-        dims[2] = m_mesh_points.x;
+        // the mesh is real, so only half of its Fourier transform needs to be stored
+        m_local_fft = detail::makeLocalFFT(m_mesh_points);
+        m_n_fourier_cells = m_local_fft->getNHalf();
+
+        m_exec_conf->msg->notice(4)
+            << "charge.pppm: Using " << m_local_fft->getName() << " for the local FFT" << std::endl;
+
+        // the influence function is only needed for the stored wave vectors
+        GlobalArray<Scalar> inf_f(m_n_fourier_cells, m_exec_conf);
+        m_inf_f.swap(inf_f);
 
-        if (m_kiss_fft)
+        GlobalArray<Scalar3> k(m_n_fourier_cells, m_exec_conf);
+        m_k.swap(k);
+
+        // allocate real meshes
+        GlobalArray<kiss_fft_scalar> real_mesh(m_n_cells, m_exec_conf);
+        m_real_mesh.swap(real_mesh);
+
+        if (m_analytic_diff)
             {
-            kiss_fft_free(m_kiss_fft);
+            GlobalArray<kiss_fft_scalar> real_potential_mesh(m_n_cells, m_exec_conf);
+            m_real_potential_mesh.swap(real_potential_mesh);
             }
-        if (m_kiss_ifft)
+        else
             {
-            kiss_fft_free(m_kiss_ifft);
-            }
+            GlobalArray<kiss_fft_scalar> real_force_mesh_x(m_n_cells, m_exec_conf);
+            m_real_force_mesh_x.swap(real_force_mesh_x);
 
-        m_kiss_fft = kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
-        m_kiss_ifft = kiss_fftnd_alloc(dims, 3, 1, NULL, NULL);
+            GlobalArray<kiss_fft_scalar> real_force_mesh_y(m_n_cells, m_exec_conf);
+            m_real_force_mesh_y.swap(real_force_mesh_y);
 
-        m_kiss_fft_initialized = true;
+            GlobalArray<kiss_fft_scalar> real_force_mesh_z(m_n_cells, m_exec_conf);
+            m_real_force_mesh_z.swap(real_force_mesh_z);
+            }
         }
+    else
+        {
+        m_local_fft.reset();
+        m_n_fourier_cells = m_n_inner_cells;
 
-    // allocate mesh and transformed mesh
+        // allocate complex meshes for the distributed FFT
 
-    // pad with offset
-    GlobalArray<kiss_fft_cpx> mesh(m_n_cells + m_ghost_offset, m_exec_conf);
-    m_mesh.swap(mesh);
+        // pad with offset
+        GlobalArray<kiss_fft_cpx> mesh(m_n_cells + m_ghost_offset, m_exec_conf);
+        m_mesh.swap(mesh);
 
-    GlobalArray<kiss_fft_cpx> fourier_mesh(m_n_inner_cells, m_exec_conf);
-    m_fourier_mesh.swap(fourier_mesh);
+        if (m_analytic_diff)
+            {
+            GlobalArray<kiss_fft_cpx> inv_fourier_mesh_phi(m_n_cells + m_ghost_offset,
+                                                           m_exec_conf);
+            m_inv_fourier_mesh_phi.swap(inv_fourier_mesh_phi);
+            }
+        else
+            {
+            GlobalArray<kiss_fft_cpx> inv_fourier_mesh_x(m_n_cells + m_ghost_offset, m_exec_conf);
+            m_inv_fourier_mesh_x.swap(inv_fourier_mesh_x);
+
+            GlobalArray<kiss_fft_cpx> inv_fourier_mesh_y(m_n_cells + m_ghost_offset, m_exec_conf);
+            m_inv_fourier_mesh_y.swap(inv_fourier_mesh_y);
 
-    GlobalArray<kiss_fft_cpx> fourier_mesh_G_x(m_n_inner_cells, m_exec_conf);
-    m_fourier_mesh_G_x.swap(fourier_mesh_G_x);
+            GlobalArray<kiss_fft_cpx> inv_fourier_mesh_z(m_n_cells + m_ghost_offset, m_exec_conf);
+            m_inv_fourier_mesh_z.swap(inv_fourier_mesh_z);
+            }
+        }
 
-    GlobalArray<kiss_fft_cpx> fourier_mesh_G_y(m_n_inner_cells, m_exec_conf);
-    m_fourier_mesh_G_y.swap(fourier_mesh_G_y);
+    // allocate transformed meshes
+    GlobalArray<kiss_fft_cpx> fourier_mesh(m_n_fourier_cells, m_exec_conf);
+    m_fourier_mesh.swap(fourier_mesh);
 
-    GlobalArray<kiss_fft_cpx> fourier_mesh_G_z(m_n_inner_cells, m_exec_conf);
-    m_fourier_mesh_G_z.swap(fourier_mesh_G_z);
+    if (m_analytic_diff)
+        {
+        GlobalArray<kiss_fft_cpx> fourier_mesh_phi(m_n_fourier_cells, m_exec_conf);
+        m_fourier_mesh_phi.swap(fourier_mesh_phi);
+        }
+    else
+        {
+        GlobalArray<kiss_fft_cpx> fourier_mesh_G_x(m_n_fourier_cells, m_exec_conf);
+        m_fourier_mesh_G_x.swap(fourier_mesh_G_x);
 
-    // pad with offset
+        GlobalArray<kiss_fft_cpx> fourier_mesh_G_y(m_n_fourier_cells, m_exec_conf);
+        m_fourier_mesh_G_y.swap(fourier_mesh_G_y);
 
-    GlobalArray<kiss_fft_cpx> inv_fourier_mesh_x(m_n_cells + m_ghost_offset, m_exec_conf);
-    m_inv_fourier_mesh_x.swap(inv_fourier_mesh_x);
+        GlobalArray<kiss_fft_cpx> fourier_mesh_G_z(m_n_fourier_cells, m_exec_conf);
+        m_fourier_mesh_G_z.swap(fourier_mesh_G_z);
+        }
+    }
 
-    GlobalArray<kiss_fft_cpx> inv_fourier_mesh_y(m_n_cells + m_ghost_offset, m_exec_conf);
-    m_inv_fourier_mesh_y.swap(inv_fourier_mesh_y);
+Scalar PPPMForceCompute::getFourierWeight(unsigned int k)
+    {
+    if (!m_local_fft)
+        return Scalar(1.0);
 
-    GlobalArray<kiss_fft_cpx> inv_fourier_mesh_z(m_n_cells + m_ghost_offset, m_exec_conf);
-    m_inv_fourier_mesh_z.swap(inv_fourier_mesh_z);
+    // a stored kx > 0 also stands for its complex conjugate at -kx, unless kx is the Nyquist
+    // frequency of an even mesh
+    unsigned int kx = k % m_local_fft->getHalfDimX();
+    return (kx == 0 || 2 * kx == m_mesh_points.x) ? Scalar(1.0) : Scalar(2.0);
     }
 
 //! CPU implementation of sinc(x)==sin(x)/x
@@ -599,6 +653,45 @@ inline Scalar sinc(Scalar x)
     return sinc;
     }
 
+/*! \param n Miller index
+    \param dim Number of mesh points
+    \param sq Sum of U(k_m)^2 over the aliases k_m of the wave vector (output)
+    \param s1 Sum of U(k_m) U(k_{m+1}) (output)
+    \param s2 Sum of U(k_m) U(k_{m+2}) (output)
+
+    U is the Fourier transform of the assignment function along one direction. With analytical
+    differentiation, the mesh energy of a single charge varies with its position s in the cell (in
+    units of the mesh spacing). The leading terms of the variation are proportional to cos(2 pi s)
+    and cos(4 pi s), which these sums weight.
+*/
+void PPPMForceCompute::selfForceAliasSums(int n,
+                                          unsigned int dim,
+                                          Scalar& sq,
+                                          Scalar& s1,
+                                          Scalar& s2)
+    {
+    Scalar U[7];
+    for (int m = -2; m <= 4; ++m)
+        {
+        Scalar arg = Scalar(M_PI) * ((Scalar)n + (Scalar)m * dim) / (Scalar)dim;
+        Scalar ws = sinc(arg);
+        Scalar w(1.0);
+        for (int iorder = 0; iorder < m_order; ++iorder)
+            {
+            w *= ws;
+            }
+        U[m + 2] = w;
+        }
+
+    sq = s1 = s2 = Scalar(0.0);
+    for (int m = 0; m <= 4; ++m)
+        {
+        sq += U[m] * U[m];
+        s1 += U[m] * U[m + 1];
+        s2 += U[m] * U[m + 2];
+        }
+    }
+
 void PPPMForceCompute::computeInfluenceFunction()
     {
     if (m_prof)
@@ -636,7 +729,7 @@ void PPPMForceCompute::computeInfluenceFunction()
                  / V_box;
 
 #ifdef ENABLE_MPI
-    bool local_fft = m_kiss_fft_initialized;
+    bool local_fft = bool(m_local_fft);
 
     uint3 pdim = make_uint3(0, 0, 0);
     uint3 pidx = make_uint3(0, 0, 0);
@@ -664,7 +757,13 @@ void PPPMForceCompute::computeInfluenceFunction()
     temp = floor(((m_kappa * L.z / (M_PI * m_global_dim.z)) * pow(-log(EPS_HOC), 0.25)));
     int nbz = (int)temp;
 
-    for (unsigned int cell_idx = 0; cell_idx < m_n_inner_cells; ++cell_idx)
+    // alias sums of the assignment function for the self force coefficients (ad), see
+    // selfForceAliasSums()
+    Scalar3 self_force_coeff[2];
+    self_force_coeff[0] = make_scalar3(0, 0, 0);
+    self_force_coeff[1] = make_scalar3(0, 0, 0);
+
+    for (unsigned int cell_idx = 0; cell_idx < m_n_fourier_cells; ++cell_idx)
         {
         uint3 wave_idx;
 #ifdef ENABLE_MPI
@@ -684,11 +783,11 @@ void PPPMForceCompute::computeInfluenceFunction()
         else
 #endif
             {
-            // kiss FFT expects data in row major format
-            wave_idx.z = cell_idx / (m_mesh_points.y * m_mesh_points.x);
-            wave_idx.y
-                = (cell_idx - wave_idx.z * m_mesh_points.x * m_mesh_points.y) / m_mesh_points.x;
-            wave_idx.x = cell_idx % m_mesh_points.x;
+            // row major half spectrum, kx = 0 ... nx / 2
+            unsigned int nx = m_local_fft->getHalfDimX();
+            wave_idx.z = cell_idx / (m_mesh_points.y * nx);
+            wave_idx.y = (cell_idx - wave_idx.z * nx * m_mesh_points.y) / nx;
+            wave_idx.x = cell_idx % nx;
             }
 
         int3 n = make_int3(wave_idx.x, wave_idx.y, wave_idx.z);
@@ -754,7 +853,9 @@ void PPPMForceCompute::computeInfluenceFunction()
                             }
 
                         Scalar3 kn = knx + kny + knz;
-                        Scalar dot1 = dot(kn, k);
+
+                        // the ad scheme differentiates each alias exactly
+                        Scalar dot1 = m_analytic_diff ? dot(kn, kn) : dot(kn, k);
                         Scalar dot2 = dot(kn, kn) + m_alpha * m_alpha;
 
                         Scalar arg_gauss = Scalar(0.25) * dot2 / m_kappa / m_kappa;
@@ -765,6 +866,22 @@ void PPPMForceCompute::computeInfluenceFunction()
                     }
                 }
             h_inf_f.data[cell_idx] = numerator * sum1 / denominator;
+
+            if (m_analytic_diff)
+                {
+                Scalar3 sq, s1, s2;
+                selfForceAliasSums(n.x, m_global_dim.x, sq.x, s1.x, s2.x);
+                selfForceAliasSums(n.y, m_global_dim.y, sq.y, s1.y, s2.y);
+                selfForceAliasSums(n.z, m_global_dim.z, sq.z, s1.z, s2.z);
+
+                Scalar g = h_inf_f.data[cell_idx] * getFourierWeight(cell_idx);
+                self_force_coeff[0] += g * make_scalar3(s1.x * sq.y * sq.z,
+                                                        sq.x * s1.y * sq.z,
+                                                        sq.x * sq.y * s1.z);
+                self_force_coeff[1] += g * make_scalar3(s2.x * sq.y * sq.z,
+                                                        sq.x * s2.y * sq.z,
+                                                        sq.x * sq.y * s2.z);
+                }
             }
         else // q=0
             {
@@ -774,6 +891,21 @@ void PPPMForceCompute::computeInfluenceFunction()
         h_k.data[cell_idx] = k;
         }
 
+#ifdef ENABLE_MPI
+    if (m_analytic_diff && m_pdata->getDomainDecomposition())
+        {
+        MPI_Allreduce(MPI_IN_PLACE,
+                      self_force_coeff,
+                      6,
+                      MPI_HOOMD_SCALAR,
+                      MPI_SUM,
+                      m_exec_conf->getMPICommunicator());
+        }
+#endif
+
+    m_self_force_coeff[0] = self_force_coeff[0];
+    m_self_force_coeff[1] = self_force_coeff[1];
+
     if (m_prof)
         m_prof->pop();
     }
@@ -788,14 +920,30 @@ void PPPMForceCompute::assignParticles()
                                    access_location::host,
                                    access_mode::read);
     ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::overwrite);
+    ArrayHandle<kiss_fft_scalar> h_real_mesh(m_real_mesh,
+                                             access_location::host,
+                                             access_mode::overwrite);
     ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
     ArrayHandle<Scalar> h_rho_coeff(m_rho_coeff, access_location::host, access_mode::read);
 
     const BoxDim& box = m_pdata->getBox();
 
-    // set mesh to zero
-    memset(h_mesh.data, 0, sizeof(kiss_fft_cpx) * m_mesh.getNumElements());
+    // set mesh to zero, the charge density is stored in the real part of the complex mesh
+    kiss_fft_scalar* rho;
+    unsigned int stride;
+    if (m_local_fft)
+        {
+        memset(h_real_mesh.data, 0, sizeof(kiss_fft_scalar) * m_real_mesh.getNumElements());
+        rho = h_real_mesh.data;
+        stride = 1;
+        }
+    else
+        {
+        memset(h_mesh.data, 0, sizeof(kiss_fft_cpx) * m_mesh.getNumElements());
+        rho = reinterpret_cast<kiss_fft_scalar*>(h_mesh.data);
+        stride = 2;
+        }
 
     Scalar V_cell = box.getVolume() / (Scalar)(m_mesh_points.x * m_mesh_points.y * m_mesh_points.z);
 
@@ -928,7 +1076,7 @@ void PPPMForceCompute::assignParticles()
                     unsigned int neigh_idx
                         = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
 
-                    h_mesh.data[neigh_idx].r += float(qi * W / V_cell);
+                    rho[stride * neigh_idx] += float(qi * W / V_cell);
                     }
                 }
             }
@@ -940,17 +1088,19 @@ void PPPMForceCompute::assignParticles()
 
 void PPPMForceCompute::updateMeshes()
     {
-    if (m_kiss_fft_initialized)
+    if (m_local_fft)
         {
         if (m_prof)
             m_prof->push("FFT");
         // transform the particle mesh locally (forward transform)
-        ArrayHandle<kiss_fft_cpx> h_mesh(m_mesh, access_location::host, access_mode::read);
+        ArrayHandle<kiss_fft_scalar> h_real_mesh(m_real_mesh,
+                                                 access_location::host,
+                                                 access_mode::read);
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh(m_fourier_mesh,
                                                  access_location::host,
                                                  access_mode::overwrite);
 
-        kiss_fftnd(m_kiss_fft, h_mesh.data, h_fourier_mesh.data);
+        m_local_fft->forward(h_real_mesh.data, h_fourier_mesh.data);
         if (m_prof)
             m_prof->pop();
         }
@@ -990,6 +1140,30 @@ void PPPMForceCompute::updateMeshes()
         m_prof->push("update");
         }
 
+    unsigned int NNN = m_global_dim.x * m_global_dim.y * m_global_dim.z;
+
+    if (m_analytic_diff)
+        {
+        ArrayHandle<kiss_fft_cpx> h_fourier_mesh_phi(m_fourier_mesh_phi,
+                                                     access_location::host,
+                                                     access_mode::overwrite);
+        ArrayHandle<Scalar> h_inf_f(m_inf_f, access_location::host, access_mode::read);
+        ArrayHandle<kiss_fft_cpx> h_fourier_mesh(m_fourier_mesh,
+                                                 access_location::host,
+                                                 access_mode::read);
+
+        // multiply with influence function
+        for (unsigned int k = 0; k < m_n_fourier_cells; ++k)
+            {
+            kiss_fft_cpx f = h_fourier_mesh.data[k];
+
+            Scalar scaled_inf_f = h_inf_f.data[k] / ((Scalar)NNN);
+
+            h_fourier_mesh_phi.data[k].r = float(f.r * scaled_inf_f);
+            h_fourier_mesh_phi.data[k].i = float(f.i * scaled_inf_f);
+            }
+        }
+    else
         {
         ArrayHandle<Scalar3> h_k(m_k, access_location::host, access_mode::read);
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh_G_x(m_fourier_mesh_G_x,
@@ -1006,10 +1180,8 @@ void PPPMForceCompute::updateMeshes()
                                                  access_location::host,
                                                  access_mode::read);
 
-        unsigned int NNN = m_global_dim.x * m_global_dim.y * m_global_dim.z;
-
         // multiply with influence function and I*k
-        for (unsigned int k = 0; k < m_n_inner_cells; ++k)
+        for (unsigned int k = 0; k < m_n_fourier_cells; ++k)
             {
             kiss_fft_cpx f = h_fourier_mesh.data[k];
 
@@ -1031,38 +1203,74 @@ void PPPMForceCompute::updateMeshes()
     if (m_prof)
         m_prof->pop();
 
-    if (m_kiss_fft_initialized)
+    if (m_local_fft && m_analytic_diff)
+        {
+        if (m_prof)
+            m_prof->push("FFT");
+        // do a local inverse transform of the potential mesh (overwrites the Fourier mesh)
+        ArrayHandle<kiss_fft_cpx> h_fourier_mesh_phi(m_fourier_mesh_phi,
+                                                     access_location::host,
+                                                     access_mode::readwrite);
+        ArrayHandle<kiss_fft_scalar> h_real_potential_mesh(m_real_potential_mesh,
+                                                           access_location::host,
+                                                           access_mode::overwrite);
+        m_local_fft->inverse(h_fourier_mesh_phi.data, h_real_potential_mesh.data);
+        if (m_prof)
+            m_prof->pop();
+        }
+    else if (m_local_fft)
         {
         if (m_prof)
             m_prof->push("FFT");
-        // do a local inverse transform of the force mesh
+        // do a local inverse transform of the force mesh (overwrites the G meshes)
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh_G_x(m_fourier_mesh_G_x,
                                                      access_location::host,
-                                                     access_mode::read);
+                                                     access_mode::readwrite);
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh_G_y(m_fourier_mesh_G_y,
                                                      access_location::host,
-                                                     access_mode::read);
+                                                     access_mode::readwrite);
         ArrayHandle<kiss_fft_cpx> h_fourier_mesh_G_z(m_fourier_mesh_G_z,
                                                      access_location::host,
-                                                     access_mode::read);
-        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_x(m_inv_fourier_mesh_x,
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_y(m_inv_fourier_mesh_y,
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z,
-                                                       access_location::host,
-                                                       access_mode::overwrite);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_x.data, h_inv_fourier_mesh_x.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_y.data, h_inv_fourier_mesh_y.data);
-        kiss_fftnd(m_kiss_ifft, h_fourier_mesh_G_z.data, h_inv_fourier_mesh_z.data);
+                                                     access_mode::readwrite);
+        ArrayHandle<kiss_fft_scalar> h_real_force_mesh_x(m_real_force_mesh_x,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+        ArrayHandle<kiss_fft_scalar> h_real_force_mesh_y(m_real_force_mesh_y,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+        ArrayHandle<kiss_fft_scalar> h_real_force_mesh_z(m_real_force_mesh_z,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+        m_local_fft->inverse(h_fourier_mesh_G_x.data, h_real_force_mesh_x.data);
+        m_local_fft->inverse(h_fourier_mesh_G_y.data, h_real_force_mesh_y.data);
+        m_local_fft->inverse(h_fourier_mesh_G_z.data, h_real_force_mesh_z.data);
         if (m_prof)
             m_prof->pop();
         }
 
 #ifdef ENABLE_MPI
-    if (m_pdata->getDomainDecomposition())
+    if (m_pdata->getDomainDecomposition() && m_analytic_diff)
+        {
+        if (m_prof)
+            m_prof->push("FFT");
+        // Distributed inverse transform of the potential
+        m_exec_conf->msg->notice(8) << "charge.pppm: Distributed iFFT" << std::endl;
+
+        ArrayHandle<kiss_fft_cpx> h_fourier_mesh_phi(m_fourier_mesh_phi,
+                                                     access_location::host,
+                                                     access_mode::read);
+        ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_phi(m_inv_fourier_mesh_phi,
+                                                         access_location::host,
+                                                         access_mode::overwrite);
+
+        dfft_execute((cpx_t*)h_fourier_mesh_phi.data,
+                     (cpx_t*)(h_inv_fourier_mesh_phi.data + m_ghost_offset),
+                     1,
+                     m_dfft_plan_inverse);
+        if (m_prof)
+            m_prof->pop();
+        }
+    else if (m_pdata->getDomainDecomposition())
         {
         if (m_prof)
             m_prof->push("FFT");
@@ -1114,9 +1322,16 @@ void PPPMForceCompute::updateMeshes()
         if (m_prof)
             m_prof->push("ghost cell update");
         m_exec_conf->msg->notice(8) << "charge.pppm: Ghost cell update" << std::endl;
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_x);
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_y);
-        m_grid_comm_reverse->communicate(m_inv_fourier_mesh_z);
+        if (m_analytic_diff)
+            {
+            m_grid_comm_reverse->communicate(m_inv_fourier_mesh_phi);
+            }
+        else
+            {
+            m_grid_comm_reverse->communicate(m_inv_fourier_mesh_x);
+            m_grid_comm_reverse->communicate(m_inv_fourier_mesh_y);
+            m_grid_comm_reverse->communicate(m_inv_fourier_mesh_z);
+            }
         if (m_prof)
             m_prof->pop();
         }
@@ -1144,6 +1359,44 @@ void PPPMForceCompute::interpolateForces()
     ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_z(m_inv_fourier_mesh_z,
                                                    access_location::host,
                                                    access_mode::read);
+    ArrayHandle<kiss_fft_scalar> h_real_force_mesh_x(m_real_force_mesh_x,
+                                                     access_location::host,
+                                                     access_mode::read);
+    ArrayHandle<kiss_fft_scalar> h_real_force_mesh_y(m_real_force_mesh_y,
+                                                     access_location::host,
+                                                     access_mode::read);
+    ArrayHandle<kiss_fft_scalar> h_real_force_mesh_z(m_real_force_mesh_z,
+                                                     access_location::host,
+                                                     access_mode::read);
+    ArrayHandle<kiss_fft_cpx> h_inv_fourier_mesh_phi(m_inv_fourier_mesh_phi,
+                                                     access_location::host,
+                                                     access_mode::read);
+    ArrayHandle<kiss_fft_scalar> h_real_potential_mesh(m_real_potential_mesh,
+                                                       access_location::host,
+                                                       access_mode::read);
+
+    // the field and the potential are the real part of the complex meshes
+    const kiss_fft_scalar* E_x;
+    const kiss_fft_scalar* E_y;
+    const kiss_fft_scalar* E_z;
+    const kiss_fft_scalar* phi;
+    unsigned int stride;
+    if (m_local_fft)
+        {
+        E_x = h_real_force_mesh_x.data;
+        E_y = h_real_force_mesh_y.data;
+        E_z = h_real_force_mesh_z.data;
+        phi = h_real_potential_mesh.data;
+        stride = 1;
+        }
+    else
+        {
+        E_x = reinterpret_cast<const kiss_fft_scalar*>(h_inv_fourier_mesh_x.data);
+        E_y = reinterpret_cast<const kiss_fft_scalar*>(h_inv_fourier_mesh_y.data);
+        E_z = reinterpret_cast<const kiss_fft_scalar*>(h_inv_fourier_mesh_z.data);
+        phi = reinterpret_cast<const kiss_fft_scalar*>(h_inv_fourier_mesh_phi.data);
+        stride = 2;
+        }
 
     // access force array
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
@@ -1155,6 +1408,30 @@ void PPPMForceCompute::interpolateForces()
 
     const BoxDim& box = m_pdata->getBox();
 
+    // gradients of the coordinates in units of the mesh size (ad)
+    Scalar3 a1 = box.getLatticeVector(0);
+    Scalar3 a2 = box.getLatticeVector(1);
+    Scalar3 a3 = box.getLatticeVector(2);
+    Scalar V_box = box.getVolume();
+    Scalar3 grad_s_x = (Scalar)m_mesh_points.x
+                       * make_scalar3(a2.y * a3.z - a2.z * a3.y,
+                                      a2.z * a3.x - a2.x * a3.z,
+                                      a2.x * a3.y - a2.y * a3.x)
+                       / V_box;
+    Scalar3 grad_s_y = (Scalar)m_mesh_points.y
+                       * make_scalar3(a3.y * a1.z - a3.z * a1.y,
+                                      a3.z * a1.x - a3.x * a1.z,
+                                      a3.x * a1.y - a3.y * a1.x)
+                       / V_box;
+    Scalar3 grad_s_z = (Scalar)m_mesh_points.z
+                       * make_scalar3(a1.y * a2.z - a1.z * a2.y,
+                                      a1.z * a2.x - a1.x * a2.z,
+                                      a1.x * a2.y - a1.y * a2.x)
+                       / V_box;
+
+    // prefactor of the self force (ad)
+    Scalar self_force_scale = Scalar(2.0 * M_PI) / m_pdata->getGlobalBox().getVolume();
+
     // loop over group
     unsigned int group_size = m_group->getNumMembers();
     for (unsigned int group_idx = 0; group_idx < group_size; group_idx++)
@@ -1220,8 +1497,12 @@ void PPPMForceCompute::interpolateForces()
 
         Scalar3 force = make_scalar3(0.0, 0.0, 0.0);
 
+        // sum of the potential times the gradient of the assignment function in mesh units (ad)
+        Scalar3 grad = make_scalar3(0.0, 0.0, 0.0);
+
         int mult_fact = 2 * m_order + 1;
         Scalar Wx, Wy, Wz;
+        Scalar dWx(0.0), dWy(0.0), dWz(0.0);
 
         int nlower = -(m_order - 1) / 2;
         int nupper = m_order / 2;
@@ -1234,6 +1515,16 @@ void PPPMForceCompute::interpolateForces()
                 Wx = h_rho_coeff.data[i - nlower + iorder * mult_fact] + Wx * dx;
                 }
 
+            if (m_analytic_diff)
+                {
+                // dx decreases with the particle coordinate
+                dWx = Scalar(0.0);
+                for (int iorder = m_order - 1; iorder >= 1; iorder--)
+                    {
+                    dWx = -iorder * h_rho_coeff.data[i - nlower + iorder * mult_fact] + dWx * dx;
+                    }
+                }
+
             int neighi = (int)ix + i;
 
             if (!m_n_ghost_cells.x)
@@ -1252,6 +1543,16 @@ void PPPMForceCompute::interpolateForces()
                     Wy = h_rho_coeff.data[j - nlower + iorder * mult_fact] + Wy * dy;
                     }
 
+                if (m_analytic_diff)
+                    {
+                    dWy = Scalar(0.0);
+                    for (int iorder = m_order - 1; iorder >= 1; iorder--)
+                        {
+                        dWy = -iorder * h_rho_coeff.data[j - nlower + iorder * mult_fact]
+                              + dWy * dy;
+                        }
+                    }
+
                 int neighj = (int)iy + j;
 
                 if (!m_n_ghost_cells.y)
@@ -1282,18 +1583,48 @@ void PPPMForceCompute::interpolateForces()
                     unsigned int neigh_idx
                         = neighi + m_grid_dim.x * (neighj + m_grid_dim.y * neighk);
 
-                    kiss_fft_cpx E_x = h_inv_fourier_mesh_x.data[neigh_idx];
-                    kiss_fft_cpx E_y = h_inv_fourier_mesh_y.data[neigh_idx];
-                    kiss_fft_cpx E_z = h_inv_fourier_mesh_z.data[neigh_idx];
+                    if (m_analytic_diff)
+                        {
+                        dWz = Scalar(0.0);
+                        for (int iorder = m_order - 1; iorder >= 1; iorder--)
+                            {
+                            dWz = -iorder * h_rho_coeff.data[k - nlower + iorder * mult_fact]
+                                  + dWz * dz;
+                            }
 
-                    Scalar W = Wx * Wy * Wz;
-                    force.x += qi * W * E_x.r;
-                    force.y += qi * W * E_y.r;
-                    force.z += qi * W * E_z.r;
+                        Scalar p = phi[stride * neigh_idx];
+                        grad.x += p * dWx * Wy * Wz;
+                        grad.y += p * Wx * dWy * Wz;
+                        grad.z += p * Wx * Wy * dWz;
+                        }
+                    else
+                        {
+                        Scalar W = Wx * Wy * Wz;
+                        force.x += qi * W * E_x[stride * neigh_idx];
+                        force.y += qi * W * E_y[stride * neigh_idx];
+                        force.z += qi * W * E_z[stride * neigh_idx];
+                        }
                     }
                 }
             }
 
+        if (m_analytic_diff)
+            {
+            // F = -q grad(phi), minus the spurious force of the charge on itself
+            Scalar3 s = reduced_pos;
+            Scalar3 sf = make_scalar3(
+                m_self_force_coeff[0].x * fast::sin(Scalar(2.0 * M_PI) * s.x)
+                    + Scalar(2.0) * m_self_force_coeff[1].x * fast::sin(Scalar(4.0 * M_PI) * s.x),
+                m_self_force_coeff[0].y * fast::sin(Scalar(2.0 * M_PI) * s.y)
+                    + Scalar(2.0) * m_self_force_coeff[1].y * fast::sin(Scalar(4.0 * M_PI) * s.y),
+                m_self_force_coeff[0].z * fast::sin(Scalar(2.0 * M_PI) * s.z)
+                    + Scalar(2.0) * m_self_force_coeff[1].z * fast::sin(Scalar(4.0 * M_PI) * s.z));
+            sf = qi * qi * self_force_scale * sf;
+
+            force = -qi * (grad.x * grad_s_x + grad.y * grad_s_y + grad.z * grad_s_z)
+                    - (sf.x * grad_s_x + sf.y * grad_s_y + sf.z * grad_s_z);
+            }
+
         h_force.data[idx] = make_scalar4(force.x, force.y, force.z, 0.0);
         } // end of loop over particles
 
@@ -1322,7 +1653,7 @@ Scalar PPPMForceCompute::computePE()
         }
 #endif
 
-    for (unsigned int k = 0; k < m_n_inner_cells; ++k)
+    for (unsigned int k = 0; k < m_n_fourier_cells; ++k)
         {
         bool exclude = false;
         if (exclude_dc)
@@ -1333,7 +1664,7 @@ Scalar PPPMForceCompute::computePE()
             {
             sum += (h_fourier_mesh.data[k].r * h_fourier_mesh.data[k].r
                     + h_fourier_mesh.data[k].i * h_fourier_mesh.data[k].i)
-                   * h_inf_f.data[k];
+                   * h_inf_f.data[k] * getFourierWeight(k);
             }
         }
 
@@ -1490,7 +1821,7 @@ void PPPMForceCompute::computeVirial()
         }
 #endif
 
-    for (unsigned int kidx = 0; kidx < m_n_inner_cells; ++kidx)
+    for (unsigned int kidx = 0; kidx < m_n_fourier_cells; ++kidx)
         {
         bool exclude = false;
         if (exclude_dc)
@@ -1505,7 +1836,8 @@ void PPPMForceCompute::computeVirial()
             Scalar3 k = h_k.data[kidx];
             Scalar ksq = dot(k, k);
 
-            Scalar rhog = (fourier.r * fourier.r + fourier.i * fourier.i) * h_inf_f.data[kidx];
+            Scalar rhog = (fourier.r * fourier.r + fourier.i * fourier.i) * h_inf_f.data[kidx]
+                          * getFourierWeight(kidx);
 
             Scalar vterm = -Scalar(2.0) * (Scalar(1.0) / ksq + Scalar(0.25) / (m_kappa * m_kappa));
             virial[0] += rhog * (Scalar(1.0) + vterm * k.x * k.x); // xx
@@ -1841,7 +2173,9 @@ void export_PPPMForceCompute(pybind11::module& m)
         .def_property_readonly("order", &PPPMForceCompute::getOrder)
         .def_property_readonly("kappa", &PPPMForceCompute::getKappa)
         .def_property_readonly("r_cut", &PPPMForceCompute::getRCut)
-        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha);
+        .def_property_readonly("alpha", &PPPMForceCompute::getAlpha)
+        .def("setDifferentiation", &PPPMForceCompute::setDifferentiation)
+        .def_property_readonly("differentiation", &PPPMForceCompute::getDifferentiation);
     }
 
     } // end namespace detail
@@ -4,6 +4,7 @@
 #ifndef __PPPM_FORCE_COMPUTE_H__
 #define __PPPM_FORCE_COMPUTE_H__
 
+#include "LocalFFT.h"
 #include "NeighborList.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/ParticleGroup.h"
@@ -17,6 +18,7 @@
 
 #include <hoomd/extern/nano-signal-slot/nano_signal_slot.hpp>
 #include <memory>
+#include <string>
 
 namespace hoomd
     {
@@ -84,6 +86,18 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         return m_alpha;
         }
 
+    //! Set the differentiation scheme of the mesh forces
+    /*! \param differentiation "ik" to differentiate the potential in Fourier space (three inverse
+            FFTs) or "ad" to differentiate the assignment function (one inverse FFT)
+    */
+    virtual void setDifferentiation(const std::string& differentiation);
+
+    //! Get the differentiation scheme of the mesh forces
+    std::string getDifferentiation()
+        {
+        return m_analytic_diff ? "ad" : "ik";
+        }
+
 #ifdef ENABLE_MPI
     //! Get ghost particle fields requested by this pair potential
     /*! \param timestep Current time step
@@ -108,6 +122,24 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         }
 #endif
 
+    //! PPPM may be computed concurrently with other forces
+    virtual bool canComputeConcurrently()
+        {
+        return true;
+        }
+
+    //! PPPM reads the exclusions of the neighbor list that the real space pair force builds
+    virtual const void* getSharedState()
+        {
+        return m_nlist.get();
+        }
+
+    //! PPPM performs distributed FFTs with domain decomposition
+    virtual bool communicatesInCompute()
+        {
+        return true;
+        }
+
     protected:
     /*! Compute the biased forces for this collective variable.
         The force that is written to the force arrays must be
@@ -152,6 +184,9 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     Scalar m_body_energy;      //!< Energy correction due to rigid body exclusions
     bool m_ptls_added_removed; //!< True if global particle number changed
 
+    bool m_analytic_diff;          //!< True to use analytical differentiation (ad)
+    Scalar3 m_self_force_coeff[2]; //!< Self force coefficients of the first two harmonics (ad)
+
     //! Helper function to be called when particle number changes
     void slotGlobalParticleNumberChange()
         {
@@ -198,8 +233,7 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
     virtual void computeBodyCorrection();
 
     private:
-    kiss_fftnd_cfg m_kiss_fft = NULL;  //!< The FFT configuration
-    kiss_fftnd_cfg m_kiss_ifft = NULL; //!< Inverse FFT configuration
+    std::unique_ptr<detail::LocalFFT> m_local_fft; //!< Real to complex FFT on a single rank
 
 #ifdef ENABLE_MPI
     dfft_plan m_dfft_plan_forward; //!< Distributed FFT for forward transform
@@ -210,9 +244,10 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
         m_grid_comm_reverse; //!< Communicator for inv fourier mesh
 #endif
 
-    bool m_kiss_fft_initialized; //!< True if a local KISS FFT has been set up
+    unsigned int m_n_fourier_cells; //!< Number of stored wave vectors
 
     GlobalArray<kiss_fft_cpx> m_mesh;         //!< The particle density mesh
+    GlobalArray<kiss_fft_scalar> m_real_mesh; //!< The particle density mesh (local FFT)
     GlobalArray<kiss_fft_cpx> m_fourier_mesh; //!< The fourier transformed mesh
     GlobalArray<kiss_fft_cpx>
         m_fourier_mesh_G_x; //!< Fourier transformed mesh times the influence function, x-component
@@ -226,12 +261,25 @@ class PYBIND11_EXPORT PPPMForceCompute : public ForceCompute
                                                     //!< influence function, y-component
     GlobalArray<kiss_fft_cpx> m_inv_fourier_mesh_z; //!< Fourier transformed mesh times the
                                                     //!< influence function, z-component
+    GlobalArray<kiss_fft_scalar> m_real_force_mesh_x; //!< Force mesh, x-component (local FFT)
+    GlobalArray<kiss_fft_scalar> m_real_force_mesh_y; //!< Force mesh, y-component (local FFT)
+    GlobalArray<kiss_fft_scalar> m_real_force_mesh_z; //!< Force mesh, z-component (local FFT)
+
+    GlobalArray<kiss_fft_cpx> m_fourier_mesh_phi; //!< Fourier transformed potential (ad)
+    GlobalArray<kiss_fft_cpx> m_inv_fourier_mesh_phi;   //!< Potential mesh (ad)
+    GlobalArray<kiss_fft_scalar> m_real_potential_mesh; //!< Potential mesh (ad, local FFT)
 
     bool m_dfft_initialized; //! True if host dfft has been initialized
 
     //! Compute virial on mesh
     void computeVirialMesh();
 
+    //! Number of wave vectors represented by the stored wave vector \a k
+    Scalar getFourierWeight(unsigned int k);
+
+    //! Sums over the aliases of a wave vector for the self force coefficients
+    void selfForceAliasSums(int n, unsigned int dim, Scalar& sq, Scalar& s1, Scalar& s2);
+
     //! Compute number of ghost cellso
     uint3 computeGhostCellNum();
 
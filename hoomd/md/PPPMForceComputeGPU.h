@@ -71,6 +71,17 @@ class PYBIND11_EXPORT PPPMForceComputeGPU : public PPPMForceCompute
         m_tuner_influence->setEnabled(enable);
         }
 
+    //! Set the differentiation scheme of the mesh forces
+    /*! The GPU implementation supports only ik differentiation.
+     */
+    virtual void setDifferentiation(const std::string& differentiation)
+        {
+        if (differentiation != "ik")
+            throw std::invalid_argument("PPPMForceComputeGPU supports only ik differentiation");
+
+        PPPMForceCompute::setDifferentiation(differentiation);
+        }
+
     protected:
     //! Helper function to setup FFT and allocate the mesh arrays
     virtual void initializeFFT();
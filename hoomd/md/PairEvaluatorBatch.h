@@ -0,0 +1,105 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __PAIR_EVALUATOR_BATCH_H__
+#define __PAIR_EVALUATOR_BATCH_H__
+
+#include "hoomd/HOOMDMath.h"
+
+#include <type_traits>
+
+/*! \file PairEvaluatorBatch.h
+    \brief Declares the structure of arrays used to evaluate pair potentials in batches
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Block of neighbors of a single particle whose pair forces are evaluated in one call
+/*! The pair data is stored as a structure of arrays so that evaluators can process all pairs in the
+    batch with SIMD instructions. Callers push() pairs until full(), pass the batch to
+    evaluator::evalForceAndEnergyBatch(), and read back force_divr and pair_eng in the order the
+    pairs were pushed.
+
+    \tparam param_type Parameter type of the pair evaluator
+*/
+template<class param_type> struct PairEvaluatorBatch
+    {
+    //! Maximum number of pairs in a batch
+    static const unsigned int capacity = 16;
+
+    unsigned int n = 0; //!< Number of pairs in the batch
+
+    Scalar rsq[capacity];        //!< Squared distance between the particles
+    Scalar rcutsq[capacity];     //!< Squared cutoff radius of the pair
+    param_type params[capacity]; //!< Parameters of the pair
+    unsigned int idx[capacity];  //!< Caller defined index of the pair (not used by evaluators)
+    Scalar3 dx[capacity];        //!< Caller defined pair separation (not used by evaluators)
+
+    Scalar force_divr[capacity]; //!< Output: |F|/r of each pair
+    Scalar pair_eng[capacity];   //!< Output: energy of each pair
+
+    //! Returns true when no more pairs can be added
+    bool full() const
+        {
+        return n == capacity;
+        }
+
+    //! Remove all pairs
+    void clear()
+        {
+        n = 0;
+        }
+
+    //! Add a pair to the batch
+    /*! \param _rsq Squared distance between the particles
+        \param _rcutsq Squared cutoff radius of the pair
+        \param _params Parameters of the pair
+        \param _dx Vector pointing from particle j to i
+        \param pair_idx Caller defined index of the pair
+    */
+    void push(Scalar _rsq,
+              Scalar _rcutsq,
+              const param_type& _params,
+              const Scalar3& _dx,
+              unsigned int pair_idx = 0)
+        {
+        rsq[n] = _rsq;
+        rcutsq[n] = _rcutsq;
+        params[n] = _params;
+        dx[n] = _dx;
+        idx[n] = pair_idx;
+        n++;
+        }
+    };
+
+namespace detail
+    {
+//! Detects evaluators that implement evalForceAndEnergyBatch()
+/*! A batched evaluator provides
+
+    \code
+    static void evalForceAndEnergyBatch(PairEvaluatorBatch<param_type>& batch, bool energy_shift);
+    \endcode
+
+    which sets force_divr and pair_eng of every pair in the batch to the values evalForceAndEnergy()
+    would compute, and to 0 for pairs that evalForceAndEnergy() would not evaluate. Evaluators that
+    need the diameter or charge must not implement it.
+*/
+template<class evaluator, class = void> struct has_batch_eval : std::false_type
+    {
+    };
+
+template<class evaluator>
+struct has_batch_eval<evaluator, std::void_t<decltype(&evaluator::evalForceAndEnergyBatch)>>
+    : std::true_type
+    {
+    };
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __PAIR_EVALUATOR_BATCH_H__
@@ -55,6 +55,18 @@ template<class evaluator> class PotentialBond : public ForceCompute
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
 #endif
 
+    //! Bond potentials may be computed concurrently with other forces
+    virtual bool canComputeConcurrently()
+        {
+        return true;
+        }
+
+    //! Bond potentials share the bond data, which rebuilds its index table on demand
+    virtual const void* getSharedState()
+        {
+        return m_bond_data.get();
+        }
+
     protected:
     GPUArray<param_type> m_params;         //!< Bond parameters per type
     std::shared_ptr<BondData> m_bond_data; //!< Bond data to use in computing bonds
@@ -153,7 +165,10 @@ template<class evaluator> void PotentialBond<evaluator>::computeForces(uint64_t
 
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<typename BondData::members_t> h_bond_idx(m_bond_data->getIndexTable(),
+                                                         access_location::host,
+                                                         access_mode::read);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
                                    access_location::host,
                                    access_mode::read);
@@ -209,8 +224,8 @@ template<class evaluator> void PotentialBond<evaluator>::computeForces(uint64_t
 
         // transform a and b into indices into the particle data arrays
         // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
+        unsigned int idx_a = h_bond_idx.data[i].idx[0];
+        unsigned int idx_b = h_bond_idx.data[i].idx[1];
 
         // throw an error if this bond is incomplete
         if (idx_a >= max_local || idx_b >= max_local)
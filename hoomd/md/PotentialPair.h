@@ -4,13 +4,18 @@
 #ifndef __POTENTIAL_PAIR_H__
 #define __POTENTIAL_PAIR_H__
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <stdexcept>
+#include <vector>
 
+#include "FusedPairInterface.h"
 #include "NeighborList.h"
+#include "NeighborListCluster.h"
+#include "PairEvaluatorBatch.h"
 #include "hoomd/ForceCompute.h"
 #include "hoomd/GSDShapeSpecWriter.h"
 #include "hoomd/GlobalArray.h"
@@ -82,11 +87,29 @@ namespace md
    parameters is defined by \a param_type in the potential evaluator class passed in. See the
    appropriate documentation for the evaluator for the definition of each element of the parameters.
 
+    When HOOMD is built with TBB and more than one CPU thread is active, the loop over particles is
+   split across the threads of the execution configuration's task arena. With a full neighbor list
+   every thread writes only to its own particles. With a half neighbor list, the forces applied to
+   neighbors are accumulated in per-thread buffers and summed after the loop (see
+   ForceCompute::loopParticles()).
+
+    With MPI, PotentialPair subscribes to Communicator::getOverlapComputeSignal(). On time steps
+   where the ghost positions are updated without a neighbor list rebuild, the forces on interior
+   particles (those without ghost neighbors) are computed while the ghost messages are in flight.
+   computeForces() then only adds the forces on the boundary particles.
+
+    When the neighbor list is a NeighborListCluster and the evaluator implements
+   evalForceAndEnergyBatch(), computeClusterForces() evaluates each cluster pair as one batch of
+   pairs whose positions are read from the contiguous cluster ordered copy of the positions.
+
+    PotentialPair also implements FusedPairInterface so that PotentialPairFused can evaluate it
+   together with other potentials in a single traversal of a shared neighbor list.
+
     For profiling PotentialPair needs to know the name of the potential. For
     now, that will be queried from the evaluator.
     \sa export_PotentialPair()
 */
-template<class evaluator> class PotentialPair : public ForceCompute
+template<class evaluator> class PotentialPair : public ForceCompute, public FusedPairInterface
     {
     public:
     //! Param type from evaluator
@@ -185,6 +208,38 @@ template<class evaluator> class PotentialPair : public ForceCompute
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
 #endif
 
+    //! Pair potentials may be computed concurrently with other forces
+    virtual bool canComputeConcurrently()
+        {
+        return true;
+        }
+
+    //! Pair potentials share the neighbor list, which they build on demand
+    virtual const void* getSharedState()
+        {
+        return m_nlist.get();
+        }
+
+    //! Get the number of force computations that used the interior forces from the ghost update
+    uint64_t getNumOverlappedComputes()
+        {
+        return m_n_overlapped_computes;
+        }
+
+    //! The cost of a pair potential is the number of neighbors of the local particles
+    virtual double getLocalCost()
+        {
+        const GlobalArray<unsigned int>& n_neigh = m_nlist->getNNeighArray();
+        ArrayHandle<unsigned int> h_n_neigh(n_neigh, access_location::host, access_mode::read);
+
+        // the neighbor list has not been built yet for a changed number of particles
+        const unsigned int N = std::min(m_pdata->getN(), (unsigned int)n_neigh.getNumElements());
+        double cost = 0.0;
+        for (unsigned int i = 0; i < N; i++)
+            cost += h_n_neigh.data[i];
+        return cost;
+        }
+
     //! Calculates the energy between two lists of particles.
     template<class InputIterator>
     void computeEnergyBetweenSets(InputIterator first1,
@@ -197,6 +252,36 @@ template<class evaluator> class PotentialPair : public ForceCompute
     computeEnergyBetweenSetsPythonList(pybind11::array_t<int, pybind11::array::c_style> tags1,
                                        pybind11::array_t<int, pybind11::array::c_style> tags2);
 
+    //! Get the neighbor list the potential was constructed with
+    virtual std::shared_ptr<NeighborList> getFusedNList() const
+        {
+        return m_nlist;
+        }
+
+    //! Returns true when the evaluator needs particle diameters
+    virtual bool fusedNeedsDiameter() const
+        {
+        return evaluator::needsDiameter();
+        }
+
+    //! Returns true when the evaluator needs particle charges
+    virtual bool fusedNeedsCharge() const
+        {
+        return evaluator::needsCharge();
+        }
+
+    //! Acquire the cutoff arrays for a fused sweep
+    virtual void beginFusedSweep(uint64_t timestep);
+
+    //! Evaluate one pair in a fused sweep
+    virtual bool evalFusedPair(const FusedPairArgs& args,
+                               Scalar& force_divr,
+                               Scalar& virial_divr,
+                               Scalar& pair_eng) const;
+
+    //! Release the cutoff arrays after a fused sweep
+    virtual void endFusedSweep();
+
     std::vector<std::string> getTypeShapeMapping() const
         {
         std::vector<std::string> type_shape_mapping(m_pdata->getNTypes());
@@ -210,6 +295,7 @@ template<class evaluator> class PotentialPair : public ForceCompute
 
     protected:
     std::shared_ptr<NeighborList> m_nlist; //!< The neighborlist to use for the computation
+    std::shared_ptr<NeighborListCluster> m_nlist_cluster; //!< m_nlist when it is a cluster list
     energyShiftMode m_shift_mode; //!< Store the mode with which to handle the energy shift at r_cut
     Index2D m_typpair_idx;        //!< Helper class for indexing per type pair arrays
     GlobalArray<Scalar> m_rcutsq; //!< Cutoff radius squared per type pair
@@ -230,8 +316,50 @@ template<class evaluator> class PotentialPair : public ForceCompute
     std::shared_ptr<Communicator> m_comm;
 #endif
 
+    /// Cutoff arrays held for the duration of a fused sweep
+    std::unique_ptr<ArrayHandle<Scalar>> m_fused_rcutsq;
+    std::unique_ptr<ArrayHandle<Scalar>> m_fused_ronsq;
+
+#ifdef ENABLE_MPI
+    /// True when computeInteriorForces() is connected to the communicator
+    bool m_overlap_connected = false;
+#endif
+
+    /// True when the forces on the interior particles were computed during the ghost update
+    bool m_interior_valid = false;
+    uint64_t m_interior_timestep = 0;     //!< Time step of the interior forces
+    uint64_t m_interior_nlist_updates = 0; //!< Neighbor list update count of the interior forces
+    bool m_interior_virial = false;        //!< True when the interior virial was computed
+    uint64_t m_n_overlapped_computes = 0;  //!< Number of computations that used interior forces
+
+    /// Local particles without ghost neighbors
+    std::vector<unsigned int> m_interior_particles;
+    /// Local particles with at least one ghost neighbor
+    std::vector<unsigned int> m_boundary_particles;
+
     //! Actually compute the forces
     virtual void computeForces(uint64_t timestep);
+
+    //! Compute the forces on the interior particles while the ghosts are updated
+    void computeInteriorForces(uint64_t timestep);
+
+    //! Compute the forces on a list of particles
+    void computeParticleForces(const unsigned int* particles, unsigned int n, bool overwrite);
+
+    //! Compute the forces on all particles from the cluster pairs of m_nlist_cluster
+    void computeClusterForces(bool overwrite);
+
+    //! Evaluate the force and energy of a single pair, applying the energy shift mode
+    inline bool evaluatePair(Scalar rsq,
+                             unsigned int typpair_idx,
+                             Scalar di,
+                             Scalar dj,
+                             Scalar qi,
+                             Scalar qj,
+                             const Scalar* rcutsq_array,
+                             const Scalar* ronsq_array,
+                             Scalar& force_divr,
+                             Scalar& pair_eng) const;
     };
 
 /*! \param sysdef System to compute forces on
@@ -249,6 +377,8 @@ PotentialPair<evaluator>::PotentialPair(std::shared_ptr<SystemDefinition> sysdef
     assert(m_pdata);
     assert(m_nlist);
 
+    m_nlist_cluster = std::dynamic_pointer_cast<NeighborListCluster>(m_nlist);
+
     GlobalArray<Scalar> rcutsq(m_typpair_idx.getNumElements(), m_exec_conf);
     m_rcutsq.swap(rcutsq);
     GlobalArray<Scalar> ronsq(m_typpair_idx.getNumElements(), m_exec_conf);
@@ -319,6 +449,15 @@ template<class evaluator> PotentialPair<evaluator>::~PotentialPair()
         {
         m_nlist->removeRCutMatrix(m_r_cut_nlist);
         }
+
+#ifdef ENABLE_MPI
+    if (m_overlap_connected)
+        {
+        m_comm->getOverlapComputeSignal()
+            .disconnect<PotentialPair<evaluator>, &PotentialPair<evaluator>::computeInteriorForces>(
+                this);
+        }
+#endif
     }
 
 /*! \param typ1 First type index in the pair
@@ -463,6 +602,87 @@ int PotentialPair<evaluator>::slotWriteGSDShapeSpec(gsd_handle& handle) const
     return retval;
     }
 
+/*! \param rsq Squared distance between the particles
+    \param typpair_idx Index of the type pair in the per type pair arrays
+    \param di Diameter of particle i
+    \param dj Diameter of particle j
+    \param qi Charge of particle i
+    \param qj Charge of particle j
+    \param rcutsq_array Host pointer to the r_cut squared values
+    \param ronsq_array Host pointer to the r_on squared values
+    \param force_divr Output: |F|/r
+    \param pair_eng Output: pair energy
+    \returns true when the pair was evaluated
+*/
+template<class evaluator>
+inline bool PotentialPair<evaluator>::evaluatePair(Scalar rsq,
+                                                   unsigned int typpair_idx,
+                                                   Scalar di,
+                                                   Scalar dj,
+                                                   Scalar qi,
+                                                   Scalar qj,
+                                                   const Scalar* rcutsq_array,
+                                                   const Scalar* ronsq_array,
+                                                   Scalar& force_divr,
+                                                   Scalar& pair_eng) const
+    {
+    // get parameters for this type pair
+    const param_type& param = m_params[typpair_idx];
+    Scalar rcutsq = rcutsq_array[typpair_idx];
+    Scalar ronsq = Scalar(0.0);
+    if (m_shift_mode == xplor)
+        ronsq = ronsq_array[typpair_idx];
+
+    // design specifies that energies are shifted if
+    // 1) shift mode is set to shift
+    // or 2) shift mode is explor and ron > rcut
+    bool energy_shift = false;
+    if (m_shift_mode == shift)
+        energy_shift = true;
+    else if (m_shift_mode == xplor)
+        {
+        if (ronsq > rcutsq)
+            energy_shift = true;
+        }
+
+    // compute the force and potential energy
+    evaluator eval(rsq, rcutsq, param);
+    if (evaluator::needsDiameter())
+        eval.setDiameter(di, dj);
+    if (evaluator::needsCharge())
+        eval.setCharge(qi, qj);
+
+    bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
+
+    // modify the potential for xplor shifting
+    if (evaluated && m_shift_mode == xplor)
+        {
+        if (rsq >= ronsq && rsq < rcutsq)
+            {
+            // Implement XPLOR smoothing (FLOPS: 16)
+            Scalar old_pair_eng = pair_eng;
+            Scalar old_force_divr = force_divr;
+
+            // calculate 1.0 / (xplor denominator)
+            Scalar xplor_denom_inv
+                = Scalar(1.0) / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
+
+            Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
+            Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
+                       * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq) * xplor_denom_inv;
+            Scalar ds_dr_divr = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
+
+            // make modifications to the old pair energy and force
+            pair_eng = old_pair_eng * s;
+            // note: I'm not sure why the minus sign needs to be there: my notes have a +
+            // But this is verified correct via plotting
+            force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
+            }
+        }
+
+    return evaluated;
+    }
+
 /*! \post The pair forces are computed for the given timestep. The neighborlist's compute method is
    called to ensure that it is up to date before proceeding.
 
@@ -473,10 +693,137 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     // start by updating the neighborlist
     m_nlist->compute(timestep);
 
+#ifdef ENABLE_MPI
+    // compute the interior particles during the following ghost updates
+    if (m_comm && !m_overlap_connected)
+        {
+        m_comm->getOverlapComputeSignal()
+            .connect<PotentialPair<evaluator>, &PotentialPair<evaluator>::computeInteriorForces>(
+                this);
+        m_overlap_connected = true;
+        }
+#endif
+
     // start the profile for this compute
     if (m_prof)
         m_prof->push(m_prof_name);
 
+    PDataFlags flags = this->m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    // the interior forces are only valid when computed on the same neighbor list
+    if (m_interior_valid && m_interior_timestep == timestep
+        && m_interior_nlist_updates == m_nlist->getNumUpdates()
+        && m_interior_virial == compute_virial)
+        {
+        computeParticleForces(m_boundary_particles.data(),
+                              (unsigned int)m_boundary_particles.size(),
+                              false);
+        m_n_overlapped_computes++;
+        }
+    else
+        {
+        computeParticleForces(nullptr, m_pdata->getN(), true);
+        }
+    m_interior_valid = false;
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
+/*! Called by the communicator between beginUpdateGhosts() and finishUpdateGhosts(). Particles
+    whose neighbors are all local are computed from the neighbor list of the previous build, which
+    computeForces() reuses unless it rebuilds.
+
+    \param timestep Time step the forces will be computed for
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::computeInteriorForces(uint64_t timestep)
+    {
+    m_interior_valid = false;
+
+    // skip when the forces are not needed or the neighbor list was never built
+    if (!m_attached || !peekCompute(timestep) || m_nlist->getNumUpdates() == 0)
+        return;
+
+    const unsigned int N = m_pdata->getN();
+
+    // the compute callbacks that follow the ghost update move the rigid body constituents
+        {
+        ArrayHandle<unsigned int> h_body(m_pdata->getBodies(),
+                                         access_location::host,
+                                         access_mode::read);
+        for (unsigned int i = 0; i < N; i++)
+            {
+            if (h_body.data[i] < MIN_FLOPPY)
+                return;
+            }
+        }
+
+    if (m_prof)
+        m_prof->push(m_prof_name);
+
+    // split the local particles by whether they have a ghost neighbor
+    m_interior_particles.clear();
+    m_boundary_particles.clear();
+        {
+        ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                            access_location::host,
+                                            access_mode::read);
+        ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                          access_location::host,
+                                          access_mode::read);
+        ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                        access_location::host,
+                                        access_mode::read);
+
+        for (unsigned int i = 0; i < N; i++)
+            {
+            const size_t head = h_head_list.data[i];
+            const unsigned int size = h_n_neigh.data[i];
+            bool boundary = false;
+            for (unsigned int k = 0; k < size && !boundary; k++)
+                boundary = h_nlist.data[head + k] >= N;
+
+            if (boundary)
+                m_boundary_particles.push_back(i);
+            else
+                m_interior_particles.push_back(i);
+            }
+        }
+
+    computeParticleForces(m_interior_particles.data(),
+                          (unsigned int)m_interior_particles.size(),
+                          true);
+
+    m_interior_valid = true;
+    m_interior_timestep = timestep;
+    m_interior_nlist_updates = m_nlist->getNumUpdates();
+    m_interior_virial = m_pdata->getFlags()[pdata_flag::pressure_tensor];
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
+/*! \param particles Indices of the particles to compute, or nullptr to compute particles [0, n)
+    \param n Number of particles to compute
+    \param overwrite Set to true to zero the force and virial arrays first, false to accumulate
+*/
+template<class evaluator>
+void PotentialPair<evaluator>::computeParticleForces(const unsigned int* particles,
+                                                     unsigned int n,
+                                                     bool overwrite)
+    {
+    // XPLOR smoothing is only implemented by evaluatePair()
+    if constexpr (detail::has_batch_eval<evaluator>::value)
+        {
+        if (m_nlist_cluster && !particles && m_shift_mode != xplor)
+            {
+            computeClusterForces(overwrite);
+            return;
+            }
+        }
+
     // depending on the neighborlist settings, we can take advantage of newton's third law
     // to reduce computations at the cost of memory access complexity: set that flag now
     bool third_law = m_nlist->getStorageMode() == NeighborList::half;
@@ -500,8 +847,9 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
 
     // force arrays
-    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
-    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+    access_mode::Enum mode = overwrite ? access_mode::overwrite : access_mode::readwrite;
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, mode);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, mode);
 
     const BoxDim& box = m_pdata->getGlobalBox();
     ArrayHandle<Scalar> h_ronsq(m_ronsq, access_location::host, access_mode::read);
@@ -511,130 +859,62 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
     bool compute_virial = flags[pdata_flag::pressure_tensor];
 
     // need to start from a zero force, energy and virial
-    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
-    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
-
-    // for each particle
-    for (int i = 0; i < (int)m_pdata->getN(); i++)
+    if (overwrite)
         {
-        // access the particle's position and type (MEM TRANSFER: 4 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+        memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+        memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        }
 
-        // sanity check
-        assert(typei < m_pdata->getNTypes());
+    const unsigned int N = m_pdata->getN();
 
-        // access diameter and charge (if needed)
-        Scalar di = Scalar(0.0);
-        Scalar qi = Scalar(0.0);
-        if (evaluator::needsDiameter())
-            di = h_diameter.data[i];
-        if (evaluator::needsCharge())
-            qi = h_charge.data[i];
+    // evaluate the neighbors in batches when the evaluator implements evalForceAndEnergyBatch(),
+    // XPLOR smoothing is only implemented by evaluatePair()
+    const bool use_batch = detail::has_batch_eval<evaluator>::value && m_shift_mode != xplor;
+
+    // compute the forces on particles [first, last) of the list, accumulating into force and virial
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
+    {
+        // neighbors of the current particle (only used by batched evaluators)
+        PairEvaluatorBatch<param_type> batch;
 
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar virialxxi = 0.0;
-        Scalar virialxyi = 0.0;
-        Scalar virialxzi = 0.0;
-        Scalar virialyyi = 0.0;
-        Scalar virialyzi = 0.0;
-        Scalar virialzzi = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const size_t myHead = h_head_list.data[i];
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+        for (unsigned int idx = first; idx < last; idx++)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[myHead + k];
-            assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+            unsigned int i = particles ? particles[idx] : idx;
 
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
+            // access the particle's position and type (MEM TRANSFER: 4 scalars)
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
 
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < m_pdata->getNTypes());
+            // sanity check
+            assert(typei < m_pdata->getNTypes());
 
             // access diameter and charge (if needed)
-            Scalar dj = Scalar(0.0);
-            Scalar qj = Scalar(0.0);
+            Scalar di = Scalar(0.0);
+            Scalar qi = Scalar(0.0);
             if (evaluator::needsDiameter())
-                dj = h_diameter.data[j];
+                di = h_diameter.data[i];
             if (evaluator::needsCharge())
-                qj = h_charge.data[j];
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
-
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            param_type param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
-                {
-                if (ronsq > rcutsq)
-                    energy_shift = true;
-                }
-
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-            if (evaluator::needsDiameter())
-                eval.setDiameter(di, dj);
-            if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
-
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
-
-            if (evaluated)
-                {
-                // modify the potential for xplor shifting
-                if (m_shift_mode == xplor)
-                    {
-                    if (rsq >= ronsq && rsq < rcutsq)
-                        {
-                        // Implement XPLOR smoothing (FLOPS: 16)
-                        Scalar old_pair_eng = pair_eng;
-                        Scalar old_force_divr = force_divr;
-
-                        // calculate 1.0 / (xplor denominator)
-                        Scalar xplor_denom_inv
-                            = Scalar(1.0)
-                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
-
-                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
-                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
-                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
-                                   * xplor_denom_inv;
-                        Scalar ds_dr_divr
-                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
-
-                        // make modifications to the old pair energy and force
-                        pair_eng = old_pair_eng * s;
-                        // note: I'm not sure why the minus sign needs to be there: my notes have a
-                        // + But this is verified correct via plotting
-                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
-                        }
-                    }
-
+                qi = h_charge.data[i];
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar virialxxi = 0.0;
+            Scalar virialxyi = 0.0;
+            Scalar virialxzi = 0.0;
+            Scalar virialyyi = 0.0;
+            Scalar virialyzi = 0.0;
+            Scalar virialzzi = 0.0;
+
+            // add the force, potential energy and virial of the pair (i, j) to particle i and, when
+            // using the third law, to particle j
+            auto add_pair
+                = [&](unsigned int j, const Scalar3& dx, Scalar force_divr, Scalar pair_eng)
+            {
                 Scalar force_div2r = force_divr * Scalar(0.5);
                 // add the force, potential energy and virial to the particle i
                 // (FLOPS: 8)
@@ -652,45 +932,341 @@ template<class evaluator> void PotentialPair<evaluator>::computeForces(uint64_t
 
                 // add the force to particle j if we are using the third law (MEM TRANSFER: 10
                 // scalars / FLOPS: 8) only add force to local particles
-                if (third_law && j < m_pdata->getN())
+                if (third_law && j < N)
                     {
                     unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
+                    force[mem_idx].x -= dx.x * force_divr;
+                    force[mem_idx].y -= dx.y * force_divr;
+                    force[mem_idx].z -= dx.z * force_divr;
+                    force[mem_idx].w += pair_eng * Scalar(0.5);
                     if (compute_virial)
                         {
-                        h_virial.data[0 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
-                        h_virial.data[1 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
-                        h_virial.data[2 * m_virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
-                        h_virial.data[3 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
-                        h_virial.data[4 * m_virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
-                        h_virial.data[5 * m_virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                        virial[0 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.x;
+                        virial[1 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.y;
+                        virial[2 * virial_pitch + mem_idx] += force_div2r * dx.x * dx.z;
+                        virial[3 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.y;
+                        virial[4 * virial_pitch + mem_idx] += force_div2r * dx.y * dx.z;
+                        virial[5 * virial_pitch + mem_idx] += force_div2r * dx.z * dx.z;
+                        }
+                    }
+            };
+
+            // loop over all of the neighbors of this particle
+            const size_t myHead = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+
+            if (use_batch)
+                {
+                if constexpr (detail::has_batch_eval<evaluator>::value)
+                    {
+                    // gather the neighbors into batches and evaluate each batch with one call
+                    for (unsigned int k = 0; k < size; k++)
+                        {
+                        unsigned int j = h_nlist.data[myHead + k];
+                        assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                        Scalar3 pj
+                            = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                        Scalar3 dx = box.minImage(pi - pj);
+                        Scalar rsq = dot(dx, dx);
+
+                        unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                        assert(typej < m_pdata->getNTypes());
+                        unsigned int typpair_idx = m_typpair_idx(typei, typej);
+
+                        batch.push(rsq, h_rcutsq.data[typpair_idx], m_params[typpair_idx], dx, j);
+
+                        if (batch.full() || k == size - 1)
+                            {
+                            evaluator::evalForceAndEnergyBatch(batch, m_shift_mode == shift);
+
+                            // pairs that were not evaluated have no force and energy
+                            for (unsigned int l = 0; l < batch.n; l++)
+                                {
+                                if (batch.force_divr[l] != Scalar(0.0)
+                                    || batch.pair_eng[l] != Scalar(0.0))
+                                    {
+                                    add_pair(batch.idx[l],
+                                             batch.dx[l],
+                                             batch.force_divr[l],
+                                             batch.pair_eng[l]);
+                                    }
+                                }
+                            batch.clear();
+                            }
                         }
                     }
                 }
+            else
+                {
+                for (unsigned int k = 0; k < size; k++)
+                    {
+                    // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                    unsigned int j = h_nlist.data[myHead + k];
+                    assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                    // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                    Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                    Scalar3 dx = pi - pj;
+
+                    // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                    unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                    assert(typej < m_pdata->getNTypes());
+
+                    // access diameter and charge (if needed)
+                    Scalar dj = Scalar(0.0);
+                    Scalar qj = Scalar(0.0);
+                    if (evaluator::needsDiameter())
+                        dj = h_diameter.data[j];
+                    if (evaluator::needsCharge())
+                        qj = h_charge.data[j];
+
+                    // apply periodic boundary conditions
+                    dx = box.minImage(dx);
+
+                    // calculate r_ij squared (FLOPS: 5)
+                    Scalar rsq = dot(dx, dx);
+
+                    // compute the force and potential energy
+                    Scalar force_divr = Scalar(0.0);
+                    Scalar pair_eng = Scalar(0.0);
+                    bool evaluated = evaluatePair(rsq,
+                                                  m_typpair_idx(typei, typej),
+                                                  di,
+                                                  dj,
+                                                  qi,
+                                                  qj,
+                                                  h_rcutsq.data,
+                                                  h_ronsq.data,
+                                                  force_divr,
+                                                  pair_eng);
+
+                    if (evaluated)
+                        add_pair(j, dx, force_divr, pair_eng);
+                    }
+                }
+
+            // finally, increment the force, potential energy and virial for particle i
+            unsigned int mem_idx = i;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
+            if (compute_virial)
+                {
+                virial[0 * virial_pitch + mem_idx] += virialxxi;
+                virial[1 * virial_pitch + mem_idx] += virialxyi;
+                virial[2 * virial_pitch + mem_idx] += virialxzi;
+                virial[3 * virial_pitch + mem_idx] += virialyyi;
+                virial[4 * virial_pitch + mem_idx] += virialyzi;
+                virial[5 * virial_pitch + mem_idx] += virialzzi;
+                }
             }
+    };
+
+    loopParticles(n, third_law, compute_virial, h_force, h_virial, compute_range);
+    }
+
+/*! \param overwrite Set to true to zero the force and virial arrays first, false to accumulate
+
+    Loops over the i-clusters of m_nlist_cluster. The pairs of each cluster pair that are set in its
+    mask form one batch, so the evaluator processes up to cluster_size x cluster_size pairs in a
+    single call.
+*/
+template<class evaluator> void PotentialPair<evaluator>::computeClusterForces(bool overwrite)
+    {
+    static const unsigned int M = NeighborListCluster::cluster_size;
+    static_assert(M * M <= PairEvaluatorBatch<param_type>::capacity,
+                  "A cluster pair must fit in one batch");
+
+    // read the positions before acquiring the particle data
+    const NeighborListCluster::ClusterPositions& cluster_pos
+        = m_nlist_cluster->getClusterPositions();
+    const std::vector<unsigned int>& cluster_particles = m_nlist_cluster->getClusterParticles();
+
+    bool third_law = m_nlist->getStorageMode() == NeighborList::half;
+
+    // force arrays
+    access_mode::Enum mode = overwrite ? access_mode::overwrite : access_mode::readwrite;
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, mode);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, mode);
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+    ArrayHandle<Scalar> h_rcutsq(m_rcutsq, access_location::host, access_mode::read);
 
-        // finally, increment the force, potential energy and virial for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-        if (compute_virial)
+    PDataFlags flags = this->m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    // need to start from a zero force, energy and virial
+    if (overwrite)
+        {
+        memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+        memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+        }
+
+    const unsigned int N = m_pdata->getN();
+
+    // compute the forces on the particles of i-clusters [first, last)
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
+    {
+        PairEvaluatorBatch<param_type> batch;
+
+        for (unsigned int ci = first; ci < last; ci++)
             {
-            h_virial.data[0 * m_virial_pitch + mem_idx] += virialxxi;
-            h_virial.data[1 * m_virial_pitch + mem_idx] += virialxyi;
-            h_virial.data[2 * m_virial_pitch + mem_idx] += virialxzi;
-            h_virial.data[3 * m_virial_pitch + mem_idx] += virialyyi;
-            h_virial.data[4 * m_virial_pitch + mem_idx] += virialyzi;
-            h_virial.data[5 * m_virial_pitch + mem_idx] += virialzzi;
+            // force, potential energy and virial of the particles in the i-cluster
+            Scalar4 fi[M];
+            Scalar virial_i[M][6];
+            for (unsigned int a = 0; a < M; a++)
+                {
+                fi[a] = make_scalar4(0, 0, 0, 0);
+                for (unsigned int k = 0; k < 6; k++)
+                    virial_i[a][k] = Scalar(0.0);
+                }
+
+            for (const auto& pair : m_nlist_cluster->getClusterPairs(ci))
+                {
+                // gather the pairs set in the mask
+                batch.clear();
+                for (unsigned int bit = 0; bit < M * M; bit++)
+                    {
+                    if (!((pair.mask >> bit) & 1))
+                        continue;
+
+                    const unsigned int slot_i = ci * M + bit / M;
+                    const unsigned int slot_j = pair.j * M + bit % M;
+
+                    Scalar3 dx = make_scalar3(cluster_pos.x[slot_i] - cluster_pos.x[slot_j],
+                                              cluster_pos.y[slot_i] - cluster_pos.y[slot_j],
+                                              cluster_pos.z[slot_i] - cluster_pos.z[slot_j]);
+                    dx = box.minImage(dx);
+                    Scalar rsq = dot(dx, dx);
+
+                    unsigned int typpair_idx
+                        = m_typpair_idx(cluster_pos.type[slot_i], cluster_pos.type[slot_j]);
+                    batch.push(rsq, h_rcutsq.data[typpair_idx], m_params[typpair_idx], dx, bit);
+                    }
+
+                // computeParticleForces() only calls this method for batched evaluators
+                if constexpr (detail::has_batch_eval<evaluator>::value)
+                    evaluator::evalForceAndEnergyBatch(batch, m_shift_mode == shift);
+
+                for (unsigned int l = 0; l < batch.n; l++)
+                    {
+                    const Scalar force_divr = batch.force_divr[l];
+                    const Scalar pair_eng = batch.pair_eng[l];
+                    if (force_divr == Scalar(0.0) && pair_eng == Scalar(0.0))
+                        continue;
+
+                    const unsigned int a = batch.idx[l] / M;
+                    const Scalar3& dx = batch.dx[l];
+                    const Scalar force_div2r = force_divr * Scalar(0.5);
+
+                    fi[a].x += dx.x * force_divr;
+                    fi[a].y += dx.y * force_divr;
+                    fi[a].z += dx.z * force_divr;
+                    fi[a].w += pair_eng * Scalar(0.5);
+                    if (compute_virial)
+                        {
+                        virial_i[a][0] += force_div2r * dx.x * dx.x;
+                        virial_i[a][1] += force_div2r * dx.x * dx.y;
+                        virial_i[a][2] += force_div2r * dx.x * dx.z;
+                        virial_i[a][3] += force_div2r * dx.y * dx.y;
+                        virial_i[a][4] += force_div2r * dx.y * dx.z;
+                        virial_i[a][5] += force_div2r * dx.z * dx.z;
+                        }
+
+                    // only add force to local particles
+                    const unsigned int j = cluster_particles[pair.j * M + batch.idx[l] % M];
+                    if (third_law && j < N)
+                        {
+                        force[j].x -= dx.x * force_divr;
+                        force[j].y -= dx.y * force_divr;
+                        force[j].z -= dx.z * force_divr;
+                        force[j].w += pair_eng * Scalar(0.5);
+                        if (compute_virial)
+                            {
+                            virial[0 * virial_pitch + j] += force_div2r * dx.x * dx.x;
+                            virial[1 * virial_pitch + j] += force_div2r * dx.x * dx.y;
+                            virial[2 * virial_pitch + j] += force_div2r * dx.x * dx.z;
+                            virial[3 * virial_pitch + j] += force_div2r * dx.y * dx.y;
+                            virial[4 * virial_pitch + j] += force_div2r * dx.y * dx.z;
+                            virial[5 * virial_pitch + j] += force_div2r * dx.z * dx.z;
+                            }
+                        }
+                    }
+                }
+
+            // finally, increment the force, potential energy and virial of the i particles
+            for (unsigned int a = 0; a < M; a++)
+                {
+                const unsigned int i = cluster_particles[ci * M + a];
+                if (i == NeighborListCluster::no_particle)
+                    break;
+
+                force[i].x += fi[a].x;
+                force[i].y += fi[a].y;
+                force[i].z += fi[a].z;
+                force[i].w += fi[a].w;
+                if (compute_virial)
+                    {
+                    for (unsigned int k = 0; k < 6; k++)
+                        virial[k * virial_pitch + i] += virial_i[a][k];
+                    }
+                }
             }
-        }
+    };
 
-    if (m_prof)
-        m_prof->pop();
+    loopParticles(m_nlist_cluster->getNClusters(),
+                  third_law,
+                  compute_virial,
+                  h_force,
+                  h_virial,
+                  compute_range);
+    }
+
+/*! \param timestep Current time step
+ */
+template<class evaluator> void PotentialPair<evaluator>::beginFusedSweep(uint64_t timestep)
+    {
+    m_fused_rcutsq.reset(
+        new ArrayHandle<Scalar>(m_rcutsq, access_location::host, access_mode::read));
+    m_fused_ronsq.reset(new ArrayHandle<Scalar>(m_ronsq, access_location::host, access_mode::read));
+    }
+
+/*! \param args Pair geometry
+    \param force_divr Output: |F|/r
+    \param virial_divr Output: |F|/r contributing to the virial
+    \param pair_eng Output: pair energy
+*/
+template<class evaluator>
+bool PotentialPair<evaluator>::evalFusedPair(const FusedPairArgs& args,
+                                             Scalar& force_divr,
+                                             Scalar& virial_divr,
+                                             Scalar& pair_eng) const
+    {
+    assert(m_fused_rcutsq && m_fused_ronsq);
+    bool evaluated = evaluatePair(args.rsq,
+                                  m_typpair_idx(args.typei, args.typej),
+                                  args.di,
+                                  args.dj,
+                                  args.qi,
+                                  args.qj,
+                                  m_fused_rcutsq->data,
+                                  m_fused_ronsq->data,
+                                  force_divr,
+                                  pair_eng);
+    virial_divr = force_divr;
+    return evaluated;
+    }
+
+template<class evaluator> void PotentialPair<evaluator>::endFusedSweep()
+    {
+    m_fused_rcutsq.reset();
+    m_fused_ronsq.reset();
     }
 
 #ifdef ENABLE_MPI
@@ -816,67 +1392,20 @@ inline void PotentialPair<evaluator>::computeEnergyBetweenSets(InputIterator fir
             // calculate r_ij squared (FLOPS: 5)
             Scalar rsq = dot(dx, dx);
 
-            // get parameters for this type pair
-            unsigned int typpair_idx = m_typpair_idx(typei, typej);
-            const param_type& param = m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-            Scalar ronsq = Scalar(0.0);
-            if (m_shift_mode == xplor)
-                ronsq = h_ronsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            // or 2) shift mode is explor and ron > rcut
-            bool energy_shift = false;
-            if (m_shift_mode == shift)
-                energy_shift = true;
-            else if (m_shift_mode == xplor)
-                {
-                if (ronsq > rcutsq)
-                    energy_shift = true;
-                }
-
             // compute the force and potential energy
             Scalar force_divr = Scalar(0.0);
             Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-            if (evaluator::needsDiameter())
-                eval.setDiameter(di, dj);
-            if (evaluator::needsCharge())
-                eval.setCharge(qi, qj);
-
-            bool evaluated = eval.evalForceAndEnergy(force_divr, pair_eng, energy_shift);
-
-            if (evaluated)
+            if (evaluatePair(rsq,
+                             m_typpair_idx(typei, typej),
+                             di,
+                             dj,
+                             qi,
+                             qj,
+                             h_rcutsq.data,
+                             h_ronsq.data,
+                             force_divr,
+                             pair_eng))
                 {
-                // modify the potential for xplor shifting
-                if (m_shift_mode == xplor)
-                    {
-                    if (rsq >= ronsq && rsq < rcutsq)
-                        {
-                        // Implement XPLOR smoothing (FLOPS: 16)
-                        Scalar old_pair_eng = pair_eng;
-                        Scalar old_force_divr = force_divr;
-
-                        // calculate 1.0 / (xplor denominator)
-                        Scalar xplor_denom_inv
-                            = Scalar(1.0)
-                              / ((rcutsq - ronsq) * (rcutsq - ronsq) * (rcutsq - ronsq));
-
-                        Scalar rsq_minus_r_cut_sq = rsq - rcutsq;
-                        Scalar s = rsq_minus_r_cut_sq * rsq_minus_r_cut_sq
-                                   * (rcutsq + Scalar(2.0) * rsq - Scalar(3.0) * ronsq)
-                                   * xplor_denom_inv;
-                        Scalar ds_dr_divr
-                            = Scalar(12.0) * (rsq - ronsq) * rsq_minus_r_cut_sq * xplor_denom_inv;
-
-                        // make modifications to the old pair energy and force
-                        pair_eng = old_pair_eng * s;
-                        // note: I'm not sure why the minus sign needs to be there: my notes have a
-                        // + But this is verified correct via plotting
-                        force_divr = s * old_force_divr - ds_dr_divr * old_pair_eng;
-                        }
-                    }
                 energy += pair_eng;
                 }
             }
@@ -934,6 +1463,7 @@ template<class T> void export_PotentialPair(pybind11::module& m, const std::stri
         .def("getROn", &T::getROn)
         .def_property("mode", &T::getShiftMode, &T::setShiftModePython)
         .def("computeEnergyBetweenSets", &T::computeEnergyBetweenSetsPythonList)
+        .def("getNumOverlappedComputes", &T::getNumOverlappedComputes)
         .def("slotWriteGSDShapeSpec", &T::slotWriteGSDShapeSpec)
         .def("connectGSDShapeSpec", &T::connectGSDShapeSpec);
     }
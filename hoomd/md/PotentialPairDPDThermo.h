@@ -64,9 +64,27 @@ template<class evaluator> class PotentialPairDPDThermo : public PotentialPair<ev
     virtual CommFlags getRequestedCommFlags(uint64_t timestep);
 #endif
 
+    //! Acquire the velocities and tags for a fused sweep
+    virtual void beginFusedSweep(uint64_t timestep);
+
+    //! Evaluate one pair (conservative and thermostat forces) in a fused sweep
+    virtual bool evalFusedPair(const FusedPairArgs& args,
+                               Scalar& force_divr,
+                               Scalar& virial_divr,
+                               Scalar& pair_eng) const;
+
+    //! Release the data acquired for a fused sweep
+    virtual void endFusedSweep();
+
     protected:
     std::shared_ptr<Variant> m_T; //!< Temperature for the DPD thermostat
 
+    /// Data held for the duration of a fused sweep
+    std::unique_ptr<ArrayHandle<Scalar4>> m_fused_vel;
+    std::unique_ptr<ArrayHandle<unsigned int>> m_fused_tag;
+    Scalar m_fused_T = Scalar(0.0);
+    uint64_t m_fused_timestep = 0;
+
     //! Actually compute the forces (overwrites PotentialPair::computeForces())
     virtual void computeForces(uint64_t timestep);
     };
@@ -147,133 +165,208 @@ template<class evaluator> void PotentialPairDPDThermo<evaluator>::computeForces(
 
     uint16_t seed = this->m_sysdef->getSeed();
 
-    // for each particle
-    for (int i = 0; i < (int)this->m_pdata->getN(); i++)
-        {
-        // access the particle's position, velocity, and type (MEM TRANSFER: 7 scalars)
-        Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
-        Scalar3 vi = make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
-
-        unsigned int typei = __scalar_as_int(h_pos.data[i].w);
-        const size_t head_i = h_head_list.data[i];
-
-        // sanity check
-        assert(typei < this->m_pdata->getNTypes());
-
-        // initialize current particle force, potential energy, and virial to 0
-        Scalar3 fi = make_scalar3(0, 0, 0);
-        Scalar pei = 0.0;
-        Scalar viriali[6];
-        for (unsigned int l = 0; l < 6; l++)
-            viriali[l] = 0.0;
-
-        // loop over all of the neighbors of this particle
-        const unsigned int size = (unsigned int)h_n_neigh.data[i];
-        for (unsigned int k = 0; k < size; k++)
+    // Special Potential Pair DPD Requirements
+    // evaluate the variant once, outside of the (possibly threaded) particle loop
+    const Scalar currentTemp = (*m_T)(timestep);
+
+    // compute the forces on particles [first, last), accumulating into force and virial
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
+    {
+        for (unsigned int i = first; i < last; i++)
             {
-            // access the index of this neighbor (MEM TRANSFER: 1 scalar)
-            unsigned int j = h_nlist.data[head_i + k];
-            assert(j < this->m_pdata->getN() + this->m_pdata->getNGhosts());
-
-            // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
-            Scalar3 dx = pi - pj;
-
-            // calculate dv_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
-            Scalar3 vj = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
-            Scalar3 dv = vi - vj;
-
-            // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
-            unsigned int typej = __scalar_as_int(h_pos.data[j].w);
-            assert(typej < this->m_pdata->getNTypes());
-
-            // apply periodic boundary conditions
-            dx = box.minImage(dx);
-
-            // calculate r_ij squared (FLOPS: 5)
-            Scalar rsq = dot(dx, dx);
-
-            // calculate the drag term r \dot v
-            Scalar rdotv = dot(dx, dv);
-
-            // get parameters for this type pair
-            unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
-            param_type param = this->m_params[typpair_idx];
-            Scalar rcutsq = h_rcutsq.data[typpair_idx];
-
-            // design specifies that energies are shifted if
-            // 1) shift mode is set to shift
-            bool energy_shift = false;
-            if (this->m_shift_mode == this->shift)
-                energy_shift = true;
-
-            // compute the force and potential energy
-            Scalar force_divr = Scalar(0.0);
-            Scalar force_divr_cons = Scalar(0.0);
-            Scalar pair_eng = Scalar(0.0);
-            evaluator eval(rsq, rcutsq, param);
-
-            // Special Potential Pair DPD Requirements
-            const Scalar currentTemp = (*m_T)(timestep);
-
-            // set seed using global tags
-            unsigned int tagi = h_tag.data[i];
-            unsigned int tagj = h_tag.data[j];
-            eval.set_seed_ij_timestep(seed, tagi, tagj, timestep);
-            eval.setDeltaT(this->m_deltaT);
-            eval.setRDotV(rdotv);
-            eval.setT(currentTemp);
-
-            bool evaluated
-                = eval.evalForceEnergyThermo(force_divr, force_divr_cons, pair_eng, energy_shift);
-
-            if (evaluated)
+            // access the particle's position, velocity, and type (MEM TRANSFER: 7 scalars)
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            Scalar3 vi = make_scalar3(h_vel.data[i].x, h_vel.data[i].y, h_vel.data[i].z);
+
+            unsigned int typei = __scalar_as_int(h_pos.data[i].w);
+            const size_t head_i = h_head_list.data[i];
+
+            // sanity check
+            assert(typei < this->m_pdata->getNTypes());
+
+            // initialize current particle force, potential energy, and virial to 0
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar viriali[6];
+            for (unsigned int l = 0; l < 6; l++)
+                viriali[l] = 0.0;
+
+            // loop over all of the neighbors of this particle
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int k = 0; k < size; k++)
                 {
-                // compute the virial (FLOPS: 2)
-                Scalar pair_virial[6];
-                pair_virial[0] = Scalar(0.5) * dx.x * dx.x * force_divr_cons;
-                pair_virial[1] = Scalar(0.5) * dx.x * dx.y * force_divr_cons;
-                pair_virial[2] = Scalar(0.5) * dx.x * dx.z * force_divr_cons;
-                pair_virial[3] = Scalar(0.5) * dx.y * dx.y * force_divr_cons;
-                pair_virial[4] = Scalar(0.5) * dx.y * dx.z * force_divr_cons;
-                pair_virial[5] = Scalar(0.5) * dx.z * dx.z * force_divr_cons;
-
-                // add the force, potential energy and virial to the particle i
-                // (FLOPS: 8)
-                fi += dx * force_divr;
-                pei += pair_eng * Scalar(0.5);
-                for (unsigned int l = 0; l < 6; l++)
-                    viriali[l] += pair_virial[l];
-
-                // add the force to particle j if we are using the third law (MEM TRANSFER: 10
-                // scalars / FLOPS: 8)
-                if (third_law)
+                // access the index of this neighbor (MEM TRANSFER: 1 scalar)
+                unsigned int j = h_nlist.data[head_i + k];
+                assert(j < this->m_pdata->getN() + this->m_pdata->getNGhosts());
+
+                // calculate dr_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                Scalar3 dx = pi - pj;
+
+                // calculate dv_ji (MEM TRANSFER: 3 scalars / FLOPS: 3)
+                Scalar3 vj = make_scalar3(h_vel.data[j].x, h_vel.data[j].y, h_vel.data[j].z);
+                Scalar3 dv = vi - vj;
+
+                // access the type of the neighbor particle (MEM TRANSFER: 1 scalar)
+                unsigned int typej = __scalar_as_int(h_pos.data[j].w);
+                assert(typej < this->m_pdata->getNTypes());
+
+                // apply periodic boundary conditions
+                dx = box.minImage(dx);
+
+                // calculate r_ij squared (FLOPS: 5)
+                Scalar rsq = dot(dx, dx);
+
+                // calculate the drag term r \dot v
+                Scalar rdotv = dot(dx, dv);
+
+                // get parameters for this type pair
+                unsigned int typpair_idx = this->m_typpair_idx(typei, typej);
+                param_type param = this->m_params[typpair_idx];
+                Scalar rcutsq = h_rcutsq.data[typpair_idx];
+
+                // design specifies that energies are shifted if
+                // 1) shift mode is set to shift
+                bool energy_shift = false;
+                if (this->m_shift_mode == this->shift)
+                    energy_shift = true;
+
+                // compute the force and potential energy
+                Scalar force_divr = Scalar(0.0);
+                Scalar force_divr_cons = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                evaluator eval(rsq, rcutsq, param);
+
+                // set seed using global tags
+                unsigned int tagi = h_tag.data[i];
+                unsigned int tagj = h_tag.data[j];
+                eval.set_seed_ij_timestep(seed, tagi, tagj, timestep);
+                eval.setDeltaT(this->m_deltaT);
+                eval.setRDotV(rdotv);
+                eval.setT(currentTemp);
+
+                bool evaluated = eval.evalForceEnergyThermo(force_divr,
+                                                            force_divr_cons,
+                                                            pair_eng,
+                                                            energy_shift);
+
+                if (evaluated)
                     {
-                    unsigned int mem_idx = j;
-                    h_force.data[mem_idx].x -= dx.x * force_divr;
-                    h_force.data[mem_idx].y -= dx.y * force_divr;
-                    h_force.data[mem_idx].z -= dx.z * force_divr;
-                    h_force.data[mem_idx].w += pair_eng * Scalar(0.5);
+                    // compute the virial (FLOPS: 2)
+                    Scalar pair_virial[6];
+                    pair_virial[0] = Scalar(0.5) * dx.x * dx.x * force_divr_cons;
+                    pair_virial[1] = Scalar(0.5) * dx.x * dx.y * force_divr_cons;
+                    pair_virial[2] = Scalar(0.5) * dx.x * dx.z * force_divr_cons;
+                    pair_virial[3] = Scalar(0.5) * dx.y * dx.y * force_divr_cons;
+                    pair_virial[4] = Scalar(0.5) * dx.y * dx.z * force_divr_cons;
+                    pair_virial[5] = Scalar(0.5) * dx.z * dx.z * force_divr_cons;
+
+                    // add the force, potential energy and virial to the particle i
+                    // (FLOPS: 8)
+                    fi += dx * force_divr;
+                    pei += pair_eng * Scalar(0.5);
                     for (unsigned int l = 0; l < 6; l++)
-                        h_virial.data[l * this->m_virial_pitch + mem_idx] += pair_virial[l];
+                        viriali[l] += pair_virial[l];
+
+                    // add the force to particle j if we are using the third law (MEM TRANSFER: 10
+                    // scalars / FLOPS: 8)
+                    if (third_law)
+                        {
+                        unsigned int mem_idx = j;
+                        force[mem_idx].x -= dx.x * force_divr;
+                        force[mem_idx].y -= dx.y * force_divr;
+                        force[mem_idx].z -= dx.z * force_divr;
+                        force[mem_idx].w += pair_eng * Scalar(0.5);
+                        for (unsigned int l = 0; l < 6; l++)
+                            virial[l * virial_pitch + mem_idx] += pair_virial[l];
+                        }
                     }
                 }
+
+            // finally, increment the force, potential energy and virial for particle i
+            unsigned int mem_idx = i;
+            force[mem_idx].x += fi.x;
+            force[mem_idx].y += fi.y;
+            force[mem_idx].z += fi.z;
+            force[mem_idx].w += pei;
+            for (unsigned int l = 0; l < 6; l++)
+                virial[l * virial_pitch + mem_idx] += viriali[l];
             }
+    };
 
-        // finally, increment the force, potential energy and virial for particle i
-        unsigned int mem_idx = i;
-        h_force.data[mem_idx].x += fi.x;
-        h_force.data[mem_idx].y += fi.y;
-        h_force.data[mem_idx].z += fi.z;
-        h_force.data[mem_idx].w += pei;
-        for (unsigned int l = 0; l < 6; l++)
-            h_virial.data[l * this->m_virial_pitch + mem_idx] += viriali[l];
-        }
+    // the third law applies forces to ghost neighbors as well
+    this->loopParticles(third_law, true, h_force, h_virial, compute_range, true);
 
     if (this->m_prof)
         this->m_prof->pop();
     }
 
+/*! \param timestep Current time step
+ */
+template<class evaluator>
+void PotentialPairDPDThermo<evaluator>::beginFusedSweep(uint64_t timestep)
+    {
+    PotentialPair<evaluator>::beginFusedSweep(timestep);
+    m_fused_vel.reset(new ArrayHandle<Scalar4>(this->m_pdata->getVelocities(),
+                                               access_location::host,
+                                               access_mode::read));
+    m_fused_tag.reset(new ArrayHandle<unsigned int>(this->m_pdata->getTags(),
+                                                    access_location::host,
+                                                    access_mode::read));
+    m_fused_T = (*m_T)(timestep);
+    m_fused_timestep = timestep;
+    }
+
+/*! \param args Pair geometry
+    \param force_divr Output: |F|/r of the total (conservative, drag, and random) force
+    \param virial_divr Output: |F|/r of the conservative force
+    \param pair_eng Output: pair energy
+*/
+template<class evaluator>
+bool PotentialPairDPDThermo<evaluator>::evalFusedPair(const FusedPairArgs& args,
+                                                      Scalar& force_divr,
+                                                      Scalar& virial_divr,
+                                                      Scalar& pair_eng) const
+    {
+    assert(m_fused_vel && m_fused_tag && this->m_fused_rcutsq);
+    const Scalar4* h_vel = m_fused_vel->data;
+    const unsigned int* h_tag = m_fused_tag->data;
+
+    // calculate the drag term r \dot v
+    Scalar3 dv = make_scalar3(h_vel[args.i].x - h_vel[args.j].x,
+                              h_vel[args.i].y - h_vel[args.j].y,
+                              h_vel[args.i].z - h_vel[args.j].z);
+    Scalar rdotv = dot(args.dx, dv);
+
+    unsigned int typpair_idx = this->m_typpair_idx(args.typei, args.typej);
+    evaluator eval(args.rsq, this->m_fused_rcutsq->data[typpair_idx], this->m_params[typpair_idx]);
+
+    // set seed using global tags
+    eval.set_seed_ij_timestep(this->m_sysdef->getSeed(),
+                              h_tag[args.i],
+                              h_tag[args.j],
+                              m_fused_timestep);
+    eval.setDeltaT(this->m_deltaT);
+    eval.setRDotV(rdotv);
+    eval.setT(m_fused_T);
+
+    return eval.evalForceEnergyThermo(force_divr,
+                                      virial_divr,
+                                      pair_eng,
+                                      this->m_shift_mode == this->shift);
+    }
+
+template<class evaluator> void PotentialPairDPDThermo<evaluator>::endFusedSweep()
+    {
+    m_fused_vel.reset();
+    m_fused_tag.reset();
+    PotentialPair<evaluator>::endFusedSweep();
+    }
+
 #ifdef ENABLE_MPI
 /*! \param timestep Current time step
  */
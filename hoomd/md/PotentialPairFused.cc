@@ -0,0 +1,255 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#include "PotentialPairFused.h"
+
+#include <stdexcept>
+#include <string.h>
+
+/*! \file PotentialPairFused.cc
+    \brief Contains code for the PotentialPairFused class
+*/
+
+namespace hoomd
+    {
+namespace md
+    {
+/*! \param sysdef System to compute forces on
+    \param nlist Neighbor list shared by all members
+*/
+PotentialPairFused::PotentialPairFused(std::shared_ptr<SystemDefinition> sysdef,
+                                       std::shared_ptr<NeighborList> nlist)
+    : ForceCompute(sysdef), m_nlist(nlist)
+    {
+    m_exec_conf->msg->notice(5) << "Constructing PotentialPairFused" << std::endl;
+    assert(m_nlist);
+    }
+
+PotentialPairFused::~PotentialPairFused()
+    {
+    m_exec_conf->msg->notice(5) << "Destroying PotentialPairFused" << std::endl;
+    }
+
+/*! \param potential Pair potential to evaluate. It must implement FusedPairInterface and use the
+    same neighbor list as this compute.
+*/
+void PotentialPairFused::addPotential(std::shared_ptr<ForceCompute> potential)
+    {
+    FusedPairInterface* fused = dynamic_cast<FusedPairInterface*>(potential.get());
+    if (!fused)
+        {
+        throw std::runtime_error("This pair potential cannot be fused.");
+        }
+    if (fused->getFusedNList() != m_nlist)
+        {
+        throw std::runtime_error("Fused pair potentials must all use the same neighbor list.");
+        }
+
+    m_potentials.push_back(potential);
+    m_fused.push_back(fused);
+    m_needs_diameter = m_needs_diameter || fused->fusedNeedsDiameter();
+    m_needs_charge = m_needs_charge || fused->fusedNeedsCharge();
+    }
+
+void PotentialPairFused::clearPotentials()
+    {
+    m_potentials.clear();
+    m_fused.clear();
+    m_needs_diameter = false;
+    m_needs_charge = false;
+    }
+
+/*! \param dt Timestep size
+ */
+void PotentialPairFused::setDeltaT(Scalar dt)
+    {
+    ForceCompute::setDeltaT(dt);
+    for (auto& potential : m_potentials)
+        potential->setDeltaT(dt);
+    }
+
+#ifdef ENABLE_MPI
+/*! \param timestep Current time step
+ */
+CommFlags PotentialPairFused::getRequestedCommFlags(uint64_t timestep)
+    {
+    CommFlags flags = ForceCompute::getRequestedCommFlags(timestep);
+    for (auto& potential : m_potentials)
+        flags |= potential->getRequestedCommFlags(timestep);
+    return flags;
+    }
+#endif
+
+/*! \param timestep Current time step
+ */
+void PotentialPairFused::computeForces(uint64_t timestep)
+    {
+    // start by updating the neighborlist
+    m_nlist->compute(timestep);
+
+    if (m_prof)
+        m_prof->push("Pair fused");
+
+    bool third_law = m_nlist->getStorageMode() == NeighborList::half;
+
+    ArrayHandle<unsigned int> h_n_neigh(m_nlist->getNNeighArray(),
+                                        access_location::host,
+                                        access_mode::read);
+    ArrayHandle<unsigned int> h_nlist(m_nlist->getNListArray(),
+                                      access_location::host,
+                                      access_mode::read);
+    ArrayHandle<size_t> h_head_list(m_nlist->getHeadList(),
+                                    access_location::host,
+                                    access_mode::read);
+
+    ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
+    ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
+                                   access_location::host,
+                                   access_mode::read);
+    ArrayHandle<Scalar> h_charge(m_pdata->getCharges(), access_location::host, access_mode::read);
+
+    ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
+    ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
+
+    const BoxDim& box = m_pdata->getGlobalBox();
+
+    PDataFlags flags = m_pdata->getFlags();
+    bool compute_virial = flags[pdata_flag::pressure_tensor];
+
+    memset((void*)h_force.data, 0, sizeof(Scalar4) * m_force.getNumElements());
+    memset((void*)h_virial.data, 0, sizeof(Scalar) * m_virial.getNumElements());
+
+    for (auto fused : m_fused)
+        fused->beginFusedSweep(timestep);
+
+    const unsigned int N = m_pdata->getN();
+    const unsigned int n_potentials = (unsigned int)m_fused.size();
+
+    auto compute_range = [&](unsigned int first,
+                             unsigned int last,
+                             Scalar4* force,
+                             Scalar* virial,
+                             size_t virial_pitch)
+    {
+        FusedPairArgs args;
+        for (unsigned int i = first; i < last; i++)
+            {
+            Scalar3 pi = make_scalar3(h_pos.data[i].x, h_pos.data[i].y, h_pos.data[i].z);
+            args.i = i;
+            args.typei = __scalar_as_int(h_pos.data[i].w);
+            args.di = m_needs_diameter ? h_diameter.data[i] : Scalar(0.0);
+            args.qi = m_needs_charge ? h_charge.data[i] : Scalar(0.0);
+
+            Scalar3 fi = make_scalar3(0, 0, 0);
+            Scalar pei = 0.0;
+            Scalar viriali[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+            const size_t head_i = h_head_list.data[i];
+            const unsigned int size = (unsigned int)h_n_neigh.data[i];
+            for (unsigned int k = 0; k < size; k++)
+                {
+                // load the neighbor and compute the pair geometry once for all members
+                unsigned int j = h_nlist.data[head_i + k];
+                assert(j < m_pdata->getN() + m_pdata->getNGhosts());
+
+                Scalar3 pj = make_scalar3(h_pos.data[j].x, h_pos.data[j].y, h_pos.data[j].z);
+                args.j = j;
+                args.typej = __scalar_as_int(h_pos.data[j].w);
+                args.dx = box.minImage(pi - pj);
+                args.rsq = dot(args.dx, args.dx);
+                args.dj = m_needs_diameter ? h_diameter.data[j] : Scalar(0.0);
+                args.qj = m_needs_charge ? h_charge.data[j] : Scalar(0.0);
+
+                // sum the contributions of all members
+                Scalar force_divr = Scalar(0.0);
+                Scalar virial_divr = Scalar(0.0);
+                Scalar pair_eng = Scalar(0.0);
+                bool evaluated = false;
+                for (unsigned int m = 0; m < n_potentials; m++)
+                    {
+                    Scalar member_force_divr = Scalar(0.0);
+                    Scalar member_virial_divr = Scalar(0.0);
+                    Scalar member_pair_eng = Scalar(0.0);
+                    if (m_fused[m]->evalFusedPair(args,
+                                                  member_force_divr,
+                                                  member_virial_divr,
+                                                  member_pair_eng))
+                        {
+                        force_divr += member_force_divr;
+                        virial_divr += member_virial_divr;
+                        pair_eng += member_pair_eng;
+                        evaluated = true;
+                        }
+                    }
+
+                if (!evaluated)
+                    continue;
+
+                const Scalar3& dx = args.dx;
+                Scalar pair_virial[6];
+                pair_virial[0] = Scalar(0.5) * virial_divr * dx.x * dx.x;
+                pair_virial[1] = Scalar(0.5) * virial_divr * dx.x * dx.y;
+                pair_virial[2] = Scalar(0.5) * virial_divr * dx.x * dx.z;
+                pair_virial[3] = Scalar(0.5) * virial_divr * dx.y * dx.y;
+                pair_virial[4] = Scalar(0.5) * virial_divr * dx.y * dx.z;
+                pair_virial[5] = Scalar(0.5) * virial_divr * dx.z * dx.z;
+
+                fi += dx * force_divr;
+                pei += pair_eng * Scalar(0.5);
+                if (compute_virial)
+                    {
+                    for (unsigned int l = 0; l < 6; l++)
+                        viriali[l] += pair_virial[l];
+                    }
+
+                // only add the reaction to local particles
+                if (third_law && j < N)
+                    {
+                    force[j].x -= dx.x * force_divr;
+                    force[j].y -= dx.y * force_divr;
+                    force[j].z -= dx.z * force_divr;
+                    force[j].w += pair_eng * Scalar(0.5);
+                    if (compute_virial)
+                        {
+                        for (unsigned int l = 0; l < 6; l++)
+                            virial[l * virial_pitch + j] += pair_virial[l];
+                        }
+                    }
+                }
+
+            force[i].x += fi.x;
+            force[i].y += fi.y;
+            force[i].z += fi.z;
+            force[i].w += pei;
+            if (compute_virial)
+                {
+                for (unsigned int l = 0; l < 6; l++)
+                    virial[l * virial_pitch + i] += viriali[l];
+                }
+            }
+    };
+
+    loopParticles(third_law, compute_virial, h_force, h_virial, compute_range);
+
+    for (auto fused : m_fused)
+        fused->endFusedSweep();
+
+    if (m_prof)
+        m_prof->pop();
+    }
+
+namespace detail
+    {
+void export_PotentialPairFused(pybind11::module& m)
+    {
+    pybind11::class_<PotentialPairFused, ForceCompute, std::shared_ptr<PotentialPairFused>>(
+        m,
+        "PotentialPairFused")
+        .def(pybind11::init<std::shared_ptr<SystemDefinition>, std::shared_ptr<NeighborList>>())
+        .def("addPotential", &PotentialPairFused::addPotential)
+        .def("clearPotentials", &PotentialPairFused::clearPotentials);
+    }
+
+    } // end namespace detail
+    } // end namespace md
+    } // end namespace hoomd
@@ -0,0 +1,87 @@
+// Copyright (c) 2009-2022 The Regents of the University of Michigan.
+// Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+#ifndef __POTENTIAL_PAIR_FUSED_H__
+#define __POTENTIAL_PAIR_FUSED_H__
+
+#include "FusedPairInterface.h"
+#include "NeighborList.h"
+#include "hoomd/ForceCompute.h"
+
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <vector>
+
+/*! \file PotentialPairFused.h
+    \brief Declares the PotentialPairFused class
+*/
+
+#ifdef __HIPCC__
+#error This header cannot be compiled by nvcc
+#endif
+
+namespace hoomd
+    {
+namespace md
+    {
+//! Evaluates several pair potentials in one traversal of a shared neighbor list
+/*! Simulations that combine pair potentials on the same neighbor list (for example LJ, Yukawa,
+    and DPD) otherwise walk the list once per potential, reloading positions and recomputing the
+    minimum image separation every time. PotentialPairFused loads each pair once, computes dx and
+    r^2, and asks every member (see FusedPairInterface) to evaluate it. The contributions are
+    accumulated into a single force, energy, and virial array.
+
+    The members keep their own parameters and cutoffs (and register them with the neighbor list as
+    usual), but their own compute() is not called: only the sum is available from this class.
+
+    Threading and the half/full neighbor list handling follow ForceCompute::loopParticles().
+*/
+class PYBIND11_EXPORT PotentialPairFused : public ForceCompute
+    {
+    public:
+    //! Constructor
+    PotentialPairFused(std::shared_ptr<SystemDefinition> sysdef,
+                       std::shared_ptr<NeighborList> nlist);
+
+    //! Destructor
+    virtual ~PotentialPairFused();
+
+    //! Add a pair potential to evaluate
+    void addPotential(std::shared_ptr<ForceCompute> potential);
+
+    //! Remove all pair potentials
+    void clearPotentials();
+
+    //! Set the timestep size on this compute and its members
+    virtual void setDeltaT(Scalar dt);
+
+#ifdef ENABLE_MPI
+    //! Get ghost particle fields requested by the members
+    virtual CommFlags getRequestedCommFlags(uint64_t timestep);
+#endif
+
+    protected:
+    std::shared_ptr<NeighborList> m_nlist; //!< The shared neighbor list
+
+    /// The members, as force computes (to keep them alive) and as fused evaluators
+    std::vector<std::shared_ptr<ForceCompute>> m_potentials;
+    std::vector<FusedPairInterface*> m_fused;
+
+    bool m_needs_diameter = false; //!< True when any member needs diameters
+    bool m_needs_charge = false;   //!< True when any member needs charges
+
+    //! Actually compute the forces
+    virtual void computeForces(uint64_t timestep);
+    };
+
+namespace detail
+    {
+//! Exports the PotentialPairFused class to python
+void export_PotentialPairFused(pybind11::module& m);
+
+    } // end namespace detail
+
+    } // end namespace md
+    } // end namespace hoomd
+
+#endif // __POTENTIAL_PAIR_FUSED_H__
@@ -189,7 +189,10 @@ template<class evaluator> void PotentialSpecialPair<evaluator>::computeForces(ui
 
     // access the particle data arrays
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<typename PairData::members_t> h_pair_idx(m_pair_data->getIndexTable(),
+                                                         access_location::host,
+                                                         access_mode::read);
     ArrayHandle<Scalar> h_diameter(m_pdata->getDiameters(),
                                    access_location::host,
                                    access_mode::read);
@@ -244,8 +247,8 @@ template<class evaluator> void PotentialSpecialPair<evaluator>::computeForces(ui
 
         // transform a and b into indices into the particle data arrays
         // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[bond.tag[0]];
-        unsigned int idx_b = h_rtag.data[bond.tag[1]];
+        unsigned int idx_a = h_pair_idx.data[i].idx[0];
+        unsigned int idx_b = h_pair_idx.data[i].idx[1];
 
         // throw an error if this bond is incomplete
         if (idx_a >= max_local || idx_b >= max_local)
@@ -103,7 +103,10 @@ void TableDihedralForceCompute::computeForces(uint64_t timestep)
     ArrayHandle<Scalar4> h_pos(m_pdata->getPositions(), access_location::host, access_mode::read);
     ArrayHandle<Scalar4> h_force(m_force, access_location::host, access_mode::overwrite);
     ArrayHandle<Scalar> h_virial(m_virial, access_location::host, access_mode::overwrite);
-    ArrayHandle<unsigned int> h_rtag(m_pdata->getRTags(), access_location::host, access_mode::read);
+    // member indices of the groups, in the same order as the groups
+    ArrayHandle<DihedralData::members_t> h_dihedral_idx(m_dihedral_data->getIndexTable(),
+                                                        access_location::host,
+                                                        access_mode::read);
 
     // there are enough other checks on the input data: but it doesn't hurt to be safe
     assert(h_force.data);
@@ -135,10 +138,10 @@ void TableDihedralForceCompute::computeForces(uint64_t timestep)
 
         // transform a and b into indices into the particle data arrays
         // (MEM TRANSFER: 4 integers)
-        unsigned int idx_a = h_rtag.data[dihedral.tag[0]];
-        unsigned int idx_b = h_rtag.data[dihedral.tag[1]];
-        unsigned int idx_c = h_rtag.data[dihedral.tag[2]];
-        unsigned int idx_d = h_rtag.data[dihedral.tag[3]];
+        unsigned int idx_a = h_dihedral_idx.data[i].idx[0];
+        unsigned int idx_b = h_dihedral_idx.data[i].idx[1];
+        unsigned int idx_c = h_dihedral_idx.data[i].idx[2];
+        unsigned int idx_d = h_dihedral_idx.data[i].idx[3];
 
         // throw an error if this angle is incomplete
         if (idx_a == NOT_LOCAL || idx_b == NOT_LOCAL || idx_c == NOT_LOCAL || idx_d == NOT_LOCAL)
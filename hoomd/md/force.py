@@ -119,6 +119,16 @@ class Force(_HOOMDBaseObject):
             virial.append(self._cpp_obj.getExternalVirial(i))
         return numpy.array(virial, dtype=numpy.float64)
 
+    @log(default=False, requires_run=True)
+    def compute_time(self):
+        """float: Wall clock time spent in the last evaluation of the force \
+        :math:`[\\mathrm{s}]`.
+
+        On the GPU, `compute_time` is the time needed to launch the kernels
+        and does not include the time the kernels run asynchronously.
+        """
+        return self._cpp_obj.getComputeTime()
+
     @property
     def cpu_local_force_arrays(self):
         """hoomd.md.data.ForceLocalAccess: Expose force arrays on the CPU.
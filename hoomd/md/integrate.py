@@ -10,6 +10,7 @@ from hoomd.data.parameterdicts import ParameterDict
 from hoomd.data.typeconverter import OnlyTypes
 from hoomd.integrate import BaseIntegrator
 from hoomd.data import syncedlist
+from hoomd.logging import log
 from hoomd.md.methods import Method
 from hoomd.md.force import Force
 from hoomd.md.constrain import Constraint, Rigid
@@ -172,6 +173,13 @@ class Integrator(_DynamicIntegrator):
         rigid (hoomd.md.constrain.Rigid): A rigid bodies object defining the
             rigid bodies in the simulation.
 
+        slow_forces (Sequence[hoomd.md.force.Force]): Sequence of slowly
+            varying forces evaluated every ``slow_interval`` steps. The default
+            value of ``None`` initializes an empty list.
+
+        slow_interval (int): Number of time steps between evaluations of the
+            forces in ``slow_forces``.
+
 
     Classes of the following modules can be used as elements in `methods`:
 
@@ -195,6 +203,48 @@ class Integrator(_DynamicIntegrator):
 
     - `hoomd.md.constrain`
 
+    .. rubric:: Multiple time step integration
+
+    `Integrator` evaluates the forces in `slow_forces` only on the time steps
+    that are multiples of `slow_interval` and applies them as impulses with the
+    reversible reference system propagator algorithm (r-RESPA, `Tuckerman et
+    al. 1992`_). The forces in `forces` are integrated with the step size `dt`.
+    The forces in `slow_forces` are integrated with the outer step size
+    ``slow_interval * dt``: every `slow_interval` steps, the integration
+    methods add the impulse ``slow_interval * dt / 2`` times the slow force to
+    the velocities at the end of one outer step and at the beginning of the
+    next. Outer steps always fall on the multiples of `slow_interval`. When the
+    first run of a simulation starts ``n`` steps before the next outer step,
+    the first outer step is ``n`` steps long and `Integrator` adds the impulse
+    ``(n - slow_interval / 2) * dt`` times the slow force at the first step,
+    so that the slow impulse over the first outer step is ``n * dt`` times
+    the slow force. Use `slow_forces` for expensive forces that vary slowly in
+    time, such as `hoomd.md.long_range.pppm.Coulomb`, and keep stiff forces
+    such as bonds in `forces`. `slow_interval` is limited by resonances with the fast motions,
+    values of 2 to 4 typically conserve energy well.
+
+    Note:
+        The net force, potential energy and virial include the slow forces only
+        on the time steps that are multiples of `slow_interval`. Write and log
+        thermodynamic quantities on these steps, and use `slow_interval` = 1
+        with integration methods that control the pressure.
+
+    .. _Tuckerman et al. 1992: https://doi.org/10.1063/1.463137
+
+    .. rubric:: Parallel force evaluation
+
+    On the CPU with more than one thread (see `hoomd.device.CPU`) and without
+    domain decomposition, `Integrator` computes independent forces in parallel
+    tasks. Pair potentials, `hoomd.md.long_range.pppm.Coulomb`, and harmonic
+    bonds, angles, and dihedrals run in parallel with each other, except that
+    forces which share a neighbor list or a group of bonds are computed one
+    after the other in the same task. All other forces are computed serially
+    before the tasks start. The net force is summed in the order of `forces`
+    after all tasks finish, so the result does not depend on the number of
+    threads or on the order in which the tasks complete. Log `Force.compute_time
+    <hoomd.md.force.Force.compute_time>` and `net_force_time` to find the
+    forces that dominate the cost of a time step.
+
 
     Examples::
 
@@ -225,6 +275,12 @@ class Integrator(_DynamicIntegrator):
 
         rigid (hoomd.md.constrain.Rigid): The rigid body definition for the
             simulation associated with the integrator.
+
+        slow_forces (list[hoomd.md.force.Force]): List of slowly varying forces
+            evaluated every `slow_interval` steps.
+
+        slow_interval (int): Number of time steps between evaluations of the
+            forces in `slow_forces`.
     """
 
     def __init__(self,
@@ -233,23 +289,65 @@ class Integrator(_DynamicIntegrator):
                  forces=None,
                  constraints=None,
                  methods=None,
-                 rigid=None):
+                 rigid=None,
+                 slow_forces=None,
+                 slow_interval=1):
 
         super().__init__(forces, constraints, methods, rigid)
 
+        slow_forces = [] if slow_forces is None else slow_forces
+        self._slow_forces = syncedlist.SyncedList(
+            Force, syncedlist._PartialGetAttr('_cpp_obj'), iterable=slow_forces)
+
         self._param_dict.update(
             ParameterDict(
                 dt=float(dt),
-                integrate_rotational_dof=bool(integrate_rotational_dof)))
+                integrate_rotational_dof=bool(integrate_rotational_dof),
+                slow_interval=int(slow_interval)))
 
     def _attach(self):
         # initialize the reflected c++ class
         self._cpp_obj = _md.IntegratorTwoStep(
             self._simulation.state._cpp_sys_def, self.dt)
+        self.slow_forces._sync(self._simulation, self._cpp_obj.slow_forces)
         # Call attach from DynamicIntegrator which attaches forces,
         # constraint_forces, and methods, and calls super()._attach() itself.
         super()._attach()
 
+    def _detach(self):
+        self._slow_forces._unsync()
+        super()._detach()
+
+    @property
+    def slow_forces(self):
+        return self._slow_forces
+
+    @slow_forces.setter
+    def slow_forces(self, value):
+        _set_synced_list(self._slow_forces, value)
+
+    @property
+    def _children(self):
+        children = super()._children
+        children.extend(self.slow_forces)
+
+        for child in self.slow_forces:
+            children.extend(child._children)
+
+        return children
+
+    @log(default=False, requires_run=True)
+    def net_force_time(self):
+        """float: Wall clock time spent computing and summing the forces in \
+        the last time step :math:`[\\mathrm{s}]`.
+
+        Note:
+            In MPI parallel simulations, the time includes the communication
+            that forces perform while they compute, such as the distributed
+            FFTs of `hoomd.md.long_range.pppm.Coulomb`.
+        """
+        return self._cpp_obj.getNetForceTime()
+
     def __setattr__(self, attr, value):
         """Hande group DOF update when setting integrate_rotational_dof."""
         super().__setattr__(attr, value)
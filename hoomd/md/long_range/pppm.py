@@ -4,12 +4,18 @@
 """Long-range potentials evaluated using the PPPM method."""
 
 import hoomd
+from hoomd.data.typeconverter import OnlyFrom
 from hoomd.md.force import Force
 import math
 import numpy
 
 
-def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
+def make_pppm_coulomb_forces(nlist,
+                             resolution,
+                             order,
+                             r_cut,
+                             alpha=0,
+                             differentiation='ik'):
     """Long range Coulomb interactions evaluated using the PPPM method.
 
     Args:
@@ -22,6 +28,8 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        differentiation (str): Scheme that computes the forces from the mesh
+          potential, ``'ik'`` or ``'ad'``.
 
     Evaluate the potential energy :math:`U_\\mathrm{coulomb}` and apply
     the corresponding forces to the particles in the simulation.
@@ -74,6 +82,16 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
     cutoff is so large that the short ranged interactions are inefficient. See
     `Salin, G and Caillol, J. 2000`_ for details.
 
+    With ``differentiation='ik'``, `md.long_range.pppm.Coulomb` computes the
+    electric field on the grid in Fourier space, which takes three inverse
+    fast Fourier transforms. With ``differentiation='ad'`` (analytical
+    differentiation), it computes the potential on the grid with a single
+    inverse transform and differentiates the charge assignment function to
+    compute the forces. ``'ad'`` is faster, especially in MPI simulations, but
+    less accurate at the same grid resolution and it conserves momentum only
+    approximately. See `Stern, H. A. and Calkins, K. G. 2008`_ for details.
+    ``'ad'`` is available only on the CPU.
+
     Warning:
         In MPI simulations with multiple ranks, the grid resolution must be a
         power of two in each dimension.
@@ -94,6 +112,8 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
     .. _D. LeBard et. al. 2012: http://dx.doi.org/10.1039/c1sm06787g
 
     .. _Salin, G and Caillol, J. 2000: http://dx.doi.org/10.1063/1.1326477
+
+    .. _Stern, H. A. and Calkins, K. G. 2008: https://doi.org/10.1063/1.2932253
     """
     real_space_force = hoomd.md.pair.Ewald(nlist)
 
@@ -107,7 +127,8 @@ def make_pppm_coulomb_forces(nlist, resolution, order, r_cut, alpha=0):
                                      order=order,
                                      r_cut=r_cut,
                                      alpha=0,
-                                     pair_force=real_space_force)
+                                     pair_force=real_space_force,
+                                     differentiation=differentiation)
 
     return real_space_force, reciprocal_space_force
 
@@ -129,9 +150,18 @@ class Coulomb(Force):
           space terms :math:`\\mathrm{[length]}`.
         alpha (float): Debye screening parameter
           :math:`\\mathrm{[length^{-1}]}`.
+        differentiation (str): Scheme that computes the forces from the mesh
+          potential, ``'ik'`` or ``'ad'``.
     """
 
-    def __init__(self, nlist, resolution, order, r_cut, alpha, pair_force):
+    def __init__(self,
+                 nlist,
+                 resolution,
+                 order,
+                 r_cut,
+                 alpha,
+                 pair_force,
+                 differentiation='ik'):
         super().__init__()
         self._nlist = hoomd.data.typeconverter.OnlyTypes(
             hoomd.md.nlist.NList)(nlist)
@@ -139,12 +169,15 @@ class Coulomb(Force):
             hoomd.data.parameterdicts.ParameterDict(resolution=(int, int, int),
                                                     order=int,
                                                     r_cut=float,
-                                                    alpha=float))
+                                                    alpha=float,
+                                                    differentiation=OnlyFrom(
+                                                        ['ik', 'ad'])))
 
         self.resolution = resolution
         self.order = order
         self.r_cut = r_cut
         self.alpha = alpha
+        self.differentiation = differentiation
         self._pair_force = pair_force
 
     def _attach(self):
@@ -235,6 +268,7 @@ class Coulomb(Force):
                 self._pair_force.params[(a, b)] = dict(kappa=kappa, alpha=alpha)
                 self._pair_force.r_cut[(a, b)] = rcut
 
+        self._cpp_obj.setDifferentiation(self.differentiation)
         self._cpp_obj.setParams(Nx, Ny, Nz, order, kappa, rcut, alpha)
 
         super()._attach()
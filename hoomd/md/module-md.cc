@@ -38,6 +38,7 @@
 #include "MuellerPlatheFlow.h"
 #include "NeighborList.h"
 #include "NeighborListBinned.h"
+#include "NeighborListCluster.h"
 #include "NeighborListStencil.h"
 #include "NeighborListTree.h"
 #include "OPLSDihedralForceCompute.h"
@@ -46,6 +47,7 @@
 #include "PotentialExternal.h"
 #include "PotentialPair.h"
 #include "PotentialPairDPDThermo.h"
+#include "PotentialPairFused.h"
 #include "PotentialTersoff.h"
 #include "QuaternionMath.h"
 #include "TableAngleForceCompute.h"
@@ -225,6 +227,7 @@ PYBIND11_MODULE(_md, m)
     export_PotentialPairDPDThermo<PotentialPairDPDLJThermoDPD, PotentialPairDPDLJ>(
         m,
         "PotentialPairDPDLJThermoDPD");
+    export_PotentialPairFused(m);
     export_PotentialBond<PotentialBondHarmonic>(m, "PotentialBondHarmonic");
     export_PotentialBond<PotentialBondFENE>(m, "PotentialBondFENE");
     export_PotentialBond<PotentialBondTether>(m, "PotentialBondTether");
@@ -233,6 +236,7 @@ PYBIND11_MODULE(_md, m)
     export_CustomForceCompute(m);
     export_NeighborList(m);
     export_NeighborListBinned(m);
+    export_NeighborListCluster(m);
     export_NeighborListStencil(m);
     export_NeighborListTree(m);
     export_MolecularForceCompute(m);
@@ -40,6 +40,21 @@ class NList(_HOOMDBaseObject):
     `check_dist` is `False`, `NList` always rebuilds after
     `rebuild_check_delay` time steps.
 
+    .. rubric:: Adaptive mode
+
+    When `adaptive` is `True` and `check_dist` is `True`, `NList` measures how
+    far particles have moved relative to ``buffer/2`` at every distance check,
+    estimates the rate at which they move, and skips the checks on time steps
+    where no particle can have moved far enough to require a rebuild. In
+    addition, `NList` times the simulation steps and adjusts `buffer` to the
+    value that minimizes the time per step, starting from the given `buffer`.
+    The tuned value takes effect at the next rebuild and the tuning stops once
+    it converges. Setting `buffer` restarts the tuning.
+
+    Note:
+        The distance checks are only skipped on the CPU. On the GPU,
+        `adaptive` only tunes `buffer`.
+
     .. rubric:: Exclusions
 
     Neighbor lists nominally include all particles within the specified cutoff
@@ -79,10 +94,12 @@ class NList(_HOOMDBaseObject):
         check_dist (bool): Flag to enable / disable distance checking.
         max_diameter (float): The maximum diameter a particle will achieve
             :math:`[\mathrm{length}]`.
+        adaptive (bool): Flag to enable / disable the adaptive mode, see more
+            details above.
     """
 
     def __init__(self, buffer, exclusions, rebuild_check_delay, diameter_shift,
-                 check_dist, max_diameter):
+                 check_dist, max_diameter, adaptive):
 
         validate_exclusions = OnlyFrom([
             'bond', 'angle', 'constraint', 'dihedral', 'special_pair', 'body',
@@ -94,7 +111,8 @@ class NList(_HOOMDBaseObject):
                                rebuild_check_delay=int(rebuild_check_delay),
                                check_dist=bool(check_dist),
                                diameter_shift=bool(diameter_shift),
-                               max_diameter=float(max_diameter))
+                               max_diameter=float(max_diameter),
+                               adaptive=bool(adaptive))
         params["exclusions"] = exclusions
         self._param_dict.update(params)
 
@@ -107,6 +125,17 @@ class NList(_HOOMDBaseObject):
         """
         return self._cpp_obj.getSmallestRebuild()
 
+    @log(requires_run=True)
+    def dangerous_builds(self):
+        """int: The number of dangerous neighbor list builds.
+
+        A build is dangerous when particles may have moved farther than
+        ``buffer/2`` since the previous build, so the neighbor list may have
+        missed interactions. `dangerous_builds` counts these builds during the
+        previous `Simulation.run`.
+        """
+        return self._cpp_obj.getNumDangerousUpdates()
+
     def _remove_dependent(self, obj):
         super()._remove_dependent(obj)
         if len(self._dependents) == 0:
@@ -135,6 +164,8 @@ class Cell(NList):
             :math:`[\mathrm{length}]`.
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
+        adaptive (bool): Flag to enable / disable the adaptive mode, see more
+            details in `NList`.
 
     `Cell` finds neighboring particles using a fixed width cell list, allowing
     for *O(kN)* construction of the neighbor list where *k* is the number of
@@ -159,10 +190,11 @@ class Cell(NList):
                  diameter_shift=False,
                  check_dist=True,
                  max_diameter=1.0,
-                 deterministic=False):
+                 deterministic=False,
+                 adaptive=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay,
-                         diameter_shift, check_dist, max_diameter)
+                         diameter_shift, check_dist, max_diameter, adaptive)
 
         self._param_dict.update(
             ParameterDict(deterministic=bool(deterministic)))
@@ -177,6 +209,74 @@ class Cell(NList):
         super()._attach()
 
 
+class Cluster(NList):
+    r"""Neighbor list computed via a cell list and stored as cluster pairs.
+
+    Args:
+        buffer (float): Buffer width :math:`[\mathrm{length}]`.
+        exclusions (tuple[str]): Defines which particles to exlclude from the
+            neighbor list, see more details in `NList`.
+        rebuild_check_delay (int): How often to attempt to rebuild the neighbor
+            list.
+        diameter_shift (bool): Flag to enable / disable diameter shifting.
+        check_dist (bool): Flag to enable / disable distance checking.
+        max_diameter (float): The maximum diameter a particle will achieve
+            :math:`[\mathrm{length}]`.
+        deterministic (bool): When `True`, sort neighbors to help provide
+            deterministic simulation runs.
+        adaptive (bool): Flag to enable / disable the adaptive mode, see more
+            details in `NList`.
+
+    `Cluster` finds neighboring particles with the same cell list as `Cell`
+    and groups spatially close particles into clusters of 4. It stores, for
+    every cluster, the clusters that contain neighbors of its particles along
+    with a mask of the interacting particle pairs. Pair potentials that
+    support it (`hoomd.md.pair.LJ`, `hoomd.md.pair.Gauss`,
+    `hoomd.md.pair.Yukawa`, `hoomd.md.pair.Morse`, and
+    `hoomd.md.pair.ForceShiftedLJ` without ``mode='xplor'``) evaluate all pairs
+    of two clusters together, reading the positions from contiguous memory,
+    which makes better use of the SIMD units of the CPU. Other pair potentials
+    use the per particle neighbor list, which `Cluster` also provides.
+
+    Note:
+        `Cluster` is optimized for the CPU. On the GPU, it builds the same
+        neighbor list as `Cell`.
+
+    Examples::
+
+        cluster = nlist.Cluster(buffer=0.4)
+
+    Attributes:
+        deterministic (bool): When `True`, sort neighbors to help provide
+            deterministic simulation runs.
+    """
+
+    def __init__(self,
+                 buffer,
+                 exclusions=('bond',),
+                 rebuild_check_delay=1,
+                 diameter_shift=False,
+                 check_dist=True,
+                 max_diameter=1.0,
+                 deterministic=False,
+                 adaptive=False):
+
+        super().__init__(buffer, exclusions, rebuild_check_delay,
+                         diameter_shift, check_dist, max_diameter, adaptive)
+
+        self._param_dict.update(
+            ParameterDict(deterministic=bool(deterministic)))
+
+    def _attach(self):
+        if isinstance(self._simulation.device, hoomd.device.CPU):
+            nlist_cls = _md.NeighborListCluster
+        else:
+            nlist_cls = _md.NeighborListGPUBinned
+        self._cpp_obj = nlist_cls(self._simulation.state._cpp_sys_def,
+                                  self.buffer)
+        super()._attach()
+
+
 class Stencil(NList):
     """Cell list based neighbor list using stencils.
 
@@ -194,6 +294,8 @@ class Stencil(NList):
             :math:`[\\mathrm{length}]`.
         deterministic (bool): When `True`, sort neighbors to help provide
             deterministic simulation runs.
+        adaptive (bool): Flag to enable / disable the adaptive mode, see more
+            details in `NList`.
 
     `Stencil` creates a cell list based neighbor list object to which pair
     potentials can be attached for computing non-bonded pairwise interactions.
@@ -238,10 +340,11 @@ class Stencil(NList):
                  diameter_shift=False,
                  check_dist=True,
                  max_diameter=1.0,
-                 deterministic=False):
+                 deterministic=False,
+                 adaptive=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay,
-                         diameter_shift, check_dist, max_diameter)
+                         diameter_shift, check_dist, max_diameter, adaptive)
 
         params = ParameterDict(deterministic=bool(deterministic),
                                cell_width=float(cell_width))
@@ -271,6 +374,8 @@ class Tree(NList):
         check_dist (bool): Flag to enable / disable distance checking.
         max_diameter (float): The maximum diameter a particle will achieve
             :math:`[\\mathrm{length}]`.
+        adaptive (bool): Flag to enable / disable the adaptive mode, see more
+            details in `NList`.
 
     `Tree` creates a neighbor list using a bounding volume hierarchy (BVH) tree
     traversal. A BVH tree of axis-aligned bounding boxes is constructed per
@@ -300,10 +405,11 @@ class Tree(NList):
                  rebuild_check_delay=1,
                  diameter_shift=False,
                  check_dist=True,
-                 max_diameter=1.0):
+                 max_diameter=1.0,
+                 adaptive=False):
 
         super().__init__(buffer, exclusions, rebuild_check_delay,
-                         diameter_shift, check_dist, max_diameter)
+                         diameter_shift, check_dist, max_diameter, adaptive)
 
     def _attach(self):
         if isinstance(self._simulation.device, hoomd.device.CPU):
@@ -11,3 +11,4 @@ from .pair import (Pair, LJ, Gauss, SLJ, ExpandedLJ, Yukawa, Ewald, Morse, DPD,
                    DPDConservative, DPDLJ, ForceShiftedLJ, Moliere, ZBL, Mie,
                    ExpandedMie, ReactionField, DLVO, Buckingham, LJ1208, LJ0804,
                    Fourier, OPP, Table, TWF)
+from .fused import Fused
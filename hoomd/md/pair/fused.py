@@ -0,0 +1,108 @@
+# Copyright (c) 2009-2022 The Regents of the University of Michigan.
+# Part of HOOMD-blue, released under the BSD 3-Clause License.
+
+"""Evaluate several pair potentials in one neighbor list traversal."""
+
+import hoomd
+from hoomd.md import _md
+from hoomd.md import force
+from hoomd.md.pair.pair import Pair
+from hoomd.md.pair.aniso import AnisotropicPair
+
+
+class Fused(force.Force):
+    r"""Sum of pair potentials evaluated in one pass over the neighbor list.
+
+    Args:
+        potentials (list[hoomd.md.pair.Pair]): Pair potentials to evaluate. All
+            potentials must use the same neighbor list.
+
+    `Fused` computes the sum of the forces, energies, and virials of several
+    pair potentials that share a neighbor list. Evaluating the potentials
+    separately loads every neighbor and computes every pair separation once
+    per potential. `Fused` visits each pair once and evaluates all of the
+    potentials on it, which reduces the memory traffic when a simulation
+    combines several pair interactions (for example `LJ`, `Yukawa`, and
+    `DPD`).
+
+    Add the `Fused` force to the integrator *instead of* the individual
+    potentials. Set the parameters, cutoffs, and energy shifting modes on the
+    individual potentials as usual. Their loggable quantities remain available
+    and are computed on demand.
+
+    Note:
+        `Fused` is only available on the CPU. Anisotropic pair potentials
+        cannot be fused.
+
+    Example::
+
+        nl = nlist.Cell(buffer=0.4)
+        lj = pair.LJ(nlist=nl, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        yukawa = pair.Yukawa(nlist=nl, default_r_cut=3.0)
+        yukawa.params[('A', 'A')] = dict(epsilon=1.0, kappa=1.0)
+        fused = pair.Fused([lj, yukawa])
+        integrator.forces.append(fused)
+    """
+
+    def __init__(self, potentials):
+        super().__init__()
+        potentials = list(potentials)
+        if len(potentials) == 0:
+            raise ValueError("Fused requires at least one pair potential.")
+        for potential in potentials:
+            if (not isinstance(potential, Pair)
+                    or isinstance(potential, AnisotropicPair)):
+                raise TypeError(f"{potential} cannot be fused.")
+        nlist = potentials[0].nlist
+        if any(potential.nlist is not nlist for potential in potentials):
+            raise ValueError(
+                "Fused pair potentials must all use the same neighbor list.")
+        self._potentials = potentials
+
+    @property
+    def potentials(self):
+        """list[hoomd.md.pair.Pair]: The fused pair potentials (read only)."""
+        return list(self._potentials)
+
+    @property
+    def nlist(self):
+        """hoomd.md.nlist.NList: Neighbor list shared by the potentials."""
+        return self._potentials[0].nlist
+
+    def _add(self, simulation):
+        super()._add(simulation)
+        for potential in self._potentials:
+            potential._add(simulation)
+
+    def _attach(self):
+        if not isinstance(self._simulation.device, hoomd.device.CPU):
+            raise RuntimeError("Fused pair potentials require a CPU device.")
+
+        for potential in self._potentials:
+            if not potential._attached:
+                potential._attach()
+
+        self._cpp_obj = _md.PotentialPairFused(
+            self._simulation.state._cpp_sys_def, self.nlist._cpp_obj)
+        for potential in self._potentials:
+            self._cpp_obj.addPotential(potential._cpp_obj)
+
+        super()._attach()
+
+    def _detach(self):
+        for potential in self._potentials:
+            potential._detach()
+        super()._detach()
+
+    def _remove(self):
+        for potential in self._potentials:
+            potential._remove()
+        super()._remove()
+
+    @property
+    def _children(self):
+        children = [self.nlist]
+        for potential in self._potentials:
+            children.append(potential)
+        return children
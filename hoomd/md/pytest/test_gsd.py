@@ -393,3 +393,102 @@ def test_write_gsd_log(create_md_sim, tmp_path):
                 e = traj[s].log[
                     'md/compute/ThermodynamicQuantities/kinetic_energy']
                 assert e == kinetic_energy_list[s]
+
+
+@pytest.mark.parametrize('queue_depth', [1, 3])
+def test_write_gsd_async(create_md_sim, tmp_path, queue_depth):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    sim = create_md_sim
+    thermo = hoomd.md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    logger = hoomd.logging.Logger()
+    logger.add(thermo, quantities=['kinetic_energy'])
+
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=['property', 'momentum'],
+                                 log=logger,
+                                 async_write=True,
+                                 queue_depth=queue_depth)
+    sim.operations.writers.append(gsd_writer)
+    assert gsd_writer.async_write
+    assert gsd_writer.queue_depth == queue_depth
+
+    kinetic_energy_list = []
+    position_list = []
+    for _ in range(5):
+        sim.run(1)
+        kinetic_energy_list.append(thermo.kinetic_energy)
+        snap = sim.state.get_snapshot()
+        if snap.communicator.rank == 0:
+            position_list.append(np.array(snap.particles.position))
+
+    # all frames are on disk when run() returns
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='rb') as traj:
+            assert len(traj) == 5
+            for s in range(5):
+                e = traj[s].log[
+                    'md/compute/ThermodynamicQuantities/kinetic_energy']
+                assert e == kinetic_energy_list[s]
+                np.testing.assert_allclose(traj[s].particles.position,
+                                           position_list[s])
+
+
+def test_write_gsd_mpi_io(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+    filename_mpi_io = tmp_path / "temporary_test_file_mpi_io.gsd"
+
+    sim = create_md_sim
+    dynamic = ['property', 'momentum', 'attribute']
+    gsd_writer = hoomd.write.GSD(filename=filename,
+                                 trigger=hoomd.trigger.Periodic(1),
+                                 mode='wb',
+                                 dynamic=dynamic)
+    gsd_writer_mpi_io = hoomd.write.GSD(filename=filename_mpi_io,
+                                        trigger=hoomd.trigger.Periodic(1),
+                                        mode='wb',
+                                        dynamic=dynamic,
+                                        mpi_io=True,
+                                        mpi_io_writers=1)
+    sim.operations.writers.append(gsd_writer)
+    sim.operations.writers.append(gsd_writer_mpi_io)
+    assert gsd_writer_mpi_io.mpi_io
+    assert gsd_writer_mpi_io.mpi_io_writers == 1
+
+    sim.run(3)
+
+    if sim.device.communicator.rank == 0:
+        with gsd.hoomd.open(name=filename, mode='rb') as traj, \
+                gsd.hoomd.open(name=filename_mpi_io, mode='rb') as traj_mpi_io:
+            assert len(traj) == len(traj_mpi_io) == 3
+            for frame, frame_mpi_io in zip(traj, traj_mpi_io):
+                assert (frame.configuration.step
+                        == frame_mpi_io.configuration.step)
+                for attr in ['N', 'types', 'typeid', 'mass', 'charge',
+                             'diameter', 'body', 'moment_inertia',
+                             'position', 'orientation', 'velocity', 'angmom',
+                             'image']:
+                    np.testing.assert_array_equal(
+                        getattr(frame.particles, attr),
+                        getattr(frame_mpi_io.particles, attr))
+                assert frame.bonds.N == frame_mpi_io.bonds.N
+
+
+def test_write_gsd_mpi_io_async(create_md_sim, tmp_path):
+
+    filename = tmp_path / "temporary_test_file.gsd"
+
+    with pytest.raises(ValueError):
+        gsd_writer = hoomd.write.GSD(filename=filename,
+                                     trigger=hoomd.trigger.Periodic(1),
+                                     mode='wb',
+                                     async_write=True,
+                                     mpi_io=True)
+        create_md_sim.operations.writers.append(gsd_writer)
+        create_md_sim.run(0)
@@ -1,6 +1,7 @@
 # Copyright (c) 2009-2022 The Regents of the University of Michigan.
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
+import numpy
 import pytest
 
 import hoomd
@@ -51,3 +52,235 @@ def test_detaching(make_simulation, methods, forces):
     assert not integrator._forces._synced
     assert not integrator._methods._synced
     assert not integrator._contraints._synced
+
+
+class ConstantForce(md.force.Custom):
+    """Apply a constant force in x and count the evaluations."""
+
+    def __init__(self):
+        super().__init__()
+        self.n_evaluations = 0
+
+    def set_forces(self, timestep):
+        self.n_evaluations += 1
+        with self.cpu_local_force_arrays as arrays:
+            arrays.force[:] = [1.0, 0, 0]
+
+
+def test_slow_forces_attach(simulation_factory, two_particle_snapshot_factory):
+    nlist = md.nlist.Cell(buffer=0.4)
+    lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+    gauss = md.pair.Gauss(nlist, default_r_cut=3.0)
+    gauss.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+
+    nve = md.methods.NVE(hoomd.filter.All())
+    integrator = hoomd.md.Integrator(0.005,
+                                     methods=[nve],
+                                     forces=[lj],
+                                     slow_forces=[gauss],
+                                     slow_interval=2)
+    assert integrator.slow_interval == 2
+    assert list(integrator.slow_forces) == [gauss]
+
+    sim = simulation_factory(two_particle_snapshot_factory())
+    sim.operations.integrator = integrator
+    sim.run(0)
+
+    assert integrator._slow_forces._synced
+    assert gauss._attached
+    assert integrator.slow_interval == 2
+
+    integrator.slow_interval = 4
+    assert integrator.slow_interval == 4
+
+    with pytest.raises(ValueError):
+        integrator.slow_interval = 0
+
+    sim.operations._unschedule()
+    assert not integrator._slow_forces._synced
+
+
+def test_slow_interval_one(simulation_factory, two_particle_snapshot_factory):
+    """Slow forces with slow_interval=1 are equivalent to forces."""
+    positions = []
+    for slow in (False, True):
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+
+        forces = dict(slow_forces=[lj]) if slow else dict(forces=[lj])
+        integrator = hoomd.md.Integrator(
+            0.005, methods=[md.methods.NVE(hoomd.filter.All())], **forces)
+
+        sim = simulation_factory(two_particle_snapshot_factory(d=1.1))
+        sim.operations.integrator = integrator
+        sim.run(20)
+
+        snapshot = sim.state.get_snapshot()
+        if snapshot.communicator.rank == 0:
+            positions.append(snapshot.particles.position.copy())
+
+    if len(positions) == 2:
+        numpy.testing.assert_allclose(positions[0], positions[1])
+
+
+def test_slow_forces_impulse(simulation_factory,
+                             two_particle_snapshot_factory):
+    """Slow forces apply the full impulse at a fraction of the evaluations."""
+    sim = simulation_factory(two_particle_snapshot_factory())
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("ConstantForce sets the forces on the CPU.")
+
+    force = ConstantForce()
+    integrator = hoomd.md.Integrator(
+        0.005,
+        methods=[md.methods.NVE(hoomd.filter.All())],
+        slow_forces=[force],
+        slow_interval=2)
+    sim.operations.integrator = integrator
+
+    sim.run(10)
+
+    # evaluated on steps 0, 2, 4, 6, 8, and 10
+    assert force.n_evaluations == 6
+
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        numpy.testing.assert_allclose(snapshot.particles.velocity[:, 0],
+                                      [10 * 0.005, 10 * 0.005])
+
+
+def test_slow_forces_off_boundary(simulation_factory,
+                                  two_particle_snapshot_factory):
+    """A run that starts between outer steps applies the shorter impulse."""
+    sim = simulation_factory()
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("ConstantForce sets the forces on the CPU.")
+
+    sim.timestep = 1
+    sim.create_state_from_snapshot(two_particle_snapshot_factory())
+
+    force = ConstantForce()
+    integrator = hoomd.md.Integrator(
+        0.005,
+        methods=[md.methods.NVE(hoomd.filter.All())],
+        slow_forces=[force],
+        slow_interval=2)
+    sim.operations.integrator = integrator
+
+    sim.run(9)
+
+    # evaluated for the first step and on steps 2, 4, 6, 8, and 10
+    assert force.n_evaluations == 6
+
+    snapshot = sim.state.get_snapshot()
+    if snapshot.communicator.rank == 0:
+        numpy.testing.assert_allclose(snapshot.particles.velocity[:, 0],
+                                      [9 * 0.005, 9 * 0.005])
+
+
+def test_slow_forces_energy(simulation_factory, device):
+    """r-RESPA conserves the energy of charged dimers with slow PPPM forces."""
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        # 5x5x5 dimers with opposite charges, bonded along x
+        centers = [(x, y, z)
+                   for x in numpy.arange(-4, 6, 2)
+                   for y in numpy.arange(-4, 6, 2)
+                   for z in numpy.arange(-4, 6, 2)]
+        n_dimers = len(centers)
+        snapshot.configuration.box = [10, 10, 10, 0, 0, 0]
+        snapshot.particles.N = 2 * n_dimers
+        snapshot.particles.types = ['A']
+        snapshot.particles.position[:] = [
+            (x + dx, y, z) for x, y, z in centers for dx in (-0.5, 0.5)
+        ]
+        snapshot.particles.charge[:] = [0.5, -0.5] * n_dimers
+        snapshot.bonds.N = n_dimers
+        snapshot.bonds.types = ['A-A']
+        snapshot.bonds.group[:] = [(2 * i, 2 * i + 1) for i in range(n_dimers)]
+
+    sim = simulation_factory(snapshot)
+    sim.state.thermalize_particle_momenta(filter=hoomd.filter.All(), kT=1.0)
+
+    nlist = md.nlist.Cell(buffer=0.4, exclusions=('bond',))
+    lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+    lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+    harmonic = md.bond.Harmonic()
+    harmonic.params['A-A'] = dict(k=100.0, r0=1.0)
+    ewald, coulomb = md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(16, 16, 16), order=5, r_cut=3.0, alpha=0)
+
+    integrator = hoomd.md.Integrator(
+        0.002,
+        methods=[md.methods.NVE(hoomd.filter.All())],
+        forces=[lj, harmonic, ewald],
+        slow_forces=[coulomb],
+        slow_interval=2)
+    sim.operations.integrator = integrator
+    thermo = md.compute.ThermodynamicQuantities(filter=hoomd.filter.All())
+    sim.operations.computes.append(thermo)
+
+    # the potential energy includes the slow forces on the outer steps
+    energies = []
+    for _ in range(100):
+        sim.run(integrator.slow_interval * 5)
+        energies.append(thermo.kinetic_energy + thermo.potential_energy)
+
+    numpy.testing.assert_allclose(energies,
+                                  energies[0],
+                                  atol=0.01 * sim.state.N_particles)
+
+
+def test_force_timing(simulation_factory, lattice_snapshot_factory, device):
+    """Forces computed in parallel tasks sum to the same net force."""
+    if not hoomd.version.tbb_enabled:
+        pytest.skip("HOOMD was compiled without TBB.")
+    if not isinstance(device, hoomd.device.CPU):
+        pytest.skip("CPU threads only apply to CPU devices.")
+
+    net_forces = []
+    for num_cpu_threads in (1, 4):
+        sim = simulation_factory(lattice_snapshot_factory(n=4, a=1.2))
+        nlist = md.nlist.Cell(buffer=0.4)
+        lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+        gauss = md.pair.Gauss(nlist=md.nlist.Cell(buffer=0.2),
+                              default_r_cut=3.0)
+        gauss.params[("A", "A")] = {"epsilon": 1.0, "sigma": 1.0}
+        yukawa = md.pair.Yukawa(nlist=nlist, default_r_cut=3.0)
+        yukawa.params[("A", "A")] = {"epsilon": 1.0, "kappa": 1.0}
+        forces = [lj, gauss, yukawa]
+
+        integrator = hoomd.md.Integrator(
+            0.005, methods=[md.methods.NVE(hoomd.filter.All())], forces=forces)
+        sim.operations.integrator = integrator
+
+        old_num_cpu_threads = device.num_cpu_threads
+        try:
+            device.num_cpu_threads = num_cpu_threads
+            sim.run(5)
+        finally:
+            device.num_cpu_threads = old_num_cpu_threads
+
+        assert integrator.net_force_time >= 0
+        for force in forces:
+            assert force.compute_time >= 0
+
+        if sim.device.communicator.num_ranks > 1:
+            continue
+
+        total = sum(force.forces for force in forces)
+        with sim.state.cpu_local_snapshot as snapshot:
+            net_force = numpy.array(snapshot.particles.net_force)
+            tags = numpy.array(snapshot.particles.tag)
+        numpy.testing.assert_allclose(net_force,
+                                      total[tags],
+                                      rtol=1e-5,
+                                      atol=1e-5)
+        net_forces.append(net_force[numpy.argsort(tags)])
+
+    # the net force sums the forces in the order of integrator.forces
+    if len(net_forces) == 2:
+        numpy.testing.assert_array_equal(net_forces[0], net_forces[1])
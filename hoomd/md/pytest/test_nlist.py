@@ -7,7 +7,7 @@ from hoomd.logging import LoggerCategories
 import numpy as np
 import pytest
 import random
-from hoomd.md.nlist import Cell, Stencil, Tree
+from hoomd.md.nlist import Cell, Cluster, Stencil, Tree
 from hoomd.conftest import logging_check, pickling_check
 
 
@@ -15,6 +15,7 @@ def _nlist_params():
     """Each entry in the lsit is a tuple (class_obj, dict(required_args))."""
     nlists = []
     nlists.append((Cell, {}))
+    nlists.append((Cluster, {}))
     nlists.append((Tree, {}))
     nlists.append((Stencil, dict(cell_width=0.5)))
     return nlists
@@ -47,7 +48,8 @@ def test_common_params(nlist_params):
         "rebuild_check_delay": 1,
         "diameter_shift": False,
         "check_dist": True,
-        "max_diameter": 1.0
+        "max_diameter": 1.0,
+        "adaptive": False
     }
     _assert_nlist_params(nlist, default_params_dict)
     new_params_dict = {
@@ -65,7 +67,9 @@ def test_common_params(nlist_params):
         "check_dist":
             False,
         "max_diameter":
-            np.random.uniform(10.3)
+            np.random.uniform(10.3),
+        "adaptive":
+            True
     }
     for param in new_params_dict.keys():
         setattr(nlist, param, new_params_dict[param])
@@ -108,6 +112,86 @@ def test_simple_simulation(nlist_params, simulation_factory,
     sim.run(2)
 
 
+def test_adaptive_simulation(nlist_params, simulation_factory,
+                             lattice_snapshot_factory):
+    nlist_cls, required_args = nlist_params
+    nlist = nlist_cls(**required_args, buffer=0.4, adaptive=True)
+    lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5)
+    lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+    integrator = hoomd.md.Integrator(0.005)
+    integrator.forces.append(lj)
+    integrator.methods.append(
+        hoomd.md.methods.Langevin(hoomd.filter.All(), kT=1.5))
+
+    sim = simulation_factory(
+        lattice_snapshot_factory(particle_types=['A'], n=8, a=1.2))
+    sim.operations.integrator = integrator
+    sim.run(500)
+
+    assert nlist.adaptive
+    assert 0.1 <= nlist.buffer <= 0.8
+    assert nlist.shortest_rebuild >= 1
+    assert nlist.dangerous_builds == 0
+
+    # the adaptive mode must have either tuned the buffer or skipped checks
+    assert nlist.buffer != 0.4 or nlist._cpp_obj.getNumSkippedChecks() > 0
+
+
+@pytest.mark.serial
+@pytest.mark.parametrize("storage_mode", ['half', 'full'])
+def test_cluster_forces(storage_mode, simulation_factory,
+                        lattice_snapshot_factory):
+    """Cluster pair forces match the per particle path of Cell."""
+    # the lattice fills the box, so many pairs interact across the periodic
+    # boundaries
+    snap = lattice_snapshot_factory(particle_types=['A', 'B'],
+                                    n=7,
+                                    a=1.1,
+                                    r=0.1)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = np.random.randint(0, 2, snap.particles.N)
+    sim = simulation_factory(snap)
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("Cluster falls back to the binned list on the GPU.")
+
+    # LJ evaluates cluster pairs in batches unless mode is 'xplor', and the
+    # serial run never splits the particles into interior and boundary sets
+    potentials = []
+    for nlist in (Cell(buffer=0.4), Cluster(buffer=0.4)):
+        lj = hoomd.md.pair.LJ(nlist, default_r_cut=2.5, mode='shift')
+        lj.params[('A', 'A')] = dict(epsilon=1, sigma=1)
+        lj.params[('A', 'B')] = dict(epsilon=1.5, sigma=0.9)
+        lj.params[('B', 'B')] = dict(epsilon=0.5, sigma=1.1)
+        lj.r_cut[('A', 'B')] = 2.0
+        lj.r_cut[('B', 'B')] = 1.5
+        potentials.append(lj)
+
+    # an integrator without methods keeps the particles in place
+    integrator = hoomd.md.Integrator(dt=0.005, forces=potentials)
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+    for lj in potentials:
+        lj.nlist._cpp_obj.setStorageMode(
+            getattr(hoomd.md._md.NeighborList.storageMode, storage_mode))
+    sim.run(1)
+
+    cell_lj, cluster_lj = potentials
+    np.testing.assert_allclose(cluster_lj.forces,
+                               cell_lj.forces,
+                               rtol=1e-6,
+                               atol=1e-10)
+    np.testing.assert_allclose(cluster_lj.energies,
+                               cell_lj.energies,
+                               rtol=1e-6,
+                               atol=1e-10)
+    np.testing.assert_allclose(cluster_lj.virials,
+                               cell_lj.virials,
+                               rtol=1e-6,
+                               atol=1e-10)
+    assert np.count_nonzero(cell_lj.energies) == snap.particles.N
+
+
 def test_auto_detach_simulation(simulation_factory,
                                 two_particle_snapshot_factory):
     nlist = Cell(buffer=0.4)
@@ -156,5 +240,9 @@ def test_logging():
         'shortest_rebuild': {
             'category': LoggerCategories.scalar,
             'default': True
+        },
+        'dangerous_builds': {
+            'category': LoggerCategories.scalar,
+            'default': True
         }
     })
@@ -745,6 +745,178 @@ def test_run(simulation_factory, lattice_snapshot_factory, valid_params):
                                old_snap.particles.position)
 
 
+@pytest.mark.parametrize("storage_mode", ['half', 'full'])
+def test_threaded_forces(simulation_factory, lattice_snapshot_factory,
+                         valid_params, storage_mode):
+    """Forces computed with multiple CPU threads match the serial result."""
+    if not hoomd.version.tbb_enabled:
+        pytest.skip("HOOMD was compiled without TBB.")
+
+    if issubclass(valid_params.pair_potential, hoomd.md.many_body.Triplet):
+        pytest.skip("Triplet potentials do not use PotentialPair.")
+
+    pot_name = valid_params.pair_potential.__name__
+    if any(pot_name == name for name in ["DPD", "DPDLJ"]):
+        pytest.skip("Random forces differ between time steps for " + pot_name)
+
+    pair_keys = valid_params.pair_potential_params.keys()
+    particle_types = list(set(itertools.chain.from_iterable(pair_keys)))
+    nlist = md.nlist.Cell(buffer=0.4)
+    pot = valid_params.pair_potential(**valid_params.extra_args,
+                                      nlist=nlist,
+                                      default_r_cut=2.5)
+    pot.params = valid_params.pair_potential_params
+
+    snap = lattice_snapshot_factory(particle_types=particle_types,
+                                    n=7,
+                                    a=1.7,
+                                    r=0.01)
+    _update_snap(valid_params.pair_potential, snap)
+    if snap.communicator.rank == 0:
+        snap.particles.typeid[:] = np.random.randint(0,
+                                                     len(snap.particles.types),
+                                                     snap.particles.N)
+    sim = simulation_factory(snap)
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("CPU threads only apply to CPU devices.")
+
+    # an integrator without methods keeps the particles in place
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.append(pot)
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+    nlist._cpp_obj.setStorageMode(
+        getattr(hoomd.md._md.NeighborList.storageMode, storage_mode))
+
+    num_cpu_threads = sim.device.num_cpu_threads
+    try:
+        sim.device.num_cpu_threads = 1
+        sim.run(1)
+        serial_forces = pot.forces
+        serial_energies = pot.energies
+        serial_virials = pot.virials
+
+        sim.device.num_cpu_threads = 4
+        sim.run(1)
+        if sim.device.communicator.rank == 0:
+            np.testing.assert_allclose(pot.forces,
+                                       serial_forces,
+                                       rtol=1e-6,
+                                       atol=1e-10)
+            np.testing.assert_allclose(pot.energies,
+                                       serial_energies,
+                                       rtol=1e-6,
+                                       atol=1e-10)
+            np.testing.assert_allclose(pot.virials,
+                                       serial_virials,
+                                       rtol=1e-6,
+                                       atol=1e-10)
+    finally:
+        sim.device.num_cpu_threads = num_cpu_threads
+
+
+def test_fused_forces(simulation_factory, lattice_snapshot_factory):
+    """Fused pair potentials match the sum of the separate potentials."""
+    nlist = md.nlist.Cell(buffer=0.4)
+    lj = md.pair.LJ(nlist=nlist, default_r_cut=2.5, mode='xplor')
+    lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+    lj.r_on[('A', 'A')] = 2.0
+    yukawa = md.pair.Yukawa(nlist=nlist, default_r_cut=3.0, mode='shift')
+    yukawa.params[('A', 'A')] = dict(epsilon=0.5, kappa=1.0)
+    gauss = md.pair.Gauss(nlist=nlist, default_r_cut=2.0)
+    gauss.params[('A', 'A')] = dict(epsilon=1.0, sigma=0.8)
+    potentials = [lj, yukawa, gauss]
+    fused = md.pair.Fused(potentials)
+
+    snap = lattice_snapshot_factory(n=7, a=1.4, r=0.05)
+    sim = simulation_factory(snap)
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("Fused pair potentials are only available on the CPU.")
+
+    integrator = hoomd.md.Integrator(dt=0.005)
+    integrator.forces.append(fused)
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    # query every potential on all ranks, the arrays are gathered to rank 0
+    fused_arrays = (fused.forces, fused.energies, fused.virials)
+    separate_arrays = [(p.forces, p.energies, p.virials) for p in potentials]
+    if sim.device.communicator.rank == 0:
+        for k in range(3):
+            np.testing.assert_allclose(fused_arrays[k],
+                                       sum(arrays[k]
+                                           for arrays in separate_arrays),
+                                       rtol=1e-6,
+                                       atol=1e-10)
+
+    with pytest.raises(ValueError):
+        md.pair.Fused([lj, md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4))])
+
+
+
+def test_overlapped_forces(simulation_factory, lattice_snapshot_factory):
+    """Forces computed during the ghost update match a full computation."""
+    sim = simulation_factory(lattice_snapshot_factory(n=10, a=1.5, r=0.05))
+    if sim.device.communicator.num_ranks < 2:
+        pytest.skip("Interior forces require domain decomposition.")
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("Interior forces are only computed on the CPU.")
+
+    def make_lj():
+        lj = md.pair.LJ(nlist=md.nlist.Cell(buffer=0.4), default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        return lj
+
+    lj = make_lj()
+    integrator = md.Integrator(dt=0.001,
+                               forces=[lj],
+                               methods=[md.methods.NVE(hoomd.filter.All())])
+    sim.operations.integrator = integrator
+    sim.always_compute_pressure = True
+    sim.run(0)
+
+    # the particles barely move, so the neighbor list is rarely rebuilt and
+    # most steps reuse the interior forces
+    for _ in range(20):
+        n_overlapped = lj._cpp_obj.getNumOverlappedComputes()
+        sim.run(1)
+        if lj._cpp_obj.getNumOverlappedComputes() > n_overlapped:
+            break
+    assert lj._cpp_obj.getNumOverlappedComputes() > n_overlapped
+
+    forces = lj.forces
+    energies = lj.energies
+    virials = lj.virials
+
+    # the first force computation of a new simulation follows a migration,
+    # which computes all particles at once
+    reference_lj = make_lj()
+    reference_sim = simulation_factory(sim.state.get_snapshot())
+    reference_sim.operations.integrator = md.Integrator(dt=0.001,
+                                                        forces=[reference_lj])
+    reference_sim.always_compute_pressure = True
+    reference_sim.run(0)
+    assert reference_lj._cpp_obj.getNumOverlappedComputes() == 0
+    reference_forces = reference_lj.forces
+    reference_energies = reference_lj.energies
+    reference_virials = reference_lj.virials
+
+    if sim.device.communicator.rank == 0:
+        np.testing.assert_allclose(forces,
+                                   reference_forces,
+                                   rtol=1e-6,
+                                   atol=1e-10)
+        np.testing.assert_allclose(energies,
+                                   reference_energies,
+                                   rtol=1e-6,
+                                   atol=1e-10)
+        np.testing.assert_allclose(virials,
+                                   reference_virials,
+                                   rtol=1e-6,
+                                   atol=1e-10)
+
 def test_energy_shifting(simulation_factory, two_particle_snapshot_factory):
     # A subtle bug existed where we used "shifted" instead of "shift" in Python
     # and in C++ we used else if clauses with no error raised if the set Python
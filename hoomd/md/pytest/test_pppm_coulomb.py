@@ -51,6 +51,7 @@ def test_attach_detach(simulation_factory,
     assert coulomb.order == 6
     assert coulomb.r_cut == 3.0
     assert coulomb.alpha == 0
+    assert coulomb.differentiation == 'ik'
 
     nlist2 = hoomd.md.nlist.Tree(buffer=0.4)
     coulomb.nlist = nlist2
@@ -69,6 +70,13 @@ def test_attach_detach(simulation_factory,
     coulomb.alpha = 1.5
     assert coulomb.alpha == 1.5
 
+    coulomb.differentiation = 'ad'
+    assert coulomb.differentiation == 'ad'
+    coulomb.differentiation = 'ik'
+
+    with pytest.raises(ValueError):
+        coulomb.differentiation = 'fd'
+
     # attached
     sim = simulation_factory(two_charged_particle_snapshot_factory())
     integrator = hoomd.md.Integrator(dt=0.005)
@@ -86,6 +94,7 @@ def test_attach_detach(simulation_factory,
     assert coulomb.order == 4
     assert coulomb.r_cut == 2.5
     assert coulomb.alpha == 1.5
+    assert coulomb.differentiation == 'ik'
 
     assert ewald.params[('A', 'A')]['alpha'] == 1.5
 
@@ -97,6 +106,8 @@ def test_attach_detach(simulation_factory,
         coulomb.r_cut = 4.5
     with pytest.raises(AttributeError):
         coulomb.alpha = 3.0
+    with pytest.raises(AttributeError):
+        coulomb.differentiation = 'ad'
 
 
 def test_pickling(simulation_factory, two_charged_particle_snapshot_factory):
@@ -143,3 +154,40 @@ def test_pppm_energy(simulation_factory, two_charged_particle_snapshot_factory):
     # The reference energy is from a LAMMPS simulation. The tolerance is large
     # as the PPPM parameters do not directly map between the two codes
     numpy.testing.assert_allclose(energy, -1.0021254, rtol=1e-2)
+
+
+def test_pppm_ad(simulation_factory, two_charged_particle_snapshot_factory):
+    """Test the analytical differentiation scheme of md.long_range.pppm."""
+    sim = simulation_factory(two_charged_particle_snapshot_factory())
+    if isinstance(sim.device, hoomd.device.GPU):
+        pytest.skip("Analytical differentiation is not supported on the GPU")
+
+    nlist = hoomd.md.nlist.Cell(buffer=0.4)
+    ewald_ik, coulomb_ik = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist, resolution=(64, 64, 64), order=6, r_cut=3.0, alpha=0)
+    ewald_ad, coulomb_ad = hoomd.md.long_range.pppm.make_pppm_coulomb_forces(
+        nlist=nlist,
+        resolution=(64, 64, 64),
+        order=6,
+        r_cut=3.0,
+        alpha=0,
+        differentiation='ad')
+
+    integrator = hoomd.md.Integrator(dt=0.005)
+    nve = hoomd.md.methods.NVE(filter=hoomd.filter.All())
+    integrator.methods.append(nve)
+    integrator.forces.extend([coulomb_ik, ewald_ad, coulomb_ad])
+    sim.operations.integrator = integrator
+
+    sim.run(0)
+
+    assert coulomb_ad.differentiation == 'ad'
+
+    energy = ewald_ad.energy + coulomb_ad.energy
+    numpy.testing.assert_allclose(energy, -1.0021254, rtol=1e-2)
+
+    # both schemes approximate the same reciprocal space forces
+    forces_ik = coulomb_ik.forces
+    forces_ad = coulomb_ad.forces
+    if sim.device.communicator.rank == 0:
+        numpy.testing.assert_allclose(forces_ad, forces_ik, atol=1e-3)
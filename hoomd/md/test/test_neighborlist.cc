@@ -12,6 +12,7 @@
 #include "hoomd/Initializers.h"
 #include "hoomd/md/NeighborList.h"
 #include "hoomd/md/NeighborListBinned.h"
+#include "hoomd/md/NeighborListCluster.h"
 #include "hoomd/md/NeighborListStencil.h"
 #include "hoomd/md/NeighborListTree.h"
 
@@ -1934,6 +1935,85 @@ UP_TEST(NeighborListTree_comparison)
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+////////////////////
+// CLUSTER CPU
+////////////////////
+//! basic test case for cluster class
+UP_TEST(NeighborListCluster_basic)
+    {
+    neighborlist_basic_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! exclusion test case for cluster class
+UP_TEST(NeighborListCluster_exclusion)
+    {
+    neighborlist_exclusion_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! large exclusion test case for cluster class
+UP_TEST(NeighborListCluster_large_ex)
+    {
+    neighborlist_large_ex_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! body filter test case for cluster class
+UP_TEST(NeighborListCluster_body_filter)
+    {
+    neighborlist_body_filter_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! diameter filter test case for cluster class
+UP_TEST(NeighborListCluster_diameter_shift)
+    {
+    neighborlist_diameter_shift_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! diameter filter test case for cluster class with periodic boundary conditions
+UP_TEST(NeighborListCluster_diameter_shift_periodic)
+    {
+    neighborlist_diameter_shift_periodic_tests<NeighborListCluster>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! particle asymmetry test case for cluster class
+UP_TEST(NeighborListCluster_particle_asymm)
+    {
+    neighborlist_particle_asymm_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! cutoff exclusion test case for cluster class
+UP_TEST(NeighborListCluster_cutoff_exclude)
+    {
+    neighborlist_cutoff_exclude_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! type test case for cluster class
+UP_TEST(NeighborListCluster_type)
+    {
+    neighborlist_type_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! 2d tests for cluster class
+UP_TEST(NeighborListCluster_2d)
+    {
+    neighborlist_2d_tests<NeighborListCluster>(std::shared_ptr<ExecutionConfiguration>(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! comparison test case for cluster class
+UP_TEST(NeighborListCluster_comparison)
+    {
+    neighborlist_comparison_test<NeighborListBinned, NeighborListCluster>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+//! reverse comparison test case for cluster class (the lists must be identical)
+UP_TEST(NeighborListCluster_comparison_reverse)
+    {
+    neighborlist_comparison_test<NeighborListCluster, NeighborListBinned>(
+        std::shared_ptr<ExecutionConfiguration>(
+            new ExecutionConfiguration(ExecutionConfiguration::CPU)));
+    }
+
 #ifdef ENABLE_HIP
 ///////////////
 // BINNED GPU
@@ -20,6 +20,7 @@
 #include "hoomd/md/NeighborListTree.h"
 
 #include <math.h>
+#include <vector>
 
 using namespace std;
 using namespace std::placeholders;
@@ -259,6 +260,58 @@ UP_TEST(PPPMForceCompute_triclinic)
             new ExecutionConfiguration(ExecutionConfiguration::CPU)));
     }
 
+//! Compare the real to complex local FFT with the complex to complex KISS FFT
+void local_fft_test(uint3 dim)
+    {
+    std::unique_ptr<detail::LocalFFT> fft = detail::makeLocalFFT(dim);
+    unsigned int n = dim.x * dim.y * dim.z;
+    unsigned int nxh = fft->getHalfDimX();
+    UP_ASSERT_EQUAL(fft->getNHalf(), nxh * dim.y * dim.z);
+
+    std::vector<kiss_fft_scalar> rho(n);
+    std::vector<kiss_fft_cpx> rho_cpx(n);
+    for (unsigned int i = 0; i < n; ++i)
+        {
+        rho[i] = kiss_fft_scalar(sin(0.7 * i) + 0.1 * (i % 3));
+        rho_cpx[i].r = rho[i];
+        rho_cpx[i].i = 0;
+        }
+
+    // reference transform
+    int dims[3] = {int(dim.z), int(dim.y), int(dim.x)};
+    kiss_fftnd_cfg cfg = kiss_fftnd_alloc(dims, 3, 0, NULL, NULL);
+    std::vector<kiss_fft_cpx> ref(n);
+    kiss_fftnd(cfg, rho_cpx.data(), ref.data());
+    kiss_fft_free(cfg);
+
+    std::vector<kiss_fft_cpx> half(fft->getNHalf());
+    fft->forward(rho.data(), half.data());
+
+    for (unsigned int z = 0; z < dim.z; ++z)
+        for (unsigned int y = 0; y < dim.y; ++y)
+            for (unsigned int x = 0; x < nxh; ++x)
+                {
+                kiss_fft_cpx a = half[x + nxh * (y + dim.y * z)];
+                kiss_fft_cpx b = ref[x + dim.x * (y + dim.y * z)];
+                MY_CHECK_SMALL(a.r - b.r, tol_small);
+                MY_CHECK_SMALL(a.i - b.i, tol_small);
+                }
+
+    // the inverse transform is not normalized
+    std::vector<kiss_fft_scalar> rho_back(n);
+    fft->inverse(half.data(), rho_back.data());
+    for (unsigned int i = 0; i < n; ++i)
+        MY_CHECK_SMALL(rho_back[i] / kiss_fft_scalar(n) - rho[i], tol_small);
+    }
+
+//! test the local FFT on even and odd meshes
+UP_TEST(LocalFFT_transform)
+    {
+    local_fft_test(make_uint3(8, 8, 8));
+    local_fft_test(make_uint3(7, 5, 3));
+    local_fft_test(make_uint3(10, 1, 6));
+    }
+
 #ifdef ENABLE_HIP
 //! test case for bond forces on the GPU
 UP_TEST(PPPMForceComputeGPU_basic)
@@ -2,6 +2,7 @@
 # Part of HOOMD-blue, released under the BSD 3-Clause License.
 
 import hoomd
+import numpy
 import pytest
 from hoomd.conftest import operation_pickling_check
 
@@ -37,6 +38,12 @@ def test_balance_properties():
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.mode == 'particles'
+    balance.mode = 'time'
+    assert balance.mode == 'time'
+    with pytest.raises(ValueError):
+        balance.mode = 'neighbors'
+
 
 def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     snapshot = lattice_snapshot_factory()
@@ -75,6 +82,10 @@ def test_attach_detach(simulation_factory, lattice_snapshot_factory):
     balance.max_iterations = 5
     assert balance.max_iterations == 5
 
+    assert balance.mode == 'particles'
+    balance.mode = 'weights'
+    assert balance.mode == 'weights'
+
     sim.operations.tuners.remove(balance)
 
 
@@ -114,3 +125,47 @@ def test_balance_action(device, simulation_factory, lattice_snapshot_factory):
 
     # the load balance should move the split place down toward the particles
     assert sim.state.domain_decomposition_split_fractions[2][0] < 0.5
+
+
+def test_balance_weights(device, simulation_factory):
+    """Test that the weights move the split away from the particle balance."""
+    if device.communicator.num_ranks != 2:
+        pytest.skip("Test supports only 2 ranks")
+
+    snapshot = hoomd.Snapshot(device.communicator)
+    if snapshot.communicator.rank == 0:
+        # a dense slab in the lower MPI domain and as many vapor particles
+        # without neighbors in the upper domain
+        slab = [(x, y, z)
+                for x in (-1.5, -0.5, 0.5, 1.5)
+                for y in (-1.5, -0.5, 0.5, 1.5)
+                for z in (-6, -5, -4)]
+        vapor = [(x, y, z)
+                 for x in (-4.5, -1.5, 1.5, 4.5)
+                 for y in (-4.5, -1.5, 1.5, 4.5)
+                 for z in (1.5, 4.5, 7.5)]
+        snapshot.configuration.box = [12, 12, 20, 0, 0, 0]
+        snapshot.particles.N = len(slab) + len(vapor)
+        snapshot.particles.types = ['A']
+        snapshot.particles.position[:] = slab + vapor
+
+    splits = {}
+    for mode in ('particles', 'weights'):
+        sim = simulation_factory(snapshot, domain_decomposition=(1, 1, 2))
+
+        # without integration methods, the particles stay in place
+        nlist = hoomd.md.nlist.Cell(buffer=0.4)
+        lj = hoomd.md.pair.LJ(nlist=nlist, default_r_cut=2.5)
+        lj.params[('A', 'A')] = dict(epsilon=1.0, sigma=1.0)
+        sim.operations.integrator = hoomd.md.Integrator(dt=0.001, forces=[lj])
+
+        balance = hoomd.tune.LoadBalancer(trigger=hoomd.trigger.Periodic(1),
+                                          mode=mode)
+        sim.operations.tuners.append(balance)
+        sim.run(1)
+        splits[mode] = sim.state.domain_decomposition_split_fractions[2][0]
+
+    # the ranks own the same number of particles, but the slab particles have
+    # many neighbors
+    numpy.testing.assert_allclose(splits['particles'], 0.5)
+    assert splits['weights'] < 0.5
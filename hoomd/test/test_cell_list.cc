@@ -588,3 +588,59 @@ UP_TEST(CellListGPU_large)
         new ExecutionConfiguration(ExecutionConfiguration::GPU)));
     }
 #endif
+
+#ifdef ENABLE_TBB
+//! Validate that the threaded cell list build matches the serial one
+UP_TEST(CellList_threaded)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+
+    unsigned int N = 10000;
+    RandomInitializer rand_init(N, Scalar(0.2), Scalar(0.9), "A");
+    std::shared_ptr<SnapshotSystemData<Scalar>> snap;
+    snap = rand_init.getSnapshot();
+    std::shared_ptr<SystemDefinition> sysdef(new SystemDefinition(snap, exec_conf));
+
+    // build the reference cell list on a single thread
+    exec_conf->setNumThreads(1);
+    std::shared_ptr<CellList> cl_serial(new CellList(sysdef));
+    cl_serial->setNominalWidth(Scalar(3.0));
+    cl_serial->setFlagIndex();
+    cl_serial->compute(0);
+
+    exec_conf->setNumThreads(4);
+    std::shared_ptr<CellList> cl_threaded(new CellList(sysdef));
+    cl_threaded->setNominalWidth(Scalar(3.0));
+    cl_threaded->setFlagIndex();
+    cl_threaded->compute(0);
+
+    UP_ASSERT_EQUAL(cl_serial->getNmax(), cl_threaded->getNmax());
+
+    ArrayHandle<unsigned int> h_cell_size_serial(cl_serial->getCellSizeArray(),
+                                                 access_location::host,
+                                                 access_mode::read);
+    ArrayHandle<unsigned int> h_cell_size_threaded(cl_threaded->getCellSizeArray(),
+                                                   access_location::host,
+                                                   access_mode::read);
+    ArrayHandle<Scalar4> h_xyzf_serial(cl_serial->getXYZFArray(),
+                                       access_location::host,
+                                       access_mode::read);
+    ArrayHandle<Scalar4> h_xyzf_threaded(cl_threaded->getXYZFArray(),
+                                         access_location::host,
+                                         access_mode::read);
+
+    // the cells must hold the same particles in the same order
+    Index2D cli = cl_serial->getCellListIndexer();
+    unsigned int ncell = cl_serial->getCellIndexer().getNumElements();
+    for (unsigned int cell = 0; cell < ncell; cell++)
+        {
+        UP_ASSERT_EQUAL(h_cell_size_serial.data[cell], h_cell_size_threaded.data[cell]);
+        for (unsigned int offset = 0; offset < h_cell_size_serial.data[cell]; offset++)
+            {
+            UP_ASSERT_EQUAL(__scalar_as_int(h_xyzf_serial.data[cli(offset, cell)].w),
+                            __scalar_as_int(h_xyzf_threaded.data[cli(offset, cell)].w));
+            }
+        }
+    }
+#endif
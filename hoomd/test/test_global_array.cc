@@ -286,6 +286,51 @@ UP_TEST(GlobalArray_resize_tests)
         }
     }
 
+//! Tests the modification count of GlobalArray
+UP_TEST(GlobalArray_modification_count_tests)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    GlobalArray<int> a(10, exec_conf);
+    GlobalArray<int> b(10, exec_conf);
+
+    // read access does not change the count
+    uint64_t count = a.getModificationCount();
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::read);
+        }
+    UP_ASSERT_EQUAL(a.getModificationCount(), count);
+
+    // write access does
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::readwrite);
+        }
+    UP_ASSERT(a.getModificationCount() > count);
+    count = a.getModificationCount();
+
+        {
+        ArrayHandle<int> h_handle(a, access_location::host, access_mode::overwrite);
+        }
+    UP_ASSERT(a.getModificationCount() > count);
+    count = a.getModificationCount();
+
+    a.resize(20);
+    UP_ASSERT(a.getModificationCount() > count);
+    count = a.getModificationCount();
+
+    // after a swap, neither array reports a count it had before
+    for (unsigned int i = 0; i < 5; i++)
+        {
+        ArrayHandle<int> h_handle(b, access_location::host, access_mode::readwrite);
+        }
+    uint64_t count_b = b.getModificationCount();
+    a.swap(b);
+    UP_ASSERT(a.getModificationCount() > count);
+    UP_ASSERT(a.getModificationCount() > count_b);
+    UP_ASSERT(b.getModificationCount() > count);
+    UP_ASSERT(b.getModificationCount() > count_b);
+    }
+
 //! Tests GPUVector
 UP_TEST(GPUVector_basic_tests)
     {
@@ -672,6 +672,59 @@ UP_TEST(Random_test)
         }
     }
 
+//! Tests taking snapshots of selected fields
+UP_TEST(ParticleData_snapshot_fields_test)
+    {
+    std::shared_ptr<ExecutionConfiguration> exec_conf(
+        new ExecutionConfiguration(ExecutionConfiguration::CPU));
+    BoxDim box(10.0);
+
+    SnapshotParticleData<Scalar> init_snap(3);
+    init_snap.type_mapping.push_back("A");
+    for (unsigned int i = 0; i < 3; i++)
+        {
+        init_snap.pos[i] = vec3<Scalar>(Scalar(i), Scalar(0.5), Scalar(-1.0));
+        init_snap.vel[i] = vec3<Scalar>(Scalar(0.0), Scalar(i), Scalar(0.0));
+        init_snap.image[i] = make_int3(i, 0, 0);
+        }
+    ParticleData pdata(init_snap, box, exec_conf);
+
+    Scalar tol = Scalar(1e-6);
+
+    SnapshotParticleData<Scalar> snap;
+    std::vector<unsigned int> index;
+    SnapshotFields fields;
+    fields.set(snapshot_field::position);
+    fields.set(snapshot_field::image);
+    pdata.takeSnapshot(snap, fields, index);
+
+    UP_ASSERT_EQUAL(snap.size, (unsigned int)3);
+    UP_ASSERT_EQUAL(index.size(), (size_t)3);
+    for (unsigned int tag = 0; tag < 3; tag++)
+        {
+        unsigned int i = index[tag];
+        MY_CHECK_CLOSE(snap.pos[i].x, Scalar(tag), tol);
+        MY_CHECK_CLOSE(snap.pos[i].y, 0.5, tol);
+        MY_CHECK_CLOSE(snap.pos[i].z, -1.0, tol);
+        UP_ASSERT_EQUAL(snap.image[i].x, int(tag));
+
+        // fields that are not selected keep their values
+        MY_CHECK_SMALL(snap.vel[i].y, tol);
+        }
+
+    // a second snapshot only updates the selected fields
+    pdata.setVelocity(1, make_scalar3(0.0, 2.0, 3.0));
+    pdata.setPosition(1, make_scalar3(4.0, 0.0, 0.0));
+    fields.reset();
+    fields.set(snapshot_field::velocity);
+    pdata.takeSnapshot(snap, fields, index);
+
+    MY_CHECK_CLOSE(snap.vel[index[1]].y, 2.0, tol);
+    MY_CHECK_CLOSE(snap.vel[index[1]].z, 3.0, tol);
+    MY_CHECK_CLOSE(snap.vel[index[2]].y, 2.0, tol);
+    MY_CHECK_CLOSE(snap.pos[index[1]].x, 1.0, tol);
+    }
+
 /*#include "RandomGenerator.h"
 #include "MOL2DumpWriter.h"
 UP_TEST( Generator_test )
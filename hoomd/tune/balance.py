@@ -4,6 +4,7 @@
 """Define LoadBalancer."""
 
 from hoomd.data.parameterdicts import ParameterDict
+from hoomd.data.typeconverter import OnlyFrom
 from hoomd.operation import Tuner
 from hoomd.trigger import Trigger
 from hoomd import _hoomd
@@ -22,6 +23,8 @@ class LoadBalancer(Tuner):
         tolerance (`float`): Load imbalance tolerance.
         max_iterations (`int`): Maximum number of iterations to
             attempt in a single step.
+        mode (`str`): Measure of the load to balance: ``'particles'``,
+            ``'time'``, or ``'weights'``.
 
     `LoadBalancer` adjusts the boundaries of the MPI domains to distribute
     the particle load close to evenly between them. The load imbalance is
@@ -73,6 +76,37 @@ class LoadBalancer(Tuner):
     or to balance once in a short test run and then set the decomposition
     statically in a separate initialization.
 
+    .. rubric:: Balancing modes
+
+    In the default ``'particles'`` mode, `LoadBalancer` balances the number
+    of particles as described above. When the cost per particle differs
+    between regions of the system, for example in a dense droplet surrounded
+    by vapor, balance a measure of the work instead:
+
+    * ``'time'``: The wall clock time that the `hoomd.md.Integrator` spent
+      computing forces on each rank (see `hoomd.md.force.Force.compute_time`)
+      since the last load balancing step. Forces that communicate while they
+      compute are not timed.
+    * ``'weights'``: The cost weights reported by the integrator and its
+      forces. The integrator counts 1 per particle, pair potentials count the
+      number of neighbors of each particle, and other forces count 1 per
+      particle.
+
+    In these modes, the load imbalance :math:`I` is the load of a rank
+    divided by the average load per rank. `LoadBalancer` measures the load of
+    each rank on every balancing step and assumes that each particle
+    contributes the average cost per particle of the rank that owns it.
+    ``'time'`` measures the wall clock time of the CPU and is noisy when
+    balancing after only a few steps; with GPU devices it measures only the
+    time needed to launch the kernels, so use ``'weights'`` instead. The time
+    of a force that communicates, such as the distributed FFTs of
+    `hoomd.md.long_range.pppm.Coulomb` or a `hoomd.md.force.Custom` force,
+    would include the time a rank waits for slower ranks. ``'time'`` leaves
+    out these forces, so use ``'weights'`` when they dominate the cost. Both
+    modes balance the number of particles when there is no
+    `hoomd.md.Integrator` or before it has computed any timed forces. Both modes measure the integrator that the simulation
+    has on each balancing step.
+
     Balancing is ignored if there is no domain decomposition available (MPI is
     not built or is running on a single rank).
 
@@ -85,6 +119,8 @@ class LoadBalancer(Tuner):
         tolerance (`float`): Load imbalance tolerance.
         max_iterations (`int`): Maximum number of iterations to
             attempt in a single step.
+        mode (`str`): Measure of the load to balance: ``'particles'``,
+            ``'time'``, or ``'weights'``.
     """
 
     def __init__(self,
@@ -93,18 +129,22 @@ class LoadBalancer(Tuner):
                  y=True,
                  z=True,
                  tolerance=1.02,
-                 max_iterations=1):
+                 max_iterations=1,
+                 mode='particles'):
         defaults = dict(x=x,
                         y=y,
                         z=z,
                         tolerance=tolerance,
                         max_iterations=max_iterations,
+                        mode=mode,
                         trigger=trigger)
         self._param_dict = ParameterDict(x=bool,
                                          y=bool,
                                          z=bool,
                                          max_iterations=int,
                                          tolerance=float,
+                                         mode=OnlyFrom(
+                                             ['particles', 'time', 'weights']),
                                          trigger=Trigger)
         self._param_dict.update(defaults)
 
@@ -117,4 +157,7 @@ class LoadBalancer(Tuner):
         self._cpp_obj = cpp_cls(self._simulation.state._cpp_sys_def,
                                 self.trigger)
 
+        # the load is measured by the integrator the system has at each update
+        self._cpp_obj.setSystem(self._simulation._cpp_sys)
+
         super()._attach()
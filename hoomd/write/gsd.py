@@ -42,6 +42,15 @@ class GSD(Writer):
             Defaults to ``['property']``.
         log (hoomd.logging.Logger): Provide log quantities to write. Defaults to
             `None`.
+        async_write (bool): When `True`, write frames to the file on a
+            background thread. Defaults to `False`.
+        queue_depth (int): Maximum number of frames waiting to be written
+            when *async_write* is `True`. Defaults to 2.
+        mpi_io (bool): When `True`, write the particle data with collective
+            MPI-IO from all ranks. Defaults to `False`.
+        mpi_io_writers (int): Number of ranks that perform the file system
+            writes when *mpi_io* is `True`. Set to 0 to use the MPI
+            implementation's default. Defaults to 0.
 
     `GSD` writes a simulation snapshot to the specified file each time it
     triggers. `GSD` can store all particle, bond, angle, dihedral, improper,
@@ -123,6 +132,23 @@ class GSD(Writer):
         will write out all of the selected particles in ascending tag order and
         will **not** write out **topology**.
 
+    When *async_write* is `True`, `GSD` collects each frame (including the
+    logged quantities) on the step it triggers and writes it to the file on a
+    background thread while the simulation continues. When *queue_depth*
+    frames are waiting to be written, the next frame waits for the oldest one
+    to finish. `GSD` writes all queued frames before `Simulation.run
+    <hoomd.Simulation.run>` returns. Use *async_write* to hide the cost of
+    writing large frames to slow file systems.
+
+    By default, `GSD` gathers all particles to the root rank in MPI
+    simulations and writes them from there. When *mpi_io* is `True`, each rank
+    writes the particles it owns directly to their place in the file with
+    collective MPI-IO. This avoids storing the whole system in the memory of the
+    root rank and spreads the writes over *mpi_io_writers* ranks. The file is a
+    standard GSD file. Topology and logged quantities are still written by the
+    root rank. *mpi_io* has no effect in serial simulations and cannot be
+    combined with *async_write*.
+
     Tip:
         All logged data chunks must be present in the first frame in the gsd
         file to provide the default value. To achieve this, set the `log`
@@ -141,6 +167,14 @@ class GSD(Writer):
         truncate (bool): When `True`, truncate the file and write a new frame 0
             each time this operation triggers.
         dynamic (list[str]): Quantity categories to save in every frame.
+        async_write (bool): When `True`, write frames to the file on a
+            background thread.
+        queue_depth (int): Maximum number of frames waiting to be written
+            when *async_write* is `True`.
+        mpi_io (bool): When `True`, write the particle data with collective
+            MPI-IO from all ranks.
+        mpi_io_writers (int): Number of ranks that perform the file system
+            writes when *mpi_io* is `True` (0 selects the MPI default).
     """
 
     def __init__(self,
@@ -150,7 +184,11 @@ class GSD(Writer):
                  mode='ab',
                  truncate=False,
                  dynamic=None,
-                 log=None):
+                 log=None,
+                 async_write=False,
+                 queue_depth=2,
+                 mpi_io=False,
+                 mpi_io_writers=0):
 
         super().__init__(trigger)
 
@@ -165,6 +203,10 @@ class GSD(Writer):
                           mode=str(mode),
                           truncate=bool(truncate),
                           dynamic=[dynamic_validation],
+                          async_write=bool(async_write),
+                          queue_depth=int(queue_depth),
+                          mpi_io=bool(mpi_io),
+                          mpi_io_writers=int(mpi_io_writers),
                           _defaults=dict(filter=filter, dynamic=dynamic)))
 
         self._log = None if log is None else _GSDLogWriter(log)